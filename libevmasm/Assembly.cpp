@@ -53,6 +53,7 @@ using namespace solidity::langutil;
 using namespace solidity::util;
 
 std::map<std::string, std::shared_ptr<std::string const>> Assembly::s_sharedSourceNames;
+std::mutex Assembly::s_sharedSourceNamesMutex;
 
 AssemblyItem const& Assembly::append(AssemblyItem _i)
 {
@@ -676,6 +677,7 @@ void Assembly::encodeAllPossibleSubPathsInAssemblyTree(std::vector<size_t> _path
 
 std::shared_ptr<std::string const> Assembly::sharedSourceName(std::string const& _name) const
 {
+	std::lock_guard<std::mutex> lock(s_sharedSourceNamesMutex);
 	if (s_sharedSourceNames.find(_name) == s_sharedSourceNames.end())
 		s_sharedSourceNames[_name] = std::make_shared<std::string>(_name);
 
@@ -38,6 +38,7 @@
 #include <sstream>
 #include <memory>
 #include <map>
+#include <mutex>
 #include <utility>
 
 namespace solidity::evmasm
@@ -296,6 +297,7 @@ protected:
 
 	// FIXME: This being static means that the strings won't be freed when they're no longer needed
 	static std::map<std::string, std::shared_ptr<std::string const>> s_sharedSourceNames;
+	static std::mutex s_sharedSourceNamesMutex;
 
 public:
 	size_t m_currentModifierDepth = 0;
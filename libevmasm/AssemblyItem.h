@@ -29,6 +29,8 @@
 #include <libsolutil/Common.h>
 #include <libsolutil/Numeric.h>
 #include <libsolutil/Assertions.h>
+#include <limits>
+#include <memory>
 #include <optional>
 #include <iostream>
 #include <sstream>
@@ -79,12 +81,12 @@ public:
 		if (m_type == Operation)
 			m_instruction = Instruction(uint8_t(_data));
 		else
-			m_data = std::make_shared<u256>(std::move(_data));
+			m_data = Value(_data);
 	}
 	explicit AssemblyItem(bytes _verbatimData, size_t _arguments, size_t _returnVariables):
 		m_type(VerbatimBytecode),
 		m_instruction{},
-		m_verbatimBytecode{{_arguments, _returnVariables, std::move(_verbatimData)}},
+		m_verbatimBytecode{std::make_shared<std::tuple<size_t, size_t, bytes> const>(_arguments, _returnVariables, std::move(_verbatimData))},
 		m_debugData{langutil::DebugData::create()}
 	{}
 
@@ -105,8 +107,8 @@ public:
 	void setPushTagSubIdAndTag(size_t _subId, size_t _tag);
 
 	AssemblyItemType type() const { return m_type; }
-	u256 const& data() const { assertThrow(m_type != Operation, util::Exception, ""); return *m_data; }
-	void setData(u256 const& _data) { assertThrow(m_type != Operation, util::Exception, ""); m_data = std::make_shared<u256>(_data); }
+	u256 data() const { assertThrow(m_type != Operation, util::Exception, ""); return m_data.get(); }
+	void setData(u256 const& _data) { assertThrow(m_type != Operation, util::Exception, ""); m_data = Value(_data); }
 
 	/// This function is used in `Assembly::assemblyJSON`.
 	/// It returns the name & data of the current assembly item.
@@ -131,7 +133,7 @@ public:
 		else if (type() == VerbatimBytecode)
 			return *m_verbatimBytecode == *_other.m_verbatimBytecode;
 		else
-			return data() == _other.data();
+			return m_data == _other.m_data;
 	}
 	bool operator!=(AssemblyItem const& _other) const { return !operator==(_other); }
 	/// Less-than operator compatible with operator==.
@@ -144,7 +146,7 @@ public:
 		else if (type() == VerbatimBytecode)
 			return *m_verbatimBytecode < *_other.m_verbatimBytecode;
 		else
-			return data() < _other.data();
+			return m_data < _other.m_data;
 	}
 
 	/// Shortcut that avoids constructing an AssemblyItem just to perform the comparison.
@@ -202,8 +204,8 @@ public:
 	JumpType getJumpType() const { return m_jumpType; }
 	std::string getJumpTypeAsString() const;
 
-	void setPushedValue(u256 const& _value) const { m_pushedValue = std::make_shared<u256>(_value); }
-	u256 const* pushedValue() const { return m_pushedValue.get(); }
+	void setPushedValue(u256 const& _value) const { m_pushedValue = Value(_value); }
+	std::optional<u256> pushedValue() const { return m_pushedValue ? std::make_optional(m_pushedValue->get()) : std::nullopt; }
 
 	std::string toAssemblyText(Assembly const& _assembly) const;
 
@@ -212,19 +214,57 @@ public:
 	void setImmutableOccurrences(size_t _n) const { m_immutableOccurrences = _n; }
 
 private:
+	/// Unsigned 256-bit value that is stored inline if it fits into 64 bits and out of line otherwise.
+	/// Tags, sizes, offsets and most constants are small, so copying and comparing items
+	/// rarely has to touch the heap.
+	class Value
+	{
+	public:
+		Value() = default;
+		explicit Value(u256 const& _value)
+		{
+			if (_value <= std::numeric_limits<uint64_t>::max())
+				m_small = static_cast<uint64_t>(_value);
+			else
+				m_large = std::make_shared<u256 const>(_value);
+		}
+
+		u256 get() const { return m_large ? *m_large : u256(m_small); }
+
+		// Values that fit into 64 bits are never stored out of line, so a small value
+		// is always less than a large one.
+		bool operator==(Value const& _other) const
+		{
+			if (!m_large || !_other.m_large)
+				return !m_large && !_other.m_large && m_small == _other.m_small;
+			return *m_large == *_other.m_large;
+		}
+		bool operator<(Value const& _other) const
+		{
+			if (!m_large || !_other.m_large)
+				return _other.m_large || (!m_large && m_small < _other.m_small);
+			return *m_large < *_other.m_large;
+		}
+
+	private:
+		uint64_t m_small = 0;
+		/// Shared between copies and never modified.
+		std::shared_ptr<u256 const> m_large;
+	};
+
 	size_t opcodeCount() const noexcept;
 
 	AssemblyItemType m_type;
 	Instruction m_instruction; ///< Only valid if m_type == Operation
-	std::shared_ptr<u256> m_data; ///< Only valid if m_type != Operation
+	JumpType m_jumpType = JumpType::Ordinary;
+	Value m_data; ///< Only valid if m_type != Operation
 	/// If m_type == VerbatimBytecode, this holds number of arguments, number of
 	/// return variables and verbatim bytecode.
-	std::optional<std::tuple<size_t, size_t, bytes>> m_verbatimBytecode;
+	std::shared_ptr<std::tuple<size_t, size_t, bytes> const> m_verbatimBytecode;
 	langutil::DebugData::ConstPtr m_debugData;
-	JumpType m_jumpType = JumpType::Ordinary;
 	/// Pushed value for operations with data to be determined during assembly stage,
 	/// e.g. PushSubSize, PushTag, PushSub, etc.
-	mutable std::shared_ptr<u256> m_pushedValue;
+	mutable std::optional<Value> m_pushedValue;
 	/// Number of PushImmutable's with the same hash. Only used for AssignImmutable.
 	mutable std::optional<size_t> m_immutableOccurrences;
 };
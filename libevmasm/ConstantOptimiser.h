@@ -95,7 +95,7 @@ protected:
 	static void replaceConstants(AssemblyItems& _items, std::map<u256, AssemblyItems> const& _replacements);
 
 	Params m_params;
-	u256 const& m_value;
+	u256 const m_value;
 };
 
 /**
@@ -0,0 +1,189 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Discrimination tree for matching expressions against many simplification rules at once.
+ */
+
+#pragma once
+
+#include <libevmasm/Instruction.h>
+
+#include <libsolutil/Numeric.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace solidity::evmasm
+{
+
+/**
+ * A single node of a simplification rule pattern, without its arguments and match group.
+ */
+struct PatternSymbol
+{
+	enum class Kind { Any, Constant, Operation };
+
+	Kind kind = Kind::Any;
+	/// Only valid for operations.
+	Instruction instruction = Instruction::STOP;
+	/// Only valid for operations.
+	size_t argumentCount = 0;
+	/// The value a constant has to have, if it has to have a specific one.
+	std::optional<u256> value;
+};
+
+/**
+ * Discrimination tree built from the patterns of a list of simplification rules.
+ *
+ * Each pattern is flattened into the sequence of its nodes in pre-order and the sequences of all
+ * rules are merged into a tree. An expression is matched against all patterns in a single walk
+ * over the tree: at each tree node the branches for the operation or constant at the current
+ * position of the expression are followed, as well as the wildcard branch, which skips the
+ * whole subexpression. This way every subexpression is inspected once per distinct pattern prefix
+ * instead of once per rule.
+ *
+ * The result are the indices of all rules whose patterns match the expression structurally.
+ * Match groups and feasibility conditions are not considered and have to be checked for each
+ * candidate separately.
+ *
+ * @a Pattern has to provide @a symbol() and @a arguments(). The expression is accessed through
+ * a view that provides, for a @a Position in the expression:
+ *  - std::optional<u256> constant(Position) - the value if the pattern can match a constant there,
+ *  - std::optional<Instruction> operation(Position, std::vector<Position>&) - the instruction
+ *    if an operation pattern can match there, appending the positions of its arguments in order.
+ *
+ * Keeps state between calls and must therefore not be shared between threads.
+ */
+template <class Pattern, class Position>
+class SimplificationRuleTree
+{
+public:
+	/// Adds the pattern of the rule at position @a _ruleIndex in the rule list.
+	void insert(Pattern const& _pattern, size_t _ruleIndex)
+	{
+		std::vector<PatternSymbol> symbols;
+		flatten(_pattern, symbols);
+
+		Node* node = &m_root;
+		for (PatternSymbol const& symbol: symbols)
+		{
+			std::unique_ptr<Node>* child = nullptr;
+			switch (symbol.kind)
+			{
+			case PatternSymbol::Kind::Any:
+				child = &node->any;
+				break;
+			case PatternSymbol::Kind::Constant:
+				child = symbol.value ? &node->constants[*symbol.value] : &node->anyConstant;
+				break;
+			case PatternSymbol::Kind::Operation:
+				child = &node->operations[{symbol.instruction, symbol.argumentCount}];
+				break;
+			}
+			if (!*child)
+				*child = std::make_unique<Node>();
+			node = child->get();
+		}
+		node->rules.push_back(_ruleIndex);
+	}
+
+	/// @returns the indices of all rules whose patterns structurally match the expression
+	/// at @a _root, in increasing order.
+	template <class View>
+	std::vector<size_t> const& candidates(Position _root, View const& _view)
+	{
+		m_candidates.clear();
+		m_pending.clear();
+		m_pending.push_back(_root);
+		collect(m_root, _view);
+		std::sort(m_candidates.begin(), m_candidates.end());
+		return m_candidates;
+	}
+
+private:
+	struct Node
+	{
+		/// Rules whose patterns end at this node.
+		std::vector<size_t> rules;
+		std::unique_ptr<Node> any;
+		std::unique_ptr<Node> anyConstant;
+		std::map<u256, std::unique_ptr<Node>> constants;
+		std::map<std::pair<Instruction, size_t>, std::unique_ptr<Node>> operations;
+	};
+
+	static void flatten(Pattern const& _pattern, std::vector<PatternSymbol>& _symbols)
+	{
+		_symbols.push_back(_pattern.symbol());
+		for (Pattern const& argument: _pattern.arguments())
+			flatten(argument, _symbols);
+	}
+
+	template <class View>
+	void collect(Node const& _node, View const& _view)
+	{
+		if (m_pending.empty())
+		{
+			m_candidates.insert(m_candidates.end(), _node.rules.begin(), _node.rules.end());
+			return;
+		}
+
+		Position position = m_pending.back();
+		m_pending.pop_back();
+
+		if (_node.any)
+			collect(*_node.any, _view);
+
+		if (_node.anyConstant || !_node.constants.empty())
+			if (std::optional<u256> value = _view.constant(position))
+			{
+				if (_node.anyConstant)
+					collect(*_node.anyConstant, _view);
+				if (auto it = _node.constants.find(*value); it != _node.constants.end())
+					collect(*it->second, _view);
+			}
+
+		if (!_node.operations.empty())
+		{
+			size_t const pendingSize = m_pending.size();
+			if (std::optional<Instruction> instruction = _view.operation(position, m_pending))
+			{
+				auto it = _node.operations.find({*instruction, m_pending.size() - pendingSize});
+				if (it != _node.operations.end())
+				{
+					// The first argument has to be matched first, so it has to end up last.
+					std::reverse(m_pending.begin() + static_cast<ptrdiff_t>(pendingSize), m_pending.end());
+					collect(*it->second, _view);
+				}
+			}
+			m_pending.erase(m_pending.begin() + static_cast<ptrdiff_t>(pendingSize), m_pending.end());
+		}
+
+		m_pending.push_back(position);
+	}
+
+	Node m_root;
+	/// Positions in the expression that are still to be matched, the next one last.
+	std::vector<Position> m_pending;
+	std::vector<size_t> m_candidates;
+};
+
+}
@@ -36,6 +36,39 @@ using namespace solidity;
 using namespace solidity::evmasm;
 using namespace solidity::langutil;
 
+namespace
+{
+
+/// Presents expressions to the rule tree the way Pattern::matches() sees them.
+class ExpressionView
+{
+public:
+	using Expression = ExpressionClasses::Expression;
+
+	explicit ExpressionView(ExpressionClasses const& _classes): m_classes(_classes) {}
+
+	std::optional<u256> constant(Expression const* _expr) const
+	{
+		if (_expr->item && _expr->item->type() == Push)
+			return _expr->item->data();
+		return std::nullopt;
+	}
+
+	std::optional<Instruction> operation(Expression const* _expr, std::vector<Expression const*>& _arguments) const
+	{
+		if (!_expr->item || _expr->item->type() != Operation)
+			return std::nullopt;
+		for (ExpressionClasses::Id argument: _expr->arguments)
+			_arguments.push_back(&m_classes.representative(argument));
+		return _expr->item->instruction();
+	}
+
+private:
+	ExpressionClasses const& m_classes;
+};
+
+}
+
 SimplificationRule<Pattern> const* Rules::findFirstMatch(
 	Expression const& _expr,
 	ExpressionClasses const& _classes
@@ -44,8 +77,9 @@ SimplificationRule<Pattern> const* Rules::findFirstMatch(
 	resetMatchGroups();
 
 	assertThrow(_expr.item, OptimizerException, "");
-	for (auto const& rule: m_rules[uint8_t(_expr.item->instruction())])
+	for (size_t ruleIndex: m_ruleTree.candidates(&_expr, ExpressionView{_classes}))
 	{
+		auto const& rule = m_rules[ruleIndex];
 		if (rule.pattern.matches(_expr, _classes))
 			if (!rule.feasible || rule.feasible())
 				return &rule;
@@ -57,7 +91,7 @@ SimplificationRule<Pattern> const* Rules::findFirstMatch(
 
 bool Rules::isInitialized() const
 {
-	return !m_rules[uint8_t(Instruction::ADD)].empty();
+	return !m_rules.empty();
 }
 
 void Rules::addRules(std::vector<SimplificationRule<Pattern>> const& _rules)
@@ -68,7 +102,8 @@ void Rules::addRules(std::vector<SimplificationRule<Pattern>> const& _rules)
 
 void Rules::addRule(SimplificationRule<Pattern> const& _rule)
 {
-	m_rules[uint8_t(_rule.pattern.instruction())].push_back(_rule);
+	m_ruleTree.insert(_rule.pattern, m_rules.size());
+	m_rules.push_back(_rule);
 }
 
 Rules::Rules()
@@ -170,6 +205,27 @@ std::string Pattern::toString() const
 	return s.str();
 }
 
+PatternSymbol Pattern::symbol() const
+{
+	switch (m_type)
+	{
+	case UndefinedItem:
+		return {};
+	case Push:
+		return {
+			PatternSymbol::Kind::Constant,
+			Instruction::STOP,
+			0,
+			m_requireDataMatch ? std::make_optional(data()) : std::nullopt
+		};
+	case Operation:
+		return {PatternSymbol::Kind::Operation, m_instruction, m_arguments.size(), std::nullopt};
+	default:
+		assertThrow(false, OptimizerException, "Unsupported pattern type in simplification rule.");
+	}
+	util::unreachable();
+}
+
 bool Pattern::matchesBaseItem(AssemblyItem const* _item) const
 {
 	if (m_type == UndefinedItem)
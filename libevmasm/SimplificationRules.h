@@ -26,6 +26,7 @@
 
 #include <libevmasm/ExpressionClasses.h>
 #include <libevmasm/SimplificationRule.h>
+#include <libevmasm/SimplificationRuleTree.h>
 
 #include <libsolutil/CommonData.h>
 
@@ -76,7 +77,9 @@ private:
 	std::map<unsigned, Expression const*> m_matchGroups;
 	/// Pattern to match, replacement to be applied and flag indicating whether
 	/// the replacement might remove some elements (except constants).
-	std::vector<SimplificationRule<Pattern>> m_rules[256];
+	std::vector<SimplificationRule<Pattern>> m_rules;
+	/// Patterns of all rules, used to find the rules whose patterns fit the shape of an expression.
+	SimplificationRuleTree<Pattern, Expression const*> m_ruleTree;
 };
 
 /**
@@ -117,9 +120,10 @@ public:
 	/// @returns the id of the matched expression if this pattern is part of a match group.
 	Id id() const { return matchGroupValue().id; }
 	/// @returns the data of the matched expression if this pattern is part of a match group.
-	u256 const& d() const { return matchGroupValue().item->data(); }
+	u256 d() const { return matchGroupValue().item->data(); }
 
 	std::string toString() const;
+	PatternSymbol symbol() const;
 
 	AssemblyItemType type() const { return m_type; }
 	Instruction instruction() const
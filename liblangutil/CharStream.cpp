@@ -51,6 +51,8 @@
 #include <liblangutil/CharStream.h>
 #include <liblangutil/Exceptions.h>
 
+#include <algorithm>
+
 using namespace solidity;
 using namespace solidity::langutil;
 
@@ -99,21 +101,28 @@ std::string CharStream::lineAtPosition(int _position) const
 	return line;
 }
 
-LineColumn CharStream::translatePositionToLineColumn(int _position) const
+LineColumn CharStream::translatePositionToLineColumn(int _position, ColumnUnit _unit) const
 {
-	using size_type = std::string::size_type;
-	using diff_type = std::string::difference_type;
-	size_type searchPosition = std::min<size_type>(m_source.size(), size_type(_position));
-	int lineNumber = static_cast<int>(count(m_source.begin(), m_source.begin() + diff_type(searchPosition), '\n'));
-	size_type lineStart;
-	if (searchPosition == 0)
-		lineStart = 0;
-	else
+	size_t const position = std::min<size_t>(m_source.size(), static_cast<size_t>(_position));
+	std::vector<size_t> const& starts = lineStarts();
+	// The first line starts at 0, so there is always a line start not greater than the position.
+	auto const lineIt = std::prev(std::upper_bound(starts.begin(), starts.end(), position));
+	size_t const lineStart = *lineIt;
+
+	size_t column = position - lineStart;
+	if (_unit == ColumnUnit::UTF16CodeUnits)
 	{
-		lineStart = m_source.rfind('\n', searchPosition - 1);
-		lineStart = lineStart == std::string::npos ? 0 : lineStart + 1;
+		column = 0;
+		for (size_t i = lineStart; i < position; ++i)
+		{
+			auto const byte = static_cast<unsigned char>(m_source[i]);
+			// Continuation bytes do not start a new code point. Code points outside of the
+			// basic multilingual plane (four byte sequences) need a surrogate pair.
+			if ((byte & 0xC0) != 0x80)
+				column += byte >= 0xF0 ? 2 : 1;
+		}
 	}
-	return LineColumn{lineNumber, static_cast<int>(searchPosition - lineStart)};
+	return LineColumn{static_cast<int>(lineIt - starts.begin()), static_cast<int>(column)};
 }
 
 std::string_view CharStream::text(SourceLocation const& _location) const
@@ -144,12 +153,19 @@ std::string CharStream::singleLineSnippet(std::string const& _sourceCode, Source
 	return cut;
 }
 
-std::optional<int> CharStream::translateLineColumnToPosition(LineColumn const& _lineColumn) const
+std::optional<int> CharStream::translateLineColumnToPosition(LineColumn const& _lineColumn, ColumnUnit _unit) const
 {
-	return translateLineColumnToPosition(m_source, _lineColumn);
+	std::vector<size_t> const& starts = lineStarts();
+	if (_lineColumn.line < 0 || static_cast<size_t>(_lineColumn.line) >= starts.size())
+		return std::nullopt;
+	return positionInLine(m_source, starts[static_cast<size_t>(_lineColumn.line)], _lineColumn.column, _unit);
 }
 
-std::optional<int> CharStream::translateLineColumnToPosition(std::string const& _text, LineColumn const& _input)
+std::optional<int> CharStream::translateLineColumnToPosition(
+	std::string const& _text,
+	LineColumn const& _input,
+	ColumnUnit _unit
+)
 {
 	if (_input.line < 0)
 		return std::nullopt;
@@ -163,12 +179,58 @@ std::optional<int> CharStream::translateLineColumnToPosition(std::string const&
 		offset++; // Skip linefeed.
 	}
 
-	size_t endOfLine = _text.find('\n', offset);
+	return positionInLine(_text, offset, _input.column, _unit);
+}
+
+std::vector<size_t> const& CharStream::lineStarts() const
+{
+	std::shared_ptr<std::vector<size_t> const> starts = std::atomic_load(&m_lineStarts);
+	if (!starts)
+	{
+		auto newStarts = std::make_shared<std::vector<size_t>>(1, 0);
+		for (size_t offset = m_source.find('\n'); offset != std::string::npos; offset = m_source.find('\n', offset + 1))
+			newStarts->push_back(offset + 1);
+		// If another thread was faster, keep its table so that references handed out stay valid.
+		std::shared_ptr<std::vector<size_t> const> table = std::move(newStarts);
+		if (std::atomic_compare_exchange_strong(&m_lineStarts, &starts, table))
+			starts = std::move(table);
+	}
+	// The table is never replaced once set, so it lives as long as the stream does.
+	return *starts;
+}
+
+std::optional<int> CharStream::positionInLine(
+	std::string const& _text,
+	size_t _lineStart,
+	int _column,
+	ColumnUnit _unit
+)
+{
+	if (_column < 0)
+		return std::nullopt;
+
+	size_t endOfLine = _text.find('\n', _lineStart);
 	if (endOfLine == std::string::npos)
 		endOfLine = _text.size();
 
-	if (offset + static_cast<size_t>(_input.column) > endOfLine)
-		return std::nullopt;
-	return offset + static_cast<size_t>(_input.column);
-}
+	if (_unit == ColumnUnit::Bytes)
+	{
+		if (_lineStart + static_cast<size_t>(_column) > endOfLine)
+			return std::nullopt;
+		return static_cast<int>(_lineStart + static_cast<size_t>(_column));
+	}
 
+	size_t offset = _lineStart;
+	for (size_t units = 0; units < static_cast<size_t>(_column); ++offset)
+	{
+		if (offset >= endOfLine)
+			return std::nullopt;
+		auto const byte = static_cast<unsigned char>(_text[offset]);
+		if ((byte & 0xC0) != 0x80)
+			units += byte >= 0xF0 ? 2 : 1;
+	}
+	// Skip the continuation bytes of the last code point.
+	while (offset < endOfLine && (static_cast<unsigned char>(_text[offset]) & 0xC0) == 0x80)
+		++offset;
+	return static_cast<int>(offset);
+}
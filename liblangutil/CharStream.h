@@ -51,10 +51,12 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 namespace solidity::langutil
 {
@@ -70,6 +72,14 @@ struct LineColumn;
 class CharStream
 {
 public:
+	/// Unit in which the column of a LineColumn is measured.
+	enum class ColumnUnit
+	{
+		Bytes,
+		/// UTF-16 code units, as used for positions in the Language Server Protocol.
+		UTF16CodeUnits
+	};
+
 	CharStream() = default;
 	CharStream(std::string _source, std::string _name):
 		m_source(std::move(_source)), m_name(std::move(_name)) {}
@@ -100,19 +110,27 @@ public:
 
 	size_t size() const { return m_source.size(); }
 
-	///@{
-	///@name Error printing helper functions
-	/// Functions that help pretty-printing parse errors
-	/// Do only use in error cases, they are quite expensive.
+	/// @returns the line containing @a _position, without the line terminator.
 	std::string lineAtPosition(int _position) const;
-	LineColumn translatePositionToLineColumn(int _position) const;
-	///@}
+
+	/// Translates an absolute position to line:column. Positions past the end are clamped.
+	/// Uses a table of line start offsets that is computed on first use, so that repeated calls
+	/// on the same stream take logarithmic time in the number of lines.
+	LineColumn translatePositionToLineColumn(int _position, ColumnUnit _unit = ColumnUnit::Bytes) const;
 
 	/// Translates a line:column to the absolute position.
-	std::optional<int> translateLineColumnToPosition(LineColumn const& _lineColumn) const;
+	std::optional<int> translateLineColumnToPosition(
+		LineColumn const& _lineColumn,
+		ColumnUnit _unit = ColumnUnit::Bytes
+	) const;
 
 	/// Translates a line:column to the absolute position for the given input text.
-	static std::optional<int> translateLineColumnToPosition(std::string const& _text, LineColumn const& _input);
+	/// Scans the text from the start, prefer the non-static version for repeated translations.
+	static std::optional<int> translateLineColumnToPosition(
+		std::string const& _text,
+		LineColumn const& _input,
+		ColumnUnit _unit = ColumnUnit::Bytes
+	);
 
 	/// Tests whether or not given octet sequence is present at the current position in stream.
 	/// @returns true if the sequence could be found, false otherwise.
@@ -142,10 +160,25 @@ public:
 	static std::string singleLineSnippet(std::string const& _sourceCode, SourceLocation const& _location);
 
 private:
+	/// @returns the offsets at which the lines of the source start, computing them on first use.
+	std::vector<size_t> const& lineStarts() const;
+
+	/// @returns the absolute position of @a _column in the line of @a _text starting at @a _lineStart,
+	/// or nullopt if the column is past the end of the line.
+	static std::optional<int> positionInLine(
+		std::string const& _text,
+		size_t _lineStart,
+		int _column,
+		ColumnUnit _unit
+	);
+
 	std::string m_source;
 	std::string m_name;
 	bool m_importedFromAST{false};
 	size_t m_position{0};
+	/// Offsets of line starts, shared between copies. Only accessed via std::atomic_load and
+	/// std::atomic_store so that const streams can be used from several threads.
+	mutable std::shared_ptr<std::vector<size_t> const> m_lineStarts;
 };
 
 }
@@ -41,6 +41,11 @@ public:
 	virtual std::pair<CheckResult, std::vector<std::string>>
 	check(std::vector<Expression> const& _expressionsToEvaluate) = 0;
 
+	/// Asks a call to check() that is running concurrently on another thread to give up
+	/// and return UNKNOWN as soon as possible. Has no effect on calls that start later.
+	/// Solvers that cannot be interrupted ignore the request.
+	virtual void interrupt() {}
+
 	/// @returns a list of queries that the system was not able to respond to.
 	virtual std::vector<std::string> unhandledQueries() { return {}; }
 
@@ -21,6 +21,7 @@
 #include <libsmtutil/SMTLib2Parser.h>
 
 #include <libsolutil/Keccak256.h>
+#include <libsolutil/Parallel.h>
 #include <libsolutil/StringUtils.h>
 #include <libsolutil/Visitor.h>
 
@@ -92,21 +93,36 @@ void CHCSmtLib2Interface::addRule(Expression const& _expr, std::string const& /*
 
 CHCSolverInterface::QueryResult CHCSmtLib2Interface::query(Expression const& _block)
 {
-	std::string query = dumpQuery(_block);
-	std::string response = querySolver(query);
+	return resultFromResponse(querySolver(dumpQuery(_block)));
+}
+
+std::vector<CHCSolverInterface::QueryResult> CHCSmtLib2Interface::queryConcurrently(
+	std::vector<std::string> const& _queries,
+	size_t _threads
+)
+{
+	std::vector<std::string> responses(_queries.size());
+	parallelFor(_queries.size(), _threads, [&](size_t _index) {
+		responses[_index] = querySolver(_queries[_index]);
+	});
+	// Parsing the responses uses the declarations in m_context, so it is done sequentially.
+	return applyMap(responses, [this](std::string const& _response) { return resultFromResponse(_response); });
+}
 
+CHCSolverInterface::QueryResult CHCSmtLib2Interface::resultFromResponse(std::string const& _response) const
+{
 	CheckResult result;
 	// NOTE: Our internal semantics is UNSAT -> SAFE and SAT -> UNSAFE, which corresponds to usual SMT-based model checking
 	// However, with CHC solvers, the meaning is flipped, UNSAT -> UNSAFE and SAT -> SAFE.
 	// So we have to flip the answer.
-	if (boost::starts_with(response, "sat"))
+	if (boost::starts_with(_response, "sat"))
 	{
-		auto maybeInvariants = invariantsFromSolverResponse(response);
+		auto maybeInvariants = invariantsFromSolverResponse(_response);
 		return {CheckResult::UNSATISFIABLE, maybeInvariants.value_or(Expression(true)), {}};
 	}
-	else if (boost::starts_with(response, "unsat"))
+	else if (boost::starts_with(_response, "unsat"))
 		result = CheckResult::SATISFIABLE;
-	else if (boost::starts_with(response, "unknown"))
+	else if (boost::starts_with(_response, "unknown"))
 		result = CheckResult::UNKNOWN;
 	else
 		result = CheckResult::ERROR;
@@ -176,6 +192,7 @@ std::string CHCSmtLib2Interface::querySolver(std::string const& _input)
 			return result.responseOrErrorMessage;
 	}
 
+	std::lock_guard<std::mutex> lock(m_unhandledQueriesMutex);
 	m_unhandledQueries.push_back(_input);
 	return "unknown\n";
 }
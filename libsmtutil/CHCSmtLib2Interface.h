@@ -27,6 +27,8 @@
 #include <libsmtutil/SMTLib2Interface.h>
 #include <libsmtutil/SMTLib2Parser.h>
 
+#include <mutex>
+
 namespace solidity::smtutil
 {
 
@@ -53,6 +55,12 @@ public:
 
 	std::string dumpQuery(Expression const& _expr);
 
+	/// Sends the independent queries @a _queries, created by dumpQuery(), to the solver
+	/// using up to @a _threads concurrent solver invocations (0 means one per CPU core).
+	/// The SMT callback has to be thread-safe if more than one thread is used.
+	/// @returns the results in the order of the queries.
+	std::vector<QueryResult> queryConcurrently(std::vector<std::string> const& _queries, size_t _threads);
+
 	std::vector<std::string> unhandledQueries() const { return m_unhandledQueries; }
 
 protected:
@@ -92,8 +100,12 @@ protected:
 	void createHeader();
 
 	/// Communicates with the solver via the callback. Throws SMTSolverError on error.
+	/// Can be called concurrently as long as the callback is thread-safe.
 	virtual std::string querySolver(std::string const& _input);
 
+	/// Translates the solver's response to a query created by dumpQuery().
+	QueryResult resultFromResponse(std::string const& _response) const;
+
 	/// Translates CHC solver response with a model to our representation of invariants. Returns None on error.
 	std::optional<smtutil::Expression> invariantsFromSolverResponse(std::string const& _response) const;
 
@@ -104,6 +116,8 @@ protected:
 
 	std::map<util::h256, std::string> m_queryResponses;
 	std::vector<std::string> m_unhandledQueries;
+	/// Guards m_unhandledQueries during queryConcurrently().
+	std::mutex m_unhandledQueriesMutex;
 
 	frontend::ReadCallback::Callback m_smtCallback;
 };
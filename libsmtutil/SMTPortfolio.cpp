@@ -20,6 +20,13 @@
 
 #include <libsmtutil/SMTLib2Interface.h>
 
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <thread>
+
 using namespace solidity;
 using namespace solidity::util;
 using namespace solidity::frontend;
@@ -27,9 +34,10 @@ using namespace solidity::smtutil;
 
 SMTPortfolio::SMTPortfolio(
 	std::vector<std::unique_ptr<BMCSolverInterface>> _solvers,
-	std::optional<unsigned> _queryTimeout
+	std::optional<unsigned> _queryTimeout,
+	bool _raceSolvers
 ):
-	BMCSolverInterface(_queryTimeout), m_solvers(std::move(_solvers))
+	BMCSolverInterface(_queryTimeout), m_solvers(std::move(_solvers)), m_raceSolvers(_raceSolvers)
 {}
 
 
@@ -93,9 +101,15 @@ void SMTPortfolio::addAssertion(Expression const& _expr)
  *   when it is told that this is a hard query to solve.
  *
  *   If all solvers return ERROR, the result is ERROR.
+ *
+ * In the racing mode, the first solver to answer the query decides the result and 2) does not apply.
+ * If no solver answers, 3) applies.
 */
 std::pair<CheckResult, std::vector<std::string>> SMTPortfolio::check(std::vector<Expression> const& _expressionsToEvaluate)
 {
+	if (m_raceSolvers && m_solvers.size() > 1)
+		return race(_expressionsToEvaluate);
+
 	CheckResult lastResult = CheckResult::ERROR;
 	std::vector<std::string> finalValues;
 	for (auto const& s: m_solvers)
@@ -122,6 +136,75 @@ std::pair<CheckResult, std::vector<std::string>> SMTPortfolio::check(std::vector
 	return std::make_pair(lastResult, finalValues);
 }
 
+void SMTPortfolio::interrupt()
+{
+	for (auto const& s: m_solvers)
+		s->interrupt();
+}
+
+std::pair<CheckResult, std::vector<std::string>> SMTPortfolio::race(std::vector<Expression> const& _expressionsToEvaluate)
+{
+	std::mutex mutex;
+	std::condition_variable solverFinished;
+	size_t runningSolvers = m_solvers.size();
+	std::optional<size_t> winner;
+	std::vector<std::pair<CheckResult, std::vector<std::string>>> results(m_solvers.size());
+	std::vector<std::exception_ptr> failures(m_solvers.size());
+
+	std::vector<std::thread> threads;
+	threads.reserve(m_solvers.size());
+	for (size_t i = 0; i < m_solvers.size(); ++i)
+		threads.emplace_back([&, i]() {
+			std::pair<CheckResult, std::vector<std::string>> result{CheckResult::ERROR, {}};
+			std::exception_ptr failure;
+			try
+			{
+				result = m_solvers[i]->check(_expressionsToEvaluate);
+			}
+			catch (...)
+			{
+				failure = std::current_exception();
+			}
+
+			std::lock_guard<std::mutex> lock(mutex);
+			if (!winner && !failure && solverAnswered(result.first))
+				winner = i;
+			results[i] = std::move(result);
+			failures[i] = failure;
+			--runningSolvers;
+			solverFinished.notify_all();
+		});
+
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		solverFinished.wait(lock, [&]() { return winner.has_value() || runningSolvers == 0; });
+		// A solver may not have started its check yet when it is interrupted, in which case the
+		// request has no effect. Keep repeating it until all the other solvers give up.
+		while (runningSolvers > 0)
+		{
+			for (size_t i = 0; i < m_solvers.size(); ++i)
+				if (i != winner)
+					m_solvers[i]->interrupt();
+			solverFinished.wait_for(lock, std::chrono::milliseconds(10));
+		}
+	}
+	for (std::thread& thread: threads)
+		thread.join();
+
+	// Failures of the losing solvers do not matter once one of them answered.
+	if (winner)
+		return std::move(results[*winner]);
+
+	for (std::exception_ptr const& failure: failures)
+		if (failure)
+			std::rethrow_exception(failure);
+
+	for (auto const& result: results)
+		if (result.first == CheckResult::UNKNOWN)
+			return {CheckResult::UNKNOWN, {}};
+	return {CheckResult::ERROR, {}};
+}
+
 std::vector<std::string> SMTPortfolio::unhandledQueries()
 {
 	// This code assumes that the constructor guarantees that
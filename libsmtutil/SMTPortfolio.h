@@ -32,8 +32,10 @@ namespace solidity::smtutil
 /**
  * The SMTPortfolio wraps all available solvers within a single interface,
  * propagating the functionalities to all solvers.
- * It also checks whether different solvers give conflicting answers
- * to SMT queries.
+ * By default it waits for all solvers to answer a query and checks whether
+ * they give conflicting answers.
+ * In the racing mode, the solvers run concurrently and the first one to answer
+ * decides the result, while the others are interrupted. Conflicts are not detected then.
  */
 class SMTPortfolio: public BMCSolverInterface
 {
@@ -42,7 +44,11 @@ public:
 	SMTPortfolio(SMTPortfolio const&) = delete;
 	SMTPortfolio& operator=(SMTPortfolio const&) = delete;
 
-	SMTPortfolio(std::vector<std::unique_ptr<BMCSolverInterface>> solvers, std::optional<unsigned> _queryTimeout);
+	SMTPortfolio(
+		std::vector<std::unique_ptr<BMCSolverInterface>> solvers,
+		std::optional<unsigned> _queryTimeout,
+		bool _raceSolvers = false
+	);
 
 	void reset() override;
 
@@ -54,6 +60,7 @@ public:
 	void addAssertion(Expression const& _expr) override;
 
 	std::pair<CheckResult, std::vector<std::string>> check(std::vector<Expression> const& _expressionsToEvaluate) override;
+	void interrupt() override;
 
 	std::vector<std::string> unhandledQueries() override;
 	size_t solvers() override { return m_solvers.size(); }
@@ -63,7 +70,11 @@ public:
 private:
 	static bool solverAnswered(CheckResult result);
 
+	/// Runs all solvers concurrently and returns the result of the first one that answers.
+	std::pair<CheckResult, std::vector<std::string>> race(std::vector<Expression> const& _expressionsToEvaluate);
+
 	std::vector<std::unique_ptr<BMCSolverInterface>> m_solvers;
+	bool m_raceSolvers = false;
 
 	std::vector<Expression> m_assertions;
 };
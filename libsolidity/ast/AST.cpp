@@ -276,7 +276,8 @@ std::vector<std::pair<util::FixedHash<4>, FunctionTypePointer>> const& ContractD
 {
 	return m_interfaceFunctionList[_includeInheritedFunctions].init([&]{
 		std::set<std::string> signaturesSeen;
-		std::vector<std::pair<util::FixedHash<4>, FunctionTypePointer>> interfaceFunctionList;
+		std::vector<std::string> signatures;
+		std::vector<FunctionTypePointer> interfaceFunctions;
 
 		for (ContractDefinition const* contract: annotation().linearizedBaseContracts)
 		{
@@ -298,11 +299,16 @@ std::vector<std::pair<util::FixedHash<4>, FunctionTypePointer>> const& ContractD
 				if (signaturesSeen.count(functionSignature) == 0)
 				{
 					signaturesSeen.insert(functionSignature);
-					interfaceFunctionList.emplace_back(util::selectorFromSignatureH32(functionSignature), fun);
+					signatures.emplace_back(std::move(functionSignature));
+					interfaceFunctions.push_back(fun);
 				}
 			}
 		}
 
+		std::vector<util::FixedHash<4>> selectors = util::selectorsFromSignaturesH32(signatures);
+		std::vector<std::pair<util::FixedHash<4>, FunctionTypePointer>> interfaceFunctionList;
+		for (size_t i = 0; i < interfaceFunctions.size(); ++i)
+			interfaceFunctionList.emplace_back(selectors[i], interfaceFunctions[i]);
 		return interfaceFunctionList;
 	});
 }
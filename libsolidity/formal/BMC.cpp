@@ -65,7 +65,7 @@ BMC::BMC(
 	if (_settings.solvers.z3 && Z3Interface::available())
 		solvers.emplace_back(std::make_unique<Z3Interface>(_settings.timeout));
 #endif
-	m_interface = std::make_unique<SMTPortfolio>(std::move(solvers), _settings.timeout);
+	m_interface = std::make_unique<SMTPortfolio>(std::move(solvers), _settings.timeout, _settings.raceSolvers);
 #if defined (HAVE_Z3)
 	if (m_settings.solvers.z3)
 		if (!_smtlib2Responses.empty())
@@ -32,6 +32,7 @@
 #include <libsolidity/formal/SymbolicTypes.h>
 
 #include <libsolidity/ast/TypeProvider.h>
+#include <libsolidity/interface/UniversalCallback.h>
 
 #include <libsmtutil/CHCSmtLib2Interface.h>
 #include <liblangutil/CharStreamProvider.h>
@@ -99,6 +100,14 @@ void CHC::analyze(SourceUnit const& _source)
 			" If you wish to use Eldarica, please enable Eldarica only."
 		);
 
+	if (m_settings.threads != 1 && !m_settings.solvers.z3 && !canQueryConcurrently())
+		m_errorReporter.warning(
+			4717_error,
+			SourceLocation(),
+			"CHC: The SMT callback may not support concurrent queries,"
+			" therefore the verification targets are checked sequentially."
+		);
+
 	if (!shouldAnalyze(_source))
 		return;
 
@@ -1919,15 +1928,7 @@ void CHC::addRule(smtutil::Expression const& _rule, std::string const& _ruleName
 CHCSolverInterface::QueryResult CHC::query(smtutil::Expression const& _query, langutil::SourceLocation const& _location)
 {
 	if (m_settings.printQuery)
-	{
-		auto smtLibInterface = dynamic_cast<CHCSmtLib2Interface*>(m_interface.get());
-		solAssert(smtLibInterface, "Requested to print queries but CHCSmtLib2Interface not available");
-		std::string smtLibCode = smtLibInterface->dumpQuery(_query);
-		m_errorReporter.info(
-			2339_error,
-			"CHC: Requested query:\n" + smtLibCode
-		);
-	}
+		printQuery(_query);
 	auto result = m_interface->query(_query);
 	switch (result.answer)
 	{
@@ -1957,17 +1958,33 @@ CHCSolverInterface::QueryResult CHC::query(smtutil::Expression const& _query, la
 	}
 	case CheckResult::UNSATISFIABLE:
 	case CheckResult::UNKNOWN:
-		break;
 	case CheckResult::CONFLICTING:
-		m_errorReporter.warning(1988_error, _location, "CHC: At least two SMT solvers provided conflicting answers. Results might not be sound.");
-		break;
 	case CheckResult::ERROR:
-		m_errorReporter.warning(1218_error, _location, "CHC: Error trying to invoke SMT solver.");
 		break;
 	}
+	reportSolverFailure(result.answer, _location);
 	return result;
 }
 
+void CHC::printQuery(smtutil::Expression const& _query)
+{
+	auto smtLibInterface = dynamic_cast<CHCSmtLib2Interface*>(m_interface.get());
+	solAssert(smtLibInterface, "Requested to print queries but CHCSmtLib2Interface not available");
+	std::string smtLibCode = smtLibInterface->dumpQuery(_query);
+	m_errorReporter.info(
+		2339_error,
+		"CHC: Requested query:\n" + smtLibCode
+	);
+}
+
+void CHC::reportSolverFailure(CheckResult _answer, langutil::SourceLocation const& _location)
+{
+	if (_answer == CheckResult::CONFLICTING)
+		m_errorReporter.warning(1988_error, _location, "CHC: At least two SMT solvers provided conflicting answers. Results might not be sound.");
+	else if (_answer == CheckResult::ERROR)
+		m_errorReporter.warning(1218_error, _location, "CHC: Error trying to invoke SMT solver.");
+}
+
 void CHC::verificationTargetEncountered(
 	ASTNode const* const _errorNode,
 	VerificationTargetType _type,
@@ -2068,14 +2085,19 @@ void CHC::checkVerificationTargets()
 	}
 
 	std::set<unsigned> checkedErrorIds;
-	for (auto const& [targetId, placeholders]: targetEntryPoints)
-	{
-		auto const& target = m_verificationTargets.at(targetId);
-		auto [errorType, errorReporterId] = targetDescription(target);
+	for (unsigned targetId: targetEntryPoints | ranges::views::keys)
+		checkedErrorIds.insert(m_verificationTargets.at(targetId).errorId);
 
-		checkAndReportTarget(target, placeholders, errorReporterId, errorType + " happens here.", errorType + " might happen here.");
-		checkedErrorIds.insert(target.errorId);
-	}
+	auto* smtLibInterface = dynamic_cast<CHCSmtLib2Interface*>(m_interface.get());
+	if (smtLibInterface && canQueryConcurrently())
+		checkAndReportTargetsConcurrently(targetEntryPoints, *smtLibInterface);
+	else
+		for (auto const& [targetId, placeholders]: targetEntryPoints)
+		{
+			auto const& target = m_verificationTargets.at(targetId);
+			auto [errorType, errorReporterId] = targetDescription(target);
+			checkAndReportTarget(target, placeholders, errorReporterId, errorType + " happens here.", errorType + " might happen here.");
+		}
 
 	auto toReport = m_unsafeTargets;
 	if (m_settings.showUnproved)
@@ -2188,6 +2210,67 @@ void CHC::checkVerificationTargets()
 		m_safeTargets[m_verificationTargets.at(id).errorNode].insert(m_verificationTargets.at(id));
 }
 
+void CHC::checkAndReportTargetsConcurrently(
+	std::map<unsigned, std::vector<CHCQueryPlaceholder>> const& _targetEntryPoints,
+	CHCSmtLib2Interface& _interface
+)
+{
+	// A target is skipped if an earlier target with the same node and type was found to be unsafe.
+	// To skip exactly the same targets as checkAndReportTarget, the targets are solved in rounds:
+	// each round contains the first remaining target of every node and type, and the later targets
+	// of that node and type wait for its result. Within a round, the queries are solved concurrently
+	// and the results are reported in the order of the target IDs.
+	std::vector<unsigned> remainingTargets = _targetEntryPoints | ranges::views::keys | ranges::to<std::vector>;
+	while (!remainingTargets.empty())
+	{
+		std::vector<unsigned> round;
+		std::vector<unsigned> laterTargets;
+		std::set<std::pair<ASTNode const*, VerificationTargetType>> nodesInRound;
+		for (unsigned targetId: remainingTargets)
+		{
+			auto const& target = m_verificationTargets.at(targetId);
+			if (isReportedUnsafe(target))
+				continue;
+			if (nodesInRound.emplace(target.errorNode, target.type).second)
+				round.push_back(targetId);
+			else
+				laterTargets.push_back(targetId);
+		}
+
+		std::vector<std::string> queries;
+		std::vector<std::string> errorPredicates;
+		for (unsigned targetId: round)
+		{
+			addTargetRules(m_verificationTargets.at(targetId), _targetEntryPoints.at(targetId));
+			if (m_settings.printQuery)
+				printQuery(error());
+			queries.push_back(_interface.dumpQuery(error()));
+			errorPredicates.push_back(error().name);
+		}
+
+		auto results = _interface.queryConcurrently(queries, m_settings.threads);
+		solAssert(results.size() == round.size());
+		for (size_t index = 0; index < round.size(); ++index)
+		{
+			auto const& target = m_verificationTargets.at(round[index]);
+			auto [errorType, errorReporterId] = targetDescription(target);
+			reportSolverFailure(results[index].answer, target.errorNode->location());
+			reportTarget(target, results[index], errorPredicates[index], errorReporterId, errorType + " happens here.", errorType + " might happen here.");
+		}
+
+		remainingTargets = std::move(laterTargets);
+	}
+}
+
+bool CHC::canQueryConcurrently() const
+{
+	// The SMT callback of solc runs each query in its own solver process and can be called
+	// concurrently. Other callbacks, e.g. those passed to libsolc, are not expected to be thread-safe.
+	return
+		m_settings.threads != 1 &&
+		(!m_smtCallback || m_smtCallback.target<UniversalCallback>());
+}
+
 void CHC::checkAndReportTarget(
 	CHCVerificationTarget const& _target,
 	std::vector<CHCQueryPlaceholder> const& _placeholders,
@@ -2196,9 +2279,21 @@ void CHC::checkAndReportTarget(
 	std::string _unknownMsg
 )
 {
-	if (m_unsafeTargets.count(_target.errorNode) && m_unsafeTargets.at(_target.errorNode).count(_target.type))
+	if (isReportedUnsafe(_target))
 		return;
 
+	addTargetRules(_target, _placeholders);
+	auto const& location = _target.errorNode->location();
+	reportTarget(_target, query(error(), location), error().name, _errorReporterId, std::move(_satMsg), std::move(_unknownMsg));
+}
+
+bool CHC::isReportedUnsafe(CHCVerificationTarget const& _target) const
+{
+	return m_unsafeTargets.count(_target.errorNode) && m_unsafeTargets.at(_target.errorNode).count(_target.type);
+}
+
+void CHC::addTargetRules(CHCVerificationTarget const& _target, std::vector<CHCQueryPlaceholder> const& _placeholders)
+{
 	createErrorBlock();
 	for (auto const& placeholder: _placeholders)
 		connectBlocks(
@@ -2206,8 +2301,19 @@ void CHC::checkAndReportTarget(
 			error(),
 			placeholder.constraints && placeholder.errorExpression == _target.errorId
 		);
+}
+
+void CHC::reportTarget(
+	CHCVerificationTarget const& _target,
+	CHCSolverInterface::QueryResult const& _result,
+	std::string const& _errorPredicate,
+	ErrorId _errorReporterId,
+	std::string _satMsg,
+	std::string _unknownMsg
+)
+{
 	auto const& location = _target.errorNode->location();
-	auto [result, invariant, model] = query(error(), location);
+	auto const& [result, invariant, model] = _result;
 	if (result == CheckResult::UNSATISFIABLE)
 	{
 		m_safeTargets[_target.errorNode].insert(_target);
@@ -2223,7 +2329,7 @@ void CHC::checkAndReportTarget(
 	else if (result == CheckResult::SATISFIABLE)
 	{
 		solAssert(!_satMsg.empty(), "");
-		auto cex = generateCounterexample(model, error().name);
+		auto cex = generateCounterexample(model, _errorPredicate);
 		if (cex)
 			m_unsafeTargets[_target.errorNode][_target.type] = {
 				_errorReporterId,
@@ -37,6 +37,7 @@
 
 #include <libsolidity/interface/ReadFile.h>
 
+#include <libsmtutil/CHCSmtLib2Interface.h>
 #include <libsmtutil/CHCSolverInterface.h>
 
 #include <liblangutil/SourceLocation.h>
@@ -297,6 +298,10 @@ private:
 	/// @returns <true, invariant, empty> if query is unsatisfiable (safe).
 	/// @returns <false, Expression(true), model> otherwise.
 	smtutil::CHCSolverInterface::QueryResult query(smtutil::Expression const& _query, langutil::SourceLocation const& _location);
+	/// Reports the SMT-LIB2 encoding of @a _query as info message.
+	void printQuery(smtutil::Expression const& _query);
+	/// Reports a warning if @a _answer indicates that the solvers failed.
+	void reportSolverFailure(smtutil::CheckResult _answer, langutil::SourceLocation const& _location);
 
 	void verificationTargetEncountered(ASTNode const* const _errorNode, VerificationTargetType _type, smtutil::Expression const& _errorCondition);
 
@@ -310,6 +315,26 @@ private:
 		std::string _satMsg,
 		std::string _unknownMsg = ""
 	);
+	/// Checks the targets like checkAndReportTarget, but solves the queries of independent targets concurrently.
+	void checkAndReportTargetsConcurrently(
+		std::map<unsigned, std::vector<CHCQueryPlaceholder>> const& _targetEntryPoints,
+		smtutil::CHCSmtLib2Interface& _interface
+	);
+	/// @returns true if more than one thread is requested and the SMT callback can be called concurrently.
+	bool canQueryConcurrently() const;
+	/// @returns true if a target with the same node and type as @a _target was already found to be unsafe.
+	bool isReportedUnsafe(CHCVerificationTarget const& _target) const;
+	/// Creates a new error block and connects it to @a _placeholders for @a _target.
+	void addTargetRules(CHCVerificationTarget const& _target, std::vector<CHCQueryPlaceholder> const& _placeholders);
+	/// Records the result of the query for @a _target whose error block is @a _errorPredicate.
+	void reportTarget(
+		CHCVerificationTarget const& _target,
+		smtutil::CHCSolverInterface::QueryResult const& _result,
+		std::string const& _errorPredicate,
+		langutil::ErrorId _errorReporterId,
+		std::string _satMsg,
+		std::string _unknownMsg
+	);
 
 	std::pair<std::string, langutil::ErrorId> targetDescription(CHCVerificationTarget const& _target);
 
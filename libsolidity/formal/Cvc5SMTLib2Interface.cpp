@@ -27,9 +27,16 @@ Cvc5SMTLib2Interface::Cvc5SMTLib2Interface(
 	std::optional<unsigned int> _queryTimeout
 ): SMTLib2Interface({}, std::move(_smtCallback), _queryTimeout)
 {
+	m_solverCommand = frontend::UniversalCallback::useOwnSolverCommand(m_smtCallback);
 }
 
 void Cvc5SMTLib2Interface::setupSmtCallback() {
-	if (auto* universalCallback = m_smtCallback.target<frontend::UniversalCallback>())
-		universalCallback->smtCommand().setCvc5(m_queryTimeout);
+	if (m_solverCommand)
+		m_solverCommand->setCvc5(m_queryTimeout);
+}
+
+void Cvc5SMTLib2Interface::interrupt()
+{
+	if (m_solverCommand)
+		m_solverCommand->interrupt();
 }
@@ -28,12 +28,13 @@ EldaricaCHCSmtLib2Interface::EldaricaCHCSmtLib2Interface(
 	bool computeInvariants
 ): CHCSmtLib2Interface({}, std::move(_smtCallback), _queryTimeout), m_computeInvariants(computeInvariants)
 {
+	m_solverCommand = frontend::UniversalCallback::useOwnSolverCommand(m_smtCallback);
 }
 
 std::string EldaricaCHCSmtLib2Interface::querySolver(std::string const& _input)
 {
-	if (auto* universalCallback = m_smtCallback.target<frontend::UniversalCallback>())
-		universalCallback->smtCommand().setEldarica(m_queryTimeout, m_computeInvariants);
+	if (m_solverCommand)
+		m_solverCommand->setEldarica(m_queryTimeout, m_computeInvariants);
 
 	return CHCSmtLib2Interface::querySolver(_input);
 }
@@ -170,11 +170,20 @@ struct ModelCheckerSettings
 	ModelCheckerExtCalls externalCalls = {};
 	ModelCheckerInvariants invariants = ModelCheckerInvariants::Default();
 	bool printQuery = false;
+	/// Run the BMC solvers concurrently on each query and use the first answer instead of
+	/// waiting for all of them and checking that their answers agree.
+	bool raceSolvers = false;
 	bool showProvedSafe = false;
 	bool showUnproved = false;
 	bool showUnsupported = false;
+	/// Number of solver processes per solver configuration kept running between queries.
+	/// Zero starts a new solver process for each query.
+	unsigned solverProcesses = 0;
 	smtutil::SMTSolverChoice solvers = smtutil::SMTSolverChoice::Z3();
 	ModelCheckerTargets targets = ModelCheckerTargets::Default();
+	/// Number of threads used to solve the CHC verification targets of a contract
+	/// concurrently. Zero means one thread per CPU core.
+	unsigned threads = 1;
 	std::optional<unsigned> timeout; // in milliseconds
 
 	bool operator!=(ModelCheckerSettings const& _other) const noexcept { return !(*this == _other); }
@@ -188,11 +197,14 @@ struct ModelCheckerSettings
 			externalCalls.mode == _other.externalCalls.mode &&
 			invariants == _other.invariants &&
 			printQuery == _other.printQuery &&
+			raceSolvers == _other.raceSolvers &&
 			showProvedSafe == _other.showProvedSafe &&
 			showUnproved == _other.showUnproved &&
 			showUnsupported == _other.showUnsupported &&
+			solverProcesses == _other.solverProcesses &&
 			solvers == _other.solvers &&
 			targets == _other.targets &&
+			threads == _other.threads &&
 			timeout == _other.timeout;
 	}
 };
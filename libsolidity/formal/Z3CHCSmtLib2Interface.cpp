@@ -35,12 +35,13 @@ Z3CHCSmtLib2Interface::Z3CHCSmtLib2Interface(
 	bool _computeInvariants
 ): CHCSmtLib2Interface({}, std::move(_smtCallback), _queryTimeout), m_computeInvariants(_computeInvariants)
 {
+	m_solverCommand = frontend::UniversalCallback::useOwnSolverCommand(m_smtCallback);
 }
 
 void Z3CHCSmtLib2Interface::setupSmtCallback(bool _enablePreprocessing)
 {
-	if (auto* universalCallback = m_smtCallback.target<frontend::UniversalCallback>())
-		universalCallback->smtCommand().setZ3(m_queryTimeout, _enablePreprocessing, m_computeInvariants);
+	if (m_solverCommand)
+		m_solverCommand->setZ3(m_queryTimeout, _enablePreprocessing, m_computeInvariants);
 }
 
 CHCSolverInterface::QueryResult Z3CHCSmtLib2Interface::query(smtutil::Expression const& _block)
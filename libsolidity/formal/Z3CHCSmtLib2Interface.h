@@ -18,8 +18,12 @@
 
 #pragma once
 
+#include <libsolidity/interface/SMTSolverCommand.h>
+
 #include <libsmtutil/CHCSmtLib2Interface.h>
 
+#include <memory>
+
 namespace solidity::frontend::smt
 {
 
@@ -45,6 +49,8 @@ private:
 	);
 
 	bool m_computeInvariants;
+	/// Sibling of the solver command of the callback, configured and interrupted only by this interface.
+	std::unique_ptr<frontend::SMTSolverCommand> m_solverCommand;
 };
 
 }
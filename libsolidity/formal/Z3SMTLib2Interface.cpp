@@ -27,9 +27,16 @@ Z3SMTLib2Interface::Z3SMTLib2Interface(
 	std::optional<unsigned int> _queryTimeout
 ): SMTLib2Interface({}, std::move(_smtCallback), _queryTimeout)
 {
+	m_solverCommand = frontend::UniversalCallback::useOwnSolverCommand(m_smtCallback);
 }
 
 void Z3SMTLib2Interface::setupSmtCallback() {
-	if (auto* universalCallback = m_smtCallback.target<frontend::UniversalCallback>())
-		universalCallback->smtCommand().setZ3(m_queryTimeout, true, false);
+	if (m_solverCommand)
+		m_solverCommand->setZ3(m_queryTimeout, true, false);
+}
+
+void Z3SMTLib2Interface::interrupt()
+{
+	if (m_solverCommand)
+		m_solverCommand->interrupt();
 }
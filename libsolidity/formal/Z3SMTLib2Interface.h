@@ -18,8 +18,12 @@
 
 #pragma once
 
+#include <libsolidity/interface/SMTSolverCommand.h>
+
 #include <libsmtutil/SMTLib2Interface.h>
 
+#include <memory>
+
 namespace solidity::frontend::smt
 {
 
@@ -30,8 +34,13 @@ public:
 		frontend::ReadCallback::Callback _smtCallback = {},
 		std::optional<unsigned> _queryTimeout = {}
 	);
+
+	void interrupt() override;
 private:
 	void setupSmtCallback() override;
+
+	/// Sibling of the solver command of the callback, configured and interrupted only by this interface.
+	std::unique_ptr<frontend::SMTSolverCommand> m_solverCommand;
 };
 
 }
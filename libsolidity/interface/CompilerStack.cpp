@@ -84,6 +84,7 @@
 #include <libsolutil/JSON.h>
 #include <libsolutil/Algorithms.h>
 #include <libsolutil/FunctionSelector.h>
+#include <libsolutil/Parallel.h>
 
 #include <boost/algorithm/string/replace.hpp>
 
@@ -93,6 +94,7 @@
 
 #include <fmt/format.h>
 
+#include <exception>
 #include <utility>
 #include <map>
 #include <limits>
@@ -244,6 +246,18 @@ void CompilerStack::setEOFVersion(std::optional<uint8_t> _version)
 	m_eofVersion = _version;
 }
 
+void CompilerStack::setParallelism(size_t _jobs)
+{
+	solAssert(m_stackState < CompilationSuccessful, "Must set parallelism before compiling.");
+	m_parallelism = _jobs;
+}
+
+void CompilerStack::setPersistentOptimizerCache(std::shared_ptr<yul::PersistentObjectCache> _cache)
+{
+	solAssert(m_stackState < CompilationSuccessful, "Must set the optimizer cache before compiling.");
+	m_objectOptimizer->setPersistentCache(std::move(_cache));
+}
+
 void CompilerStack::setModelCheckerSettings(ModelCheckerSettings _settings)
 {
 	solAssert(m_stackState < ParsedAndImported, "Must set model checking settings before parsing.");
@@ -320,6 +334,7 @@ void CompilerStack::reset(bool _keepSettings)
 		m_viaIR = false;
 		m_evmVersion = langutil::EVMVersion();
 		m_eofVersion.reset();
+		m_parallelism = 1;
 		m_modelCheckerSettings = ModelCheckerSettings{};
 		m_selectedContracts.clear();
 		m_revertStrings = RevertStrings::Default;
@@ -658,6 +673,8 @@ bool CompilerStack::analyzeLegacy(bool _noErrorsSoFar)
 		if (m_modelCheckerSettings.engine.any())
 			m_modelCheckerSettings.solvers = ModelChecker::checkRequestedSolvers(m_modelCheckerSettings.solvers, m_errorReporter);
 
+		if (auto* universalCallback = m_readFile.target<UniversalCallback>())
+			universalCallback->smtCommand().setPersistentSolvers(m_modelCheckerSettings.solverProcesses);
 		ModelChecker modelChecker(m_errorReporter, *this, m_smtlib2Responses, m_modelCheckerSettings, m_readFile);
 		modelChecker.checkRequestedSourcesAndContracts(allSources);
 		for (Source const* source: m_sourceOrder)
@@ -753,17 +770,33 @@ bool CompilerStack::compile(State _stopAfter)
 	// Only compile contracts individually which have been requested.
 	std::map<ContractDefinition const*, std::shared_ptr<Compiler const>> otherCompilers;
 
-	for (Source const* source: m_sourceOrder)
-		for (ASTPointer<ASTNode> const& node: source->ast->nodes())
-			if (auto contract = dynamic_cast<ContractDefinition const*>(node.get()))
-				if (isRequestedContract(*contract))
-				{
-					PipelineConfig pipelineConfig = requestedPipelineConfig(*contract);
+	// When compiling via IR, the optimized IR of a contract depends only on its own unoptimized IR,
+	// which already includes the IR of all contracts it depends on. With parallelism enabled we
+	// therefore generate the IR of all contracts first and defer optimization and EVM code
+	// generation, which is where most of the time is spent, to a pool of threads.
+	bool const deferIROptimization = m_viaIR && m_parallelism != 1;
+	std::vector<std::pair<ContractDefinition const*, bool>> deferredContracts;
 
-					try
+	try
+	{
+		for (Source const* source: m_sourceOrder)
+			for (ASTPointer<ASTNode> const& node: source->ast->nodes())
+				if (auto contract = dynamic_cast<ContractDefinition const*>(node.get()))
+					if (isRequestedContract(*contract))
 					{
+						PipelineConfig pipelineConfig = requestedPipelineConfig(*contract);
+						bool const unoptimizedOnly = pipelineConfig.needIRCodegenOnly(m_viaIR);
+
 						if (pipelineConfig.needIR(m_viaIR))
-							generateIR(*contract, pipelineConfig.needIRCodegenOnly(m_viaIR));
+						{
+							if (deferIROptimization && !unoptimizedOnly)
+							{
+								generateIR(*contract, true /* _unoptimizedOnly */);
+								deferredContracts.emplace_back(contract, pipelineConfig.needBytecode());
+								continue;
+							}
+							generateIR(*contract, unoptimizedOnly);
+						}
 						if (pipelineConfig.needBytecode())
 						{
 							if (m_viaIR)
@@ -776,21 +809,24 @@ bool CompilerStack::compile(State _stopAfter)
 							}
 						}
 					}
-					catch (Error const& _error)
-					{
-						// Since codegen has no access to the error reporter, the only way for it to
-						// report an error is to throw. In most cases it uses dedicated exceptions,
-						// but CodeGenerationError is one case where someone decided to just throw Error.
-						solAssert(_error.type() == Error::Type::CodeGenerationError);
-						m_errorReporter.error(_error.errorId(), _error.type(), SourceLocation(), _error.what());
-						return false;
-					}
-					catch (UnimplementedFeatureError const& _error)
-					{
-						reportUnimplementedFeatureError(_error);
-						return false;
-					}
-				}
+
+		if (!deferredContracts.empty())
+			optimizeAndGenerateEVMFromIR(deferredContracts);
+	}
+	catch (Error const& _error)
+	{
+		// Since codegen has no access to the error reporter, the only way for it to
+		// report an error is to throw. In most cases it uses dedicated exceptions,
+		// but CodeGenerationError is one case where someone decided to just throw Error.
+		solAssert(_error.type() == Error::Type::CodeGenerationError);
+		m_errorReporter.error(_error.errorId(), _error.type(), SourceLocation(), _error.what());
+		return false;
+	}
+	catch (UnimplementedFeatureError const& _error)
+	{
+		reportUnimplementedFeatureError(_error);
+		return false;
+	}
 	m_stackState = CompilationSuccessful;
 	this->link();
 	return true;
@@ -1023,7 +1059,6 @@ evmasm::LinkerObject const& CompilerStack::runtimeObject(std::string const& _con
 	return contract(_contractName).runtimeObject;
 }
 
-/// TODO: cache this string
 std::string CompilerStack::assemblyString(std::string const& _contractName, StringMap const& _sourceCodes) const
 {
 	solAssert(m_stackState == CompilationSuccessful, "Compilation was not successful.");
@@ -1035,17 +1070,18 @@ std::string CompilerStack::assemblyString(std::string const& _contractName, Stri
 		return std::string();
 }
 
-/// TODO: cache the JSON
 Json CompilerStack::assemblyJSON(std::string const& _contractName) const
 {
 	solAssert(m_stackState == CompilationSuccessful, "Compilation was not successful.");
 	solUnimplementedAssert(!isExperimentalSolidity());
 
 	Contract const& currentContract = contract(_contractName);
-	if (currentContract.evmAssembly)
-		return currentContract.evmAssembly->assemblyJSON(sourceIndices());
-	else
-		return Json();
+	return currentContract.assemblyJSON.init([&]{
+		if (currentContract.evmAssembly)
+			return currentContract.evmAssembly->assemblyJSON(sourceIndices());
+		else
+			return Json();
+	});
 }
 
 std::vector<std::string> CompilerStack::sourceNames() const
@@ -1136,32 +1172,43 @@ Json const& CompilerStack::natspecDev(Contract const& _contract) const
 	return _contract.devDocumentation.init([&]{ return Natspec::devDocumentation(*_contract.contract); });
 }
 
+Json CompilerStack::methodIdentifiers(std::string const& _contractName) const
+{
+	solAssert(m_stackState >= AnalysisSuccessful, "Analysis was not successful.");
+	solUnimplementedAssert(!isExperimentalSolidity());
+
+	// Always return an object, even if there are no methods.
+	Json methods = Json::object();
+	for (auto const& it: contractDefinition(_contractName).interfaceFunctions())
+		methods[it.second->externalSignature()] = it.first.hex();
+	return methods;
+}
+
 Json CompilerStack::interfaceSymbols(std::string const& _contractName) const
 {
 	solAssert(m_stackState >= AnalysisSuccessful, "Analysis was not successful.");
 	solUnimplementedAssert(!isExperimentalSolidity());
 
 	Json interfaceSymbols;
-	// Always have a methods object
-	interfaceSymbols["methods"] = Json::object();
+	interfaceSymbols["methods"] = methodIdentifiers(_contractName);
 
-	for (auto const& it: contractDefinition(_contractName).interfaceFunctions())
-		interfaceSymbols["methods"][it.second->externalSignature()] = it.first.hex();
+	std::vector<std::string> errorSignatures;
 	for (ErrorDefinition const* error: contractDefinition(_contractName).interfaceErrors())
-	{
-		std::string signature = error->functionType(true)->externalSignature();
-		interfaceSymbols["errors"][signature] = util::toHex(toCompactBigEndian(util::selectorFromSignatureU32(signature), 4));
-	}
+		errorSignatures.emplace_back(error->functionType(true)->externalSignature());
+	std::vector<util::FixedHash<4>> errorSelectors = util::selectorsFromSignaturesH32(errorSignatures);
+	for (size_t i = 0; i < errorSignatures.size(); ++i)
+		interfaceSymbols["errors"][errorSignatures[i]] = errorSelectors[i].hex();
 
+	std::vector<std::string> eventSignatures;
 	for (EventDefinition const* event: ranges::concat_view(
 		contractDefinition(_contractName).definedInterfaceEvents(),
 		contractDefinition(_contractName).usedInterfaceEvents()
 	))
 		if (!event->isAnonymous())
-		{
-			std::string signature = event->functionType(true)->externalSignature();
-			interfaceSymbols["events"][signature] = toHex(u256(h256::Arith(util::keccak256(signature))));
-		}
+			eventSignatures.emplace_back(event->functionType(true)->externalSignature());
+	std::vector<h256> eventHashes = util::keccak256Batch(eventSignatures);
+	for (size_t i = 0; i < eventSignatures.size(); ++i)
+		interfaceSymbols["events"][eventSignatures[i]] = toHex(u256(h256::Arith(eventHashes[i])));
 
 	return interfaceSymbols;
 }
@@ -1195,6 +1242,14 @@ SourceUnit const& CompilerStack::ast(std::string const& _sourceName) const
 	return *source(_sourceName).ast;
 }
 
+std::shared_ptr<SourceUnit const> CompilerStack::sharedAST(std::string const& _sourceName) const
+{
+	solAssert(m_stackState >= Parsed, "Parsing not yet performed.");
+	solAssert(source(_sourceName).ast, "Parsing was not successful.");
+	solUnimplementedAssert(!isExperimentalSolidity());
+	return source(_sourceName).ast;
+}
+
 ContractDefinition const& CompilerStack::contractDefinition(std::string const& _contractName) const
 {
 	solAssert(m_stackState >= AnalysisSuccessful, "Analysis was not successful.");
@@ -1564,25 +1619,50 @@ void CompilerStack::generateIR(ContractDefinition const& _contract, bool _unopti
 		);
 	}
 
+	if (_unoptimizedOnly)
+		// Still parse and analyze the IR to make sure that it is valid.
+		loadGeneratedIR(compiledContract.yulIR);
+	else
+		optimizeIR(_contract);
+}
+
+void CompilerStack::optimizeIR(ContractDefinition const& _contract)
+{
+	solAssert(m_stackState >= AnalysisSuccessful, "");
+
+	if (!_contract.canBeDeployed())
+		return;
+
+	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
+	solAssert(!compiledContract.yulIR.empty(), "");
+	if (!compiledContract.yulIROptimized.empty())
+		return;
+
 	YulStack stack = loadGeneratedIR(compiledContract.yulIR);
-	if (!_unoptimizedOnly)
-	{
-		stack.optimize();
-		compiledContract.yulIROptimized = stack.print();
-	}
+	stack.optimize();
+	compiledContract.yulIROptimized = stack.print();
 }
 
 void CompilerStack::generateEVMFromIR(ContractDefinition const& _contract)
+{
+	if (!generateEVMAssemblyFromIR(_contract))
+		return;
+
+	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
+	assembleYul(_contract, compiledContract.evmAssembly, compiledContract.evmRuntimeAssembly);
+}
+
+bool CompilerStack::generateEVMAssemblyFromIR(ContractDefinition const& _contract)
 {
 	solAssert(m_stackState >= AnalysisSuccessful, "");
 
 	if (!_contract.canBeDeployed())
-		return;
+		return false;
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
 	solAssert(!compiledContract.yulIROptimized.empty(), "");
 	if (!compiledContract.object.bytecode.empty())
-		return;
+		return false;
 
 	// Re-parse the Yul IR in EVM dialect
 	YulStack stack = loadGeneratedIR(compiledContract.yulIROptimized);
@@ -1592,7 +1672,45 @@ void CompilerStack::generateEVMFromIR(ContractDefinition const& _contract)
 	std::string deployedName = IRNames::deployedObject(_contract);
 	solAssert(!deployedName.empty(), "");
 	tie(compiledContract.evmAssembly, compiledContract.evmRuntimeAssembly) = stack.assembleEVMWithDeployed(deployedName);
-	assembleYul(_contract, compiledContract.evmAssembly, compiledContract.evmRuntimeAssembly);
+	return true;
+}
+
+void CompilerStack::optimizeAndGenerateEVMFromIR(std::vector<std::pair<ContractDefinition const*, bool>> const& _contracts)
+{
+	solAssert(m_viaIR);
+
+	// Every task only touches the Contract entry of its own contract. Everything that reports
+	// diagnostics or depends on other contracts happens afterwards, in the original order.
+	std::vector<char> assemblyGenerated(_contracts.size(), false);
+	std::vector<char> finished(_contracts.size(), false);
+	std::exception_ptr failure;
+	try
+	{
+		util::parallelFor(_contracts.size(), m_parallelism, [&](size_t _index) {
+			auto const& [contract, needBytecode] = _contracts[_index];
+			optimizeIR(*contract);
+			if (needBytecode)
+				assemblyGenerated[_index] = generateEVMAssemblyFromIR(*contract);
+			finished[_index] = true;
+		});
+	}
+	catch (...)
+	{
+		// parallelFor guarantees that all tasks before the failed one have finished.
+		// Report their results first so that the outcome matches sequential compilation.
+		failure = std::current_exception();
+	}
+
+	for (size_t index = 0; index < _contracts.size() && finished[index]; ++index)
+		if (assemblyGenerated[index])
+		{
+			ContractDefinition const& contract = *_contracts[index].first;
+			Contract& compiledContract = m_contracts.at(contract.fullyQualifiedName());
+			assembleYul(contract, compiledContract.evmAssembly, compiledContract.evmRuntimeAssembly);
+		}
+
+	if (failure)
+		std::rethrow_exception(failure);
 }
 
 CompilerStack::Contract const& CompilerStack::contract(std::string const& _contractName) const
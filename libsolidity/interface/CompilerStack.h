@@ -50,6 +50,7 @@
 #include <libsolutil/JSON.h>
 
 #include <libyul/ObjectOptimizer.h>
+#include <libyul/YulString.h>
 
 #include <functional>
 #include <memory>
@@ -232,6 +233,17 @@ public:
 	/// If set to std::nullopt (the default), legacy non-EOF bytecode is generated.
 	void setEOFVersion(std::optional<uint8_t> version);
 
+	/// Sets the maximum number of threads used to optimize the IR of independent contracts and
+	/// to generate EVM code from it. Zero means one thread per available hardware thread.
+	/// Only affects compilation via IR. The produced output does not depend on this setting.
+	/// Must be set before compiling.
+	void setParallelism(size_t _jobs);
+
+	/// Makes the Yul optimizer reuse optimized objects stored in @a _cache, e.g. by earlier compiler
+	/// runs, and store newly optimized ones there. Only affects compilation via IR.
+	/// Must be set before compiling.
+	void setPersistentOptimizerCache(std::shared_ptr<yul::PersistentObjectCache> _cache);
+
 	/// Set model checker settings.
 	void setModelCheckerSettings(ModelCheckerSettings _settings);
 
@@ -303,6 +315,10 @@ public:
 	/// @returns the parsed source unit with the supplied name.
 	SourceUnit const& ast(std::string const& _sourceName) const;
 
+	/// @returns the parsed source unit with the supplied name, which outlives the compiler stack
+	/// for as long as the returned pointer is held.
+	std::shared_ptr<SourceUnit const> sharedAST(std::string const& _sourceName) const;
+
 	/// @returns the parsed contract with the supplied name. Throws an exception if the contract
 	/// does not exist.
 	ContractDefinition const& contractDefinition(std::string const& _contractName) const;
@@ -360,11 +376,11 @@ public:
 
 	/// @return a verbose text representation of the assembly.
 	/// @arg _sourceCodes is the map of input files to source code strings
+	/// The text is not cached since it depends on @a _sourceCodes.
 	/// Prerequisite: Successful compilation.
 	virtual std::string assemblyString(std::string const& _contractName, StringMap const& _sourceCodes = StringMap()) const override;
 
-	/// @returns a JSON representation of the assembly.
-	/// @arg _sourceCodes is the map of input files to source code strings
+	/// @returns a JSON representation of the assembly. Computed on first request and cached.
 	/// Prerequisite: Successful compilation.
 	virtual Json assemblyJSON(std::string const& _contractName) const override;
 
@@ -391,6 +407,9 @@ public:
 	/// @returns a JSON object with the three members ``methods``, ``events``, ``errors``. Each is a map, mapping identifiers (hashes) to function names.
 	Json interfaceSymbols(std::string const& _contractName) const;
 
+	/// @returns the ``methods`` member of @a interfaceSymbols without hashing errors and events.
+	Json methodIdentifiers(std::string const& _contractName) const;
+
 	/// @returns the Contract Metadata matching the pipeline selected using the viaIR setting.
 	std::string const& metadata(std::string const& _contractName) const { return metadata(contract(_contractName)); }
 
@@ -453,6 +472,7 @@ private:
 		util::LazyInit<Json const> transientStorageLayout;
 		util::LazyInit<Json const> userDocumentation;
 		util::LazyInit<Json const> devDocumentation;
+		util::LazyInit<Json const> assemblyJSON;
 		mutable std::optional<std::string const> sourceMapping;
 		mutable std::optional<std::string const> runtimeSourceMapping;
 	};
@@ -518,10 +538,28 @@ private:
 	///     optimized IR, its AST or compilation via IR must not be requested.
 	void generateIR(ContractDefinition const& _contract, bool _unoptimizedOnly);
 
-	/// Generate EVM representation for a single contract.
+	/// Runs the unoptimized IR of a single contract through YulStack and stores the result as
+	/// optimized IR. Does not modify any state shared with other contracts and is therefore safe
+	/// to call for different contracts concurrently.
 	/// Depends on output generated by generateIR.
+	void optimizeIR(ContractDefinition const& _contract);
+
+	/// Generate EVM representation for a single contract.
+	/// Depends on output generated by optimizeIR.
 	void generateEVMFromIR(ContractDefinition const& _contract);
 
+	/// Generates the EVM assembly of a single contract without assembling it into bytecode.
+	/// Like optimizeIR, safe to call for different contracts concurrently.
+	/// @returns false if there was nothing to generate, i.e. the contract cannot be deployed
+	/// or its bytecode is already available.
+	bool generateEVMAssemblyFromIR(ContractDefinition const& _contract);
+
+	/// Performs optimizeIR and, if the second element of the pair is true, generateEVMFromIR
+	/// for each of the given contracts, using up to @a m_parallelism threads.
+	/// Bytecode is assembled and diagnostics are reported in the order of @a _contracts,
+	/// exactly as if the contracts were processed one after another.
+	void optimizeAndGenerateEVMFromIR(std::vector<std::pair<ContractDefinition const*, bool>> const& _contracts);
+
 	/// Links all the known library addresses in the available objects. Any unknown
 	/// library will still be kept as an unlinked placeholder in the objects.
 	void link();
@@ -580,6 +618,10 @@ private:
 
 	void reportUnimplementedFeatureError(langutil::UnimplementedFeatureError const& _error);
 
+	/// Keeps the strings of the Yul code generated by this stack alive while other compilations
+	/// in the same process finish and reset the YulStringRepository.
+	/// Declared first, so that it is released last.
+	yul::YulStringRepository::CompilationScope m_yulStringScope;
 	ReadCallback::Callback m_readFile;
 	OptimiserSettings m_optimiserSettings;
 	RevertStrings m_revertStrings = RevertStrings::Default;
@@ -587,6 +629,7 @@ private:
 	bool m_viaIR = false;
 	langutil::EVMVersion m_evmVersion;
 	std::optional<uint8_t> m_eofVersion;
+	size_t m_parallelism = 1;
 	ModelCheckerSettings m_modelCheckerSettings;
 	ContractSelection m_selectedContracts;
 	std::map<std::string, util::h160> m_libraries;
@@ -0,0 +1,77 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolidity/interface/SMTQueryCache.h>
+
+#include <libsolutil/Keccak256.h>
+
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::frontend;
+
+SMTQueryCache::SMTQueryCache(boost::filesystem::path _directory):
+	// Keys already identify the solver, so the entries do not depend on the compiler version.
+	m_files(std::move(_directory), "smt-query-cache 1", ".response")
+{
+}
+
+h256 SMTQueryCache::key(std::string const& _solverConfiguration, std::string const& _query)
+{
+	// The configuration never contains a newline, so it cannot run into the query.
+	return keccak256(_solverConfiguration + '\n' + normalize(_query));
+}
+
+std::string SMTQueryCache::normalize(std::string const& _query)
+{
+	std::string normalized;
+	normalized.reserve(_query.size());
+	bool pendingSpace = false;
+	auto emit = [&](char _c) {
+		// Whitespace only matters between two tokens, not next to parentheses.
+		if (pendingSpace && !normalized.empty() && normalized.back() != '(' && _c != ')')
+			normalized += ' ';
+		pendingSpace = false;
+		normalized += _c;
+	};
+
+	for (size_t i = 0; i < _query.size(); ++i)
+	{
+		char const c = _query[i];
+		if (c == ';')
+		{
+			while (i + 1 < _query.size() && _query[i + 1] != '\n')
+				++i;
+			pendingSpace = true;
+		}
+		else if (c == ' ' || c == '\t' || c == '\n' || c == '\r')
+			pendingSpace = true;
+		else if (c == '"' || c == '|')
+		{
+			// String literals and quoted symbols are copied verbatim. Within a string literal
+			// a quote is escaped by doubling it, which simply reads as two adjacent literals here.
+			emit(c);
+			for (++i; i < _query.size() && _query[i] != c; ++i)
+				normalized += _query[i];
+			if (i < _query.size())
+				normalized += c;
+		}
+		else
+			emit(c);
+	}
+	return normalized;
+}
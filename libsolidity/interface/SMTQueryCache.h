@@ -0,0 +1,63 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+#pragma once
+
+#include <libsolutil/FileCache.h>
+
+#include <boost/filesystem.hpp>
+
+#include <optional>
+#include <string>
+
+namespace solidity::frontend
+{
+
+/// On-disk store for the responses of SMT solvers, shared by compiler processes that use the same
+/// directory. Entries are addressed by @a key(), i.e. by the query and the exact solver configuration
+/// that answered it, so they stay valid across compiler versions.
+/// See @a util::FileCache for the guarantees about concurrent use and I/O errors.
+class SMTQueryCache
+{
+public:
+	using Statistics = util::FileCache::Statistics;
+
+	/// Creates @a _directory if it does not exist yet.
+	/// @throws boost::filesystem::filesystem_error if the directory cannot be created.
+	explicit SMTQueryCache(boost::filesystem::path _directory);
+
+	/// @returns the key of @a _query sent to the solver described by @a _solverConfiguration,
+	/// which has to identify the solver binary, its version and all its options.
+	/// Comments and the amount of whitespace in the query do not affect the key.
+	static util::h256 key(std::string const& _solverConfiguration, std::string const& _query);
+	/// @returns the SMT-LIB2 query @a _query without comments and with every sequence of whitespace
+	/// outside of string literals and quoted symbols replaced by a single space.
+	static std::string normalize(std::string const& _query);
+
+	/// @returns the response stored under @a _key or nullopt if there is no valid entry.
+	std::optional<std::string> load(util::h256 const& _key) { return m_files.load(_key); }
+	/// Stores @a _response under @a _key, replacing any existing entry.
+	void store(util::h256 const& _key, std::string const& _response) { m_files.store(_key, _response); }
+
+	Statistics statistics() const { return m_files.statistics(); }
+	boost::filesystem::path const& directory() const { return m_files.directory(); }
+
+private:
+	util::FileCache m_files;
+};
+
+}
@@ -19,16 +19,131 @@
 
 #include <liblangutil/Exceptions.h>
 
+#include <libsolutil/Common.h>
+#include <libsolutil/CommonData.h>
+
 #include <boost/algorithm/string/join.hpp>
 #include <boost/process.hpp>
 
+#include <condition_variable>
+#include <thread>
+
+#if !defined(_WIN32)
+#include <csignal>
+#include <ctime>
+#include <pthread.h>
+#endif
+
 namespace solidity::frontend
 {
 
+namespace
+{
+
+/// Printed by persistent solver processes after the response to each query.
+std::string const endOfResponseMarker = "solc-end-of-response";
+
+/// How much longer than the query timeout a persistent solver process may take
+/// to answer before it is considered stuck and killed.
+std::chrono::milliseconds const persistentSolverGracePeriod{1000};
+
+/// Writes @a _data to the input of a solver process, which may have exited already.
+/// The SIGPIPE raised by writing to an exited process is discarded instead of terminating the compiler.
+/// @returns false if not all of the data could be written.
+bool writeToSolver(std::ostream& _input, std::string const& _data)
+{
+#if !defined(_WIN32)
+	sigset_t sigpipeMask;
+	sigemptyset(&sigpipeMask);
+	sigaddset(&sigpipeMask, SIGPIPE);
+	sigset_t previousMask;
+	pthread_sigmask(SIG_BLOCK, &sigpipeMask, &previousMask);
+
+	// Do not discard a SIGPIPE that was already pending before the write.
+	sigset_t pendingSignals;
+	sigpending(&pendingSignals);
+	bool const sigpipeWasPending = sigismember(&pendingSignals, SIGPIPE) == 1;
+
+	_input << _data << std::flush;
+	bool const written = _input.good();
+
+	if (!written && !sigpipeWasPending)
+	{
+		timespec const noWait{0, 0};
+		sigtimedwait(&sigpipeMask, nullptr, &noWait);
+	}
+	pthread_sigmask(SIG_SETMASK, &previousMask, nullptr);
+	return written;
+#else
+	_input << _data << std::flush;
+	return _input.good();
+#endif
+}
+
+}
+
+struct SMTSolverCommand::SolverProcess
+{
+	SolverProcess(boost::filesystem::path const& _solverBin, std::vector<std::string> const& _arguments):
+		process(
+			_solverBin,
+			_arguments,
+			boost::process::std_out > output,
+			boost::process::std_in < input,
+			boost::process::std_err > boost::process::null
+		)
+	{}
+	~SolverProcess()
+	{
+		std::error_code errorCode;
+		process.terminate(errorCode);
+		// Closing the pipe discards the rest of a query the process did not read, which the
+		// stream would otherwise try to write to the dead process on destruction.
+		input.pipe().close();
+	}
+
+	boost::process::opstream input;  ///< input to the solver written to by the main process
+	boost::process::ipstream output; ///< output from the solver read by the main process
+	boost::process::child process;
+};
+
+struct SMTSolverCommand::SharedState
+{
+	/// Guards all the members below.
+	std::mutex mutex;
+	size_t persistentSolvers = 0;
+	/// Idle persistent solver processes, by the solver binary followed by its arguments.
+	std::map<std::vector<std::string>, std::vector<std::unique_ptr<SolverProcess>>> idleSolvers;
+	std::shared_ptr<SMTQueryCache> queryCache;
+	/// Results of solverVersion(), by the path of the solver binary.
+	std::map<std::string, std::string> solverVersions;
+};
+
+SMTSolverCommand::SMTSolverCommand():
+	SMTSolverCommand(std::make_shared<SharedState>())
+{
+}
+
+SMTSolverCommand::SMTSolverCommand(std::shared_ptr<SharedState> _shared):
+	m_shared(std::move(_shared))
+{
+}
+
+SMTSolverCommand::~SMTSolverCommand() = default;
+
+std::unique_ptr<SMTSolverCommand> SMTSolverCommand::sibling() const
+{
+	return std::unique_ptr<SMTSolverCommand>(new SMTSolverCommand(m_shared));
+}
+
 void SMTSolverCommand::setEldarica(std::optional<unsigned int> timeoutInMilliseconds, bool computeInvariants)
 {
+	std::lock_guard<std::mutex> lock(m_mutex);
 	m_arguments.clear();
 	m_solverCmd = "eld";
+	// Eldarica solves a single problem read until the end of its input.
+	m_interactiveSolver = false;
+	m_queryTimeout = timeoutInMilliseconds;
 	m_arguments.emplace_back("-hsmt"); // Tell Eldarica to expect input in SMT2 format
 	m_arguments.emplace_back("-in"); // Tell Eldarica to read from standard input
 	if (timeoutInMilliseconds)
@@ -43,8 +158,11 @@ void SMTSolverCommand::setEldarica(std::optional<unsigned int> timeoutInMillisec
 
 void SMTSolverCommand::setCvc5(std::optional<unsigned int> timeoutInMilliseconds)
 {
+	std::lock_guard<std::mutex> lock(m_mutex);
 	m_arguments.clear();
 	m_solverCmd = "cvc5";
+	m_interactiveSolver = true;
+	m_queryTimeout = timeoutInMilliseconds;
 	if (timeoutInMilliseconds)
 	{
 		m_arguments.emplace_back("--tlimit-per");
@@ -60,8 +178,11 @@ void SMTSolverCommand::setCvc5(std::optional<unsigned int> timeoutInMilliseconds
 void SMTSolverCommand::setZ3(std::optional<unsigned int> timeoutInMilliseconds, bool _preprocessing, bool _computeInvariants)
 {
 	constexpr int Z3ResourceLimit = 2000000;
+	std::lock_guard<std::mutex> lock(m_mutex);
 	m_arguments.clear();
 	m_solverCmd = "z3";
+	m_interactiveSolver = true;
+	m_queryTimeout = timeoutInMilliseconds;
 	m_arguments.emplace_back("-in"); // Read from standard input
 	m_arguments.emplace_back("-smt2"); // Expect input in SMT-LIB2 format
 	if (_computeInvariants)
@@ -86,6 +207,80 @@ void SMTSolverCommand::setZ3(std::optional<unsigned int> timeoutInMilliseconds,
 	m_arguments.emplace_back("fp.xform.inline_eager=" + preprocessingArg);
 }
 
+void SMTSolverCommand::interrupt() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	++m_interruptions;
+	for (auto const& [solverID, terminate]: m_runningSolverTerminators)
+		terminate();
+}
+
+void SMTSolverCommand::setPersistentSolvers(size_t _processes)
+{
+	std::vector<std::unique_ptr<SolverProcess>> surplusSolvers;
+	{
+		std::lock_guard<std::mutex> lock(m_shared->mutex);
+		m_shared->persistentSolvers = _processes;
+		for (auto& [configuration, solvers]: m_shared->idleSolvers)
+			while (solvers.size() > m_shared->persistentSolvers)
+			{
+				surplusSolvers.push_back(std::move(solvers.back()));
+				solvers.pop_back();
+			}
+	}
+	// The surplus processes are terminated here, without holding the lock.
+}
+
+void SMTSolverCommand::setQueryCache(std::shared_ptr<SMTQueryCache> _cache)
+{
+	std::lock_guard<std::mutex> lock(m_shared->mutex);
+	m_shared->queryCache = std::move(_cache);
+}
+
+std::string SMTSolverCommand::solverVersion(boost::filesystem::path const& _solverBin) const
+{
+	{
+		std::lock_guard<std::mutex> lock(m_shared->mutex);
+		if (auto it = m_shared->solverVersions.find(_solverBin.string()); it != m_shared->solverVersions.end())
+			return it->second;
+	}
+
+	// The size and modification time of the binary detect upgrades of solvers that do not
+	// print their version, as long as the binary itself is replaced.
+	boost::system::error_code errorCode;
+	auto const size = boost::filesystem::file_size(_solverBin, errorCode);
+	auto const lastWriteTime = errorCode ? 0 : boost::filesystem::last_write_time(_solverBin, errorCode);
+	std::string version = _solverBin.string();
+	if (!errorCode)
+		version += " " + std::to_string(size) + " " + std::to_string(lastWriteTime);
+
+	std::vector<std::string> versionOutput;
+	try
+	{
+		boost::process::ipstream out;
+		boost::process::child versionProcess(
+			_solverBin,
+			"--version",
+			boost::process::std_out > out,
+			boost::process::std_in < boost::process::null,
+			boost::process::std_err > boost::process::null
+		);
+		std::string line;
+		while (std::getline(out, line))
+			versionOutput.push_back(line);
+		versionProcess.wait();
+	}
+	catch (boost::process::process_error const&)
+	{
+	}
+	if (!versionOutput.empty())
+		version += " " + boost::join(versionOutput, " ");
+
+	// Keep the first result if another thread was faster, so that all keys of one run agree.
+	std::lock_guard<std::mutex> lock(m_shared->mutex);
+	return m_shared->solverVersions.emplace(_solverBin.string(), std::move(version)).first->second;
+}
+
 ReadCallback::Result SMTSolverCommand::solve(std::string const& _kind, std::string const& _query) const
 {
 	try
@@ -93,44 +288,233 @@ ReadCallback::Result SMTSolverCommand::solve(std::string const& _kind, std::stri
 		if (_kind != ReadCallback::kindString(ReadCallback::Kind::SMTQuery))
 			solAssert(false, "SMTQuery callback used as callback kind " + _kind);
 
-		if (m_solverCmd.empty())
+		std::string solverCmd;
+		std::vector<std::string> args;
+		bool persistent = false;
+		std::optional<unsigned int> queryTimeout;
+		std::shared_ptr<SMTQueryCache> queryCache;
+		size_t interruptions = 0;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			solverCmd = m_solverCmd;
+			args = m_arguments;
+			persistent = m_interactiveSolver;
+			queryTimeout = m_queryTimeout;
+			interruptions = m_interruptions;
+		}
+		{
+			std::lock_guard<std::mutex> lock(m_shared->mutex);
+			persistent = persistent && m_shared->persistentSolvers > 0;
+			queryCache = m_shared->queryCache;
+		}
+
+		if (solverCmd.empty())
 			return ReadCallback::Result{false, "No solver set."};
 
-		auto solverBin = boost::process::search_path(m_solverCmd);
+		auto solverBin = boost::process::search_path(solverCmd);
 
 		if (solverBin.empty())
-			return ReadCallback::Result{false, m_solverCmd + " binary not found."};
+			return ReadCallback::Result{false, solverCmd + " binary not found."};
 
-		auto args = m_arguments;
+		std::optional<util::h256> cacheKey;
+		if (queryCache)
+		{
+			// Persistent processes answer exactly like new ones, so they share the cache entries.
+			cacheKey = SMTQueryCache::key(solverVersion(solverBin) + " " + boost::join(args, " "), _query);
+			if (std::optional<std::string> response = queryCache->load(*cacheKey))
+				return ReadCallback::Result{true, std::move(*response)};
+		}
 
-		boost::process::opstream in;  // input to subprocess written to by the main process
-		boost::process::ipstream out; // output from subprocess read by the main process
-		boost::process::child solverProcess(
-			solverBin,
-			args,
-			boost::process::std_out > out,
-			boost::process::std_in < in,
-			boost::process::std_err > boost::process::null
-		);
+		ReadCallback::Result result;
+		if (!persistent)
+			result = solveInNewProcess(solverBin, args, _query);
+		else
+		{
+			std::optional<std::chrono::milliseconds> deadline;
+			if (queryTimeout)
+				deadline = std::chrono::milliseconds(*queryTimeout) + persistentSolverGracePeriod;
+			result = solveInPersistentProcess(solverBin, args, deadline, _query);
+		}
+
+		if (cacheKey && result.success && !result.responseOrErrorMessage.empty())
+		{
+			bool interrupted = false;
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				interrupted = m_interruptions != interruptions;
+			}
+			std::string const& response = result.responseOrErrorMessage;
+			bool const decided = response.rfind("sat", 0) == 0 || response.rfind("unsat", 0) == 0;
+			if (!interrupted && (decided || !queryTimeout))
+				queryCache->store(*cacheKey, response);
+		}
+		return result;
+	}
+	catch (...)
+	{
+		return ReadCallback::Result{false, "Exception in SMTQuery callback: " + boost::current_exception_diagnostic_information()};
+	}
+}
+
+ReadCallback::Result SMTSolverCommand::solveInNewProcess(
+	boost::filesystem::path const& _solverBin,
+	std::vector<std::string> const& _arguments,
+	std::string const& _query
+) const
+{
+	boost::process::opstream in;  // input to subprocess written to by the main process
+	boost::process::ipstream out; // output from subprocess read by the main process
+	boost::process::child solverProcess(
+		_solverBin,
+		_arguments,
+		boost::process::std_out > out,
+		boost::process::std_in < in,
+		boost::process::std_err > boost::process::null
+	);
+
+	// If the solver exits before reading the whole query, its output is still collected below.
+	writeToSolver(in, _query);
+	in.pipe().close();
+	in.close();
+
+	// Only allow interrupting the solver once it has the whole query.
+	bool interrupted = false;
+	size_t solverID = 0;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		solverID = m_nextSolverID++;
+		m_runningSolverTerminators[solverID] = [&]() {
+			interrupted = true;
+			std::error_code errorCode;
+			solverProcess.terminate(errorCode);
+		};
+	}
 
-		in << _query << std::flush;
-		in.pipe().close();
-		in.close();
+	std::vector<std::string> data;
+	{
+		ScopeGuard unregisterSolver([&]() {
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_runningSolverTerminators.erase(solverID);
+		});
 
-		std::vector<std::string> data;
 		std::string line;
 		while (!(out.fail() || out.eof()) && std::getline(out, line))
 			if (!line.empty())
 				data.push_back(line);
+	}
 
-		solverProcess.wait();
+	solverProcess.wait();
 
-		return ReadCallback::Result{true, boost::join(data, "\n")};
+	if (interrupted)
+		return ReadCallback::Result{true, "unknown"};
+	return ReadCallback::Result{true, boost::join(data, "\n")};
+}
+
+ReadCallback::Result SMTSolverCommand::solveInPersistentProcess(
+	boost::filesystem::path const& _solverBin,
+	std::vector<std::string> const& _arguments,
+	std::optional<std::chrono::milliseconds> _deadline,
+	std::string const& _query
+) const
+{
+	std::vector<std::string> configuration{_solverBin.string()};
+	configuration += _arguments;
+
+	std::unique_ptr<SolverProcess> solver;
+	{
+		std::lock_guard<std::mutex> lock(m_shared->mutex);
+		auto& idleSolvers = m_shared->idleSolvers[configuration];
+		while (!solver && !idleSolvers.empty())
+		{
+			solver = std::move(idleSolvers.back());
+			idleSolvers.pop_back();
+			// Skip processes that died while idle. They cannot answer the query.
+			std::error_code errorCode;
+			if (!solver->process.running(errorCode))
+				solver.reset();
+		}
 	}
-	catch (...)
+	if (!solver)
+		solver = std::make_unique<SolverProcess>(_solverBin, _arguments);
+
+	// Each query is a complete SMT-LIB2 script, so it has to start from a fresh solver state.
+	// The echo command marks the end of the response since the process keeps running.
+	// A process that exits before reading the whole query does not print the marker and is not reused.
+	writeToSolver(solver->input, "(reset)\n" + _query + "\n(echo \"" + endOfResponseMarker + "\")\n");
+
+	bool interrupted = false;
+	bool timedOut = false;
+	size_t solverID = 0;
 	{
-		return ReadCallback::Result{false, "Exception in SMTQuery callback: " + boost::current_exception_diagnostic_information()};
+		std::lock_guard<std::mutex> lock(m_mutex);
+		solverID = m_nextSolverID++;
+		m_runningSolverTerminators[solverID] = [&]() {
+			interrupted = true;
+			std::error_code errorCode;
+			solver->process.terminate(errorCode);
+		};
+	}
+
+	std::mutex watchdogMutex;
+	std::condition_variable responseReceived;
+	bool responded = false;
+	std::thread watchdog;
+	if (_deadline)
+		watchdog = std::thread([&, deadline = *_deadline]() {
+			{
+				std::unique_lock<std::mutex> watchdogLock(watchdogMutex);
+				if (responseReceived.wait_for(watchdogLock, deadline, [&]() { return responded; }))
+					return;
+			}
+			// Terminate under the same lock as interrupt() so that the process is never terminated concurrently.
+			std::lock_guard<std::mutex> lock(m_mutex);
+			timedOut = true;
+			std::error_code errorCode;
+			solver->process.terminate(errorCode);
+		});
+
+	std::vector<std::string> data;
+	bool complete = false;
+	{
+		ScopeGuard stopWatching([&]() {
+			{
+				std::lock_guard<std::mutex> watchdogLock(watchdogMutex);
+				responded = true;
+			}
+			responseReceived.notify_one();
+			if (watchdog.joinable())
+				watchdog.join();
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_runningSolverTerminators.erase(solverID);
+		});
+
+		std::string line;
+		while (std::getline(solver->output, line))
+		{
+			// cvc5 prints the string literal including the quotes, z3 only its contents.
+			if (line == endOfResponseMarker || line == "\"" + endOfResponseMarker + "\"")
+			{
+				complete = true;
+				break;
+			}
+			if (!line.empty())
+				data.push_back(line);
+		}
+	}
+
+	if (interrupted || timedOut)
+		return ReadCallback::Result{true, "unknown"};
+
+	// A process that did not print the marker has exited and is not reused.
+	if (complete)
+	{
+		std::lock_guard<std::mutex> lock(m_shared->mutex);
+		auto& idleSolvers = m_shared->idleSolvers[configuration];
+		if (idleSolvers.size() < m_shared->persistentSolvers)
+			idleSolvers.push_back(std::move(solver));
 	}
+	return ReadCallback::Result{true, boost::join(data, "\n")};
 }
 
 }
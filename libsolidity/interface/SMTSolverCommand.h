@@ -18,9 +18,18 @@
 #pragma once
 
 #include <libsolidity/interface/ReadFile.h>
+#include <libsolidity/interface/SMTQueryCache.h>
 
 #include <boost/filesystem.hpp>
 
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
 namespace solidity::frontend
 {
 
@@ -28,7 +37,17 @@ namespace solidity::frontend
 class SMTSolverCommand
 {
 public:
+	SMTSolverCommand();
+	~SMTSolverCommand();
+
+	/// @returns a new command sharing the persistent solver processes, the query cache and the
+	/// solver versions with this one, but with its own solver configuration and running processes.
+	/// Solver interfaces that may query concurrently each use their own sibling, so that
+	/// configuring or interrupting one of them does not affect the queries of the others.
+	std::unique_ptr<SMTSolverCommand> sibling() const;
+
 	/// Calls an SMT solver with the given query.
+	/// Can be called concurrently from multiple threads.
 	frontend::ReadCallback::Result solve(std::string const& _kind, std::string const& _query) const;
 
 	frontend::ReadCallback::Callback solver() const
@@ -40,10 +59,64 @@ public:
 	void setCvc5(std::optional<unsigned int> timeoutInMilliseconds);
 	void setZ3(std::optional<unsigned int> timeoutInMilliseconds, bool _preprocessing, bool _computeInvariants);
 
+	/// Keeps up to @a _processes solver processes per solver configuration alive between queries
+	/// and sends the queries to them in interactive mode instead of starting a new process for
+	/// each query. Only used for solvers supporting interactive mode (z3 and cvc5).
+	/// Zero, the default, disables reusing processes. Applies to all siblings.
+	void setPersistentSolvers(size_t _processes);
+
+	/// Looks up the response to each query in @a _cache before calling the solver and stores
+	/// the responses of the solver there. Responses that depend on the timing, i.e. answers
+	/// other than sat and unsat under a timeout and answers to interrupted queries, are not stored.
+	/// A null pointer disables the cache. Applies to all siblings.
+	void setQueryCache(std::shared_ptr<SMTQueryCache> _cache);
+
+	/// Terminates all solver processes currently running on behalf of solve() of this command,
+	/// but not of its siblings. The interrupted queries are answered with "unknown".
+	/// Can be called from any thread.
+	void interrupt() const;
+
 private:
+	/// A solver process running in interactive mode together with the pipes connected to it.
+	struct SolverProcess;
+	/// State shared between siblings.
+	struct SharedState;
+
+	explicit SMTSolverCommand(std::shared_ptr<SharedState> _shared);
+
+	/// @returns a description of the solver binary and its version, used as part of the cache keys.
+	std::string solverVersion(boost::filesystem::path const& _solverBin) const;
+
+	frontend::ReadCallback::Result solveInNewProcess(
+		boost::filesystem::path const& _solverBin,
+		std::vector<std::string> const& _arguments,
+		std::string const& _query
+	) const;
+	/// Sends the query to an idle persistent solver process, starting a new one if there is none.
+	/// The process is killed if it does not answer within @a _deadline and a new one is started
+	/// for the next query.
+	frontend::ReadCallback::Result solveInPersistentProcess(
+		boost::filesystem::path const& _solverBin,
+		std::vector<std::string> const& _arguments,
+		std::optional<std::chrono::milliseconds> _deadline,
+		std::string const& _query
+	) const;
+
+	std::shared_ptr<SharedState> const m_shared;
+	/// Guards all the members below.
+	mutable std::mutex m_mutex;
 	/// The name of the solver's binary.
 	std::string m_solverCmd;
 	std::vector<std::string> m_arguments;
+	/// Whether the current solver can answer multiple queries in one process.
+	bool m_interactiveSolver = false;
+	/// Timeout of the current solver for a single query.
+	std::optional<unsigned int> m_queryTimeout;
+	/// Functions terminating the running solver processes, by a unique ID of each process.
+	mutable std::map<size_t, std::function<void()>> m_runningSolverTerminators;
+	mutable size_t m_nextSolverID = 0;
+	/// Number of calls to interrupt() so far.
+	mutable size_t m_interruptions = 0;
 };
 
 }
@@ -374,33 +374,6 @@ Json formatImmutableReferences(std::map<u256, evmasm::LinkerObject::ImmutableRef
 	return ret;
 }
 
-Json collectEVMObject(
-	langutil::EVMVersion _evmVersion,
-	evmasm::LinkerObject const& _object,
-	std::string const* _sourceMap,
-	Json _generatedSources,
-	bool _runtimeObject,
-	std::function<bool(std::string)> const& _artifactRequested
-)
-{
-	Json output;
-	if (_artifactRequested("object"))
-		output["object"] = _object.toHex();
-	if (_artifactRequested("opcodes"))
-		output["opcodes"] = evmasm::disassemble(_object.bytecode, _evmVersion);
-	if (_artifactRequested("sourceMap"))
-		output["sourceMap"] = _sourceMap ? *_sourceMap : "";
-	if (_artifactRequested("functionDebugData"))
-		output["functionDebugData"] = StandardCompiler::formatFunctionDebugData(_object.functionDebugData);
-	if (_artifactRequested("linkReferences"))
-		output["linkReferences"] = formatLinkReferences(_object.linkReferences);
-	if (_runtimeObject && _artifactRequested("immutableReferences"))
-		output["immutableReferences"] = formatImmutableReferences(_object.immutableReferences);
-	if (_artifactRequested("generatedSources"))
-		output["generatedSources"] = std::move(_generatedSources);
-	return output;
-}
-
 std::optional<Json> checkKeys(Json const& _input, std::set<std::string> const& _keys, std::string const& _name)
 {
 	if (!_input.empty() && !_input.is_object())
@@ -433,13 +406,13 @@ std::optional<Json> checkAuxiliaryInputKeys(Json const& _input)
 
 std::optional<Json> checkSettingsKeys(Json const& _input)
 {
-	static std::set<std::string> keys{"debug", "evmVersion", "eofVersion", "libraries", "metadata", "modelChecker", "optimizer", "outputSelection", "remappings", "stopAfter", "viaIR"};
+	static std::set<std::string> keys{"debug", "evmVersion", "eofVersion", "libraries", "metadata", "modelChecker", "optimizer", "outputSelection", "parallelism", "remappings", "stopAfter", "viaIR"};
 	return checkKeys(_input, keys, "settings");
 }
 
 std::optional<Json> checkModelCheckerSettingsKeys(Json const& _input)
 {
-	static std::set<std::string> keys{"bmcLoopIterations", "contracts", "divModNoSlacks", "engine", "extCalls", "invariants", "printQuery", "showProvedSafe", "showUnproved", "showUnsupported", "solvers", "targets", "timeout"};
+	static std::set<std::string> keys{"bmcLoopIterations", "contracts", "divModNoSlacks", "engine", "extCalls", "invariants", "printQuery", "raceSolvers", "showProvedSafe", "showUnproved", "showUnsupported", "solverProcesses", "solvers", "targets", "threads", "timeout"};
 	return checkKeys(_input, keys, "modelChecker");
 }
 
@@ -824,6 +797,13 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 		ret.viaIR = settings["viaIR"].get<bool>();
 	}
 
+	if (settings.contains("parallelism"))
+	{
+		if (!settings["parallelism"].is_number_unsigned())
+			return formatFatalError(Error::Type::JSONError, "\"settings.parallelism\" must be an unsigned integer.");
+		ret.parallelism = settings["parallelism"].get<size_t>();
+	}
+
 	if (settings.contains("evmVersion"))
 	{
 		if (!settings["evmVersion"].is_string())
@@ -1097,6 +1077,14 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 		ret.modelCheckerSettings.invariants = invariants;
 	}
 
+	if (modelCheckerSettings.contains("raceSolvers"))
+	{
+		auto const& raceSolvers = modelCheckerSettings["raceSolvers"];
+		if (!raceSolvers.is_boolean())
+			return formatFatalError(Error::Type::JSONError, "settings.modelChecker.raceSolvers must be a Boolean value.");
+		ret.modelCheckerSettings.raceSolvers = raceSolvers.get<bool>();
+	}
+
 	if (modelCheckerSettings.contains("showProvedSafe"))
 	{
 		auto const& showProvedSafe = modelCheckerSettings["showProvedSafe"];
@@ -1121,6 +1109,13 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 		ret.modelCheckerSettings.showUnsupported = showUnsupported.get<bool>();
 	}
 
+	if (modelCheckerSettings.contains("solverProcesses"))
+	{
+		if (!modelCheckerSettings["solverProcesses"].is_number_unsigned())
+			return formatFatalError(Error::Type::JSONError, "settings.modelChecker.solverProcesses must be an unsigned integer.");
+		ret.modelCheckerSettings.solverProcesses = modelCheckerSettings["solverProcesses"].get<unsigned>();
+	}
+
 	if (modelCheckerSettings.contains("solvers"))
 	{
 		auto const& solversArray = modelCheckerSettings["solvers"];
@@ -1139,6 +1134,13 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 		ret.modelCheckerSettings.solvers = solvers;
 	}
 
+	if (modelCheckerSettings.contains("threads"))
+	{
+		if (!modelCheckerSettings["threads"].is_number_unsigned())
+			return formatFatalError(Error::Type::JSONError, "settings.modelChecker.threads must be an unsigned integer.");
+		ret.modelCheckerSettings.threads = modelCheckerSettings["threads"].get<unsigned>();
+	}
+
 	if (modelCheckerSettings.contains("printQuery"))
 	{
 		auto const& printQuery = modelCheckerSettings["printQuery"];
@@ -1253,8 +1255,8 @@ Json StandardCompiler::importEVMAssembly(StandardCompiler::InputsAndSettings _in
 		evmData["bytecode"] = collectEVMObject(
 			_inputsAndSettings.evmVersion,
 			stack.object(sourceName),
-			stack.sourceMapping(sourceName),
-			{},
+			[&]() { return stack.sourceMapping(sourceName); },
+			[]() { return Json(); },
 			false, // _runtimeObject
 			[&](std::string const& _element) {
 				return isArtifactRequested(
@@ -1277,8 +1279,8 @@ Json StandardCompiler::importEVMAssembly(StandardCompiler::InputsAndSettings _in
 		evmData["deployedBytecode"] = collectEVMObject(
 			_inputsAndSettings.evmVersion,
 			stack.runtimeObject(sourceName),
-			stack.runtimeSourceMapping(sourceName),
-			{},
+			[&]() { return stack.runtimeSourceMapping(sourceName); },
+			[]() { return Json(); },
 			true, // _runtimeObject
 			[&](std::string const& _element) {
 				return isArtifactRequested(
@@ -1302,7 +1304,7 @@ Json StandardCompiler::importEVMAssembly(StandardCompiler::InputsAndSettings _in
 	return util::removeNullMembers(output);
 }
 
-Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inputsAndSettings)
+Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inputsAndSettings, util::JsonStreamWriter* _outputWriter)
 {
 	solAssert(_inputsAndSettings.jsonSources.empty());
 
@@ -1316,6 +1318,7 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 	compilerStack.setViaIR(_inputsAndSettings.viaIR);
 	compilerStack.setEVMVersion(_inputsAndSettings.evmVersion);
 	compilerStack.setEOFVersion(_inputsAndSettings.eofVersion);
+	compilerStack.setParallelism(_inputsAndSettings.parallelism);
 	compilerStack.setRemappings(std::move(_inputsAndSettings.remappings));
 	compilerStack.setOptimiserSettings(std::move(_inputsAndSettings.optimiserSettings));
 	compilerStack.setRevertStringBehaviour(_inputsAndSettings.revertStrings);
@@ -1433,37 +1436,44 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 		solAssert(!errors.empty(), "No error reported, but compilation failed.");
 
 	Json output;
-
-	if (errors.size() > 0)
-		output["errors"] = std::move(errors);
+	// Sets the member at the given path of the output. When streaming, members are written out
+	// right away, so they have to be added in the order of their keys.
+	auto addOutput = [&](std::vector<std::string> const& _path, Json _value) {
+		if (_outputWriter)
+			_outputWriter->write(_path, _value);
+		else
+		{
+			Json* member = &output;
+			for (std::string const& key: _path)
+				member = &(*member)[key];
+			*member = std::move(_value);
+		}
+	};
 
 	if (!compilerStack.unhandledSMTLib2Queries().empty())
+	{
+		Json queries;
 		for (std::string const& query: compilerStack.unhandledSMTLib2Queries())
-			output["auxiliaryInputRequested"]["smtlib2queries"]["0x" + util::keccak256(query).hex()] = query;
+			queries["0x" + util::keccak256(query).hex()] = query;
+		addOutput({"auxiliaryInputRequested", "smtlib2queries"}, std::move(queries));
+	}
 
 	bool const wildcardMatchesExperimental = false;
 
-	output["sources"] = Json::object();
-	unsigned sourceIndex = 0;
-	// NOTE: A case that will pass `parsingSuccess && !analysisFailed` but not `analysisSuccess` is
-	// stopAfter: parsing with no parsing errors.
-	if (parsingSuccess && !analysisFailed)
-		for (std::string const& sourceName: compilerStack.sourceNames())
-		{
-			Json sourceResult;
-			sourceResult["id"] = sourceIndex++;
-			if (isArtifactRequested(_inputsAndSettings.outputSelection, sourceName, "", "ast", wildcardMatchesExperimental))
-				sourceResult["ast"] = ASTJsonExporter(compilerStack.state(), compilerStack.sourceIndices()).toJson(compilerStack.ast(sourceName));
-			output["sources"][sourceName] = sourceResult;
-		}
-
-	Json contractsOutput;
+	// Contract names have the form "<file>:<name>". Sort them by file first, since that is the
+	// order of the output.
+	std::vector<std::pair<std::string, std::string>> contracts;
 	for (std::string const& contractName: analysisSuccess ? compilerStack.contractNames() : std::vector<std::string>())
 	{
 		size_t colon = contractName.rfind(':');
 		solAssert(colon != std::string::npos, "");
-		std::string file = contractName.substr(0, colon);
-		std::string name = contractName.substr(colon + 1);
+		contracts.emplace_back(contractName.substr(0, colon), contractName.substr(colon + 1));
+	}
+	std::sort(contracts.begin(), contracts.end());
+
+	for (auto const& [file, name]: contracts)
+	{
+		std::string const contractName = file + ":" + name;
 
 		// ABI, storage layout, documentation and metadata
 		Json contractData;
@@ -1499,7 +1509,7 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.legacyAssembly", wildcardMatchesExperimental))
 			evmData["legacyAssembly"] = compilerStack.assemblyJSON(contractName);
 		if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.methodIdentifiers", wildcardMatchesExperimental))
-			evmData["methodIdentifiers"] = compilerStack.interfaceSymbols(contractName)["methods"];
+			evmData["methodIdentifiers"] = compilerStack.methodIdentifiers(contractName);
 		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.gasEstimates", wildcardMatchesExperimental))
 			evmData["gasEstimates"] = compilerStack.gasEstimates(contractName);
 
@@ -1513,8 +1523,8 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 			evmData["bytecode"] = collectEVMObject(
 				_inputsAndSettings.evmVersion,
 				compilerStack.object(contractName),
-				compilerStack.sourceMapping(contractName),
-				compilerStack.generatedSources(contractName),
+				[&]() { return compilerStack.sourceMapping(contractName); },
+				[&]() { return compilerStack.generatedSources(contractName); },
 				false,
 				[&](std::string const& _element) { return isArtifactRequested(
 					_inputsAndSettings.outputSelection,
@@ -1535,8 +1545,8 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 			evmData["deployedBytecode"] = collectEVMObject(
 				_inputsAndSettings.evmVersion,
 				compilerStack.runtimeObject(contractName),
-				compilerStack.runtimeSourceMapping(contractName),
-				compilerStack.generatedSources(contractName, true),
+				[&]() { return compilerStack.runtimeSourceMapping(contractName); },
+				[&]() { return compilerStack.generatedSources(contractName, true); },
 				true,
 				[&](std::string const& _element) { return isArtifactRequested(
 					_inputsAndSettings.outputSelection,
@@ -1548,17 +1558,31 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 			);
 
 		if (!evmData.empty())
-			contractData["evm"] = evmData;
+			contractData["evm"] = std::move(evmData);
 
 		if (!contractData.empty())
-		{
-			if (!contractsOutput.contains(file))
-				contractsOutput[file] = Json::object();
-			contractsOutput[file][name] = contractData;
-		}
+			addOutput({"contracts", file, name}, std::move(contractData));
+	}
+
+	if (errors.size() > 0)
+		addOutput({"errors"}, std::move(errors));
+
+	std::vector<std::string> sourceNames;
+	// NOTE: A case that will pass `parsingSuccess && !analysisFailed` but not `analysisSuccess` is
+	// stopAfter: parsing with no parsing errors.
+	if (parsingSuccess && !analysisFailed)
+		sourceNames = compilerStack.sourceNames();
+	if (sourceNames.empty())
+		addOutput({"sources"}, Json::object());
+	unsigned sourceIndex = 0;
+	for (std::string const& sourceName: sourceNames)
+	{
+		Json sourceResult;
+		sourceResult["id"] = sourceIndex++;
+		if (isArtifactRequested(_inputsAndSettings.outputSelection, sourceName, "", "ast", wildcardMatchesExperimental))
+			sourceResult["ast"] = ASTJsonExporter(compilerStack.state(), compilerStack.sourceIndices()).toJson(compilerStack.ast(sourceName));
+		addOutput({"sources", sourceName}, std::move(sourceResult));
 	}
-	if (!contractsOutput.empty())
-		output["contracts"] = contractsOutput;
 
 	return output;
 }
@@ -1678,8 +1702,8 @@ Json StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 					collectEVMObject(
 						_inputsAndSettings.evmVersion,
 						*o.bytecode,
-						o.sourceMappings.get(),
-						Json::array(),
+						[&]() { return o.sourceMappings.get(); },
+						[]() { return Json::array(); },
 						isDeployed,
 						[&, kind = kind](std::string const& _element) { return isArtifactRequested(
 							_inputsAndSettings.outputSelection,
@@ -1703,7 +1727,24 @@ Json StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 
 Json StandardCompiler::compile(Json const& _input) noexcept
 {
-	YulStringRepository::reset();
+	return compile(_input, nullptr);
+}
+
+Json StandardCompiler::compile(Json const& _input, util::JsonStreamWriter* _outputWriter)
+{
+	// Parts of the output might already have been written. Report the exception in the
+	// errors if they are still to come, otherwise there is no way to report it in the output.
+	auto rethrowIfErrorsWritten = [&]() {
+		if (_outputWriter && _outputWriter->started() && !_outputWriter->canWrite({"errors"}))
+		{
+			_outputWriter->finish();
+			throw;
+		}
+	};
+
+	// Strings interned during this compilation are released when it is done, or, if other
+	// compilations are running concurrently, when the last of them is done.
+	YulStringRepository::CompilationScope yulStringScope{true /* _resetWhenDone */};
 
 	try
 	{
@@ -1712,11 +1753,11 @@ Json StandardCompiler::compile(Json const& _input) noexcept
 			return std::get<Json>(std::move(parsed));
 		InputsAndSettings settings = std::get<InputsAndSettings>(std::move(parsed));
 		if (settings.language == "Solidity")
-			return compileSolidity(std::move(settings));
+			return compileSolidity(std::move(settings), _outputWriter);
 		else if (settings.language == "Yul")
 			return compileYul(std::move(settings));
 		else if (settings.language == "SolidityAST")
-			return compileSolidity(std::move(settings));
+			return compileSolidity(std::move(settings), _outputWriter);
 		else if (settings.language == "EVMAssembly")
 			return importEVMAssembly(std::move(settings));
 		else
@@ -1724,11 +1765,13 @@ Json StandardCompiler::compile(Json const& _input) noexcept
 	}
 	catch (UnimplementedFeatureError const& _exception)
 	{
+		rethrowIfErrorsWritten();
 		solAssert(_exception.comment(), "Unimplemented feature errors must include a message for the user");
 		return formatFatalError(Error::Type::UnimplementedFeatureError, stringOrDefault(_exception.comment()));
 	}
 	catch (...)
 	{
+		rethrowIfErrorsWritten();
 		return formatFatalError(Error::Type::InternalCompilerError, "Internal exception in StandardCompiler::compile: " +  boost::current_exception_diagnostic_information());
 	}
 }
@@ -1764,6 +1807,47 @@ std::string StandardCompiler::compile(std::string const& _input) noexcept
 	}
 }
 
+void StandardCompiler::compile(std::string const& _input, std::ostream& _output)
+{
+	Json input;
+	bool parsed = false;
+	try
+	{
+		parsed = util::jsonParseStrict(_input, input);
+	}
+	catch (...)
+	{
+	}
+	if (!parsed)
+	{
+		// Let the other overload report the error.
+		_output << compile(_input);
+		return;
+	}
+
+	util::JsonStreamWriter writer(_output, m_jsonPrintingFormat);
+	Json output = compile(input, &writer);
+	if (!writer.started())
+	{
+		// Nothing has been streamed, either because of an early error or because the language
+		// is not compiled in a streaming manner.
+		try
+		{
+			_output << util::jsonPrint(output, m_jsonPrintingFormat);
+		}
+		catch (...)
+		{
+			_output << "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error writing output JSON.\"}]}";
+		}
+		return;
+	}
+
+	// Compilation stopped with an exception after parts of the output have been written.
+	if (!output.is_null())
+		writer.write({"errors"}, output["errors"]);
+	writer.finish();
+}
+
 Json StandardCompiler::formatFunctionDebugData(
 	std::map<std::string, evmasm::LinkerObject::FunctionDebugData> const& _debugInfo
 )
@@ -1788,3 +1872,33 @@ Json StandardCompiler::formatFunctionDebugData(
 
 	return ret;
 }
+
+Json StandardCompiler::collectEVMObject(
+	langutil::EVMVersion _evmVersion,
+	evmasm::LinkerObject const& _object,
+	std::function<std::string const*()> const& _sourceMap,
+	std::function<Json()> const& _generatedSources,
+	bool _runtimeObject,
+	std::function<bool(std::string)> const& _artifactRequested
+)
+{
+	Json output;
+	if (_artifactRequested("object"))
+		output["object"] = _object.toHex();
+	if (_artifactRequested("opcodes"))
+		output["opcodes"] = evmasm::disassemble(_object.bytecode, _evmVersion);
+	if (_artifactRequested("sourceMap"))
+	{
+		std::string const* sourceMap = _sourceMap();
+		output["sourceMap"] = sourceMap ? *sourceMap : "";
+	}
+	if (_artifactRequested("functionDebugData"))
+		output["functionDebugData"] = formatFunctionDebugData(_object.functionDebugData);
+	if (_artifactRequested("linkReferences"))
+		output["linkReferences"] = formatLinkReferences(_object.linkReferences);
+	if (_runtimeObject && _artifactRequested("immutableReferences"))
+		output["immutableReferences"] = formatImmutableReferences(_object.immutableReferences);
+	if (_artifactRequested("generatedSources"))
+		output["generatedSources"] = _generatedSources();
+	return output;
+}
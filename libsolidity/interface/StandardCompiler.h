@@ -28,7 +28,9 @@
 
 #include <liblangutil/DebugInfoSelection.h>
 
+#include <functional>
 #include <optional>
+#include <ostream>
 #include <utility>
 #include <variant>
 
@@ -62,11 +64,29 @@ public:
 	/// Parses input as JSON and performs the above processing steps, returning a serialized JSON
 	/// output. Parsing errors are returned as regular errors.
 	std::string compile(std::string const& _input) noexcept;
+	/// Same as above, but writes the output to @a _output. For Solidity sources, the artifacts of
+	/// each source and contract are written as soon as they are produced and are not kept in memory.
+	/// The output is the same as the one returned by the other overload, except if an unexpected
+	/// exception occurs after parts of the output have been written: These parts are kept and
+	/// the exception is reported in the errors, or, if the errors have already been written,
+	/// the output is completed as valid JSON and the exception is rethrown.
+	void compile(std::string const& _input, std::ostream& _output);
 
 	static Json formatFunctionDebugData(
 		std::map<std::string, evmasm::LinkerObject::FunctionDebugData> const& _debugInfo
 	);
 
+	/// @returns the output of an EVM object, containing the artifacts for which @a _artifactRequested is true.
+	/// @a _sourceMap and @a _generatedSources are only called if the respective artifact is requested.
+	static Json collectEVMObject(
+		langutil::EVMVersion _evmVersion,
+		evmasm::LinkerObject const& _object,
+		std::function<std::string const*()> const& _sourceMap,
+		std::function<Json()> const& _generatedSources,
+		bool _runtimeObject,
+		std::function<bool(std::string)> const& _artifactRequested
+	);
+
 private:
 	struct InputsAndSettings
 	{
@@ -89,15 +109,23 @@ private:
 		Json outputSelection;
 		ModelCheckerSettings modelCheckerSettings = ModelCheckerSettings{};
 		bool viaIR = false;
+		size_t parallelism = 1;
 	};
 
 	/// Parses the input json (and potentially invokes the read callback) and either returns
 	/// it in condensed form or an error as a json object.
 	std::variant<InputsAndSettings, Json> parseInput(Json const& _input);
 
+	/// Implementation of the public compile functions. If @a _outputWriter is given, the output
+	/// of Solidity compilations is written to it and null is returned. Other output, including
+	/// errors that occur before anything has been written, is returned as usual.
+	Json compile(Json const& _input, util::JsonStreamWriter* _outputWriter);
+
 	std::map<std::string, Json> parseAstFromInput(StringMap const& _sources);
 	Json importEVMAssembly(InputsAndSettings _inputsAndSettings);
-	Json compileSolidity(InputsAndSettings _inputsAndSettings);
+	/// Compiles Solidity sources or ASTs. If @a _outputWriter is given, the output is written to it
+	/// piece by piece and null is returned.
+	Json compileSolidity(InputsAndSettings _inputsAndSettings, util::JsonStreamWriter* _outputWriter = nullptr);
 	Json compileYul(InputsAndSettings _inputsAndSettings);
 
 	ReadCallback::Callback m_readFile;
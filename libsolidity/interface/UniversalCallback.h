@@ -54,6 +54,21 @@ public:
 	void resetImportCallback() { m_fileReader = nullptr; }
 
 	SMTSolverCommand& smtCommand() { return m_solver; }
+	SMTSolverCommand const& smtCommand() const { return m_solver; }
+
+	/// If @a _callback wraps a UniversalCallback, makes it send SMT queries to a new sibling of
+	/// its SMTSolverCommand, so that the solver configuration and interruptions of the owner
+	/// of @a _callback do not affect other users of the command.
+	/// @returns the new command, which has to outlive @a _callback, or nullptr.
+	static std::unique_ptr<SMTSolverCommand> useOwnSolverCommand(ReadCallback::Callback& _callback)
+	{
+		auto const* universalCallback = _callback.target<UniversalCallback>();
+		if (!universalCallback)
+			return nullptr;
+		std::unique_ptr<SMTSolverCommand> command = universalCallback->m_solver.sibling();
+		_callback = UniversalCallback{universalCallback->m_fileReader, *command};
+		return command;
+	}
 
 private:
 	FileReader* m_fileReader;
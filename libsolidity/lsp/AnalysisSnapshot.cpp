@@ -0,0 +1,75 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+#include <libsolidity/lsp/AnalysisSnapshot.h>
+#include <libsolidity/lsp/Transport.h> // for RequestError
+#include <libsolidity/lsp/Utils.h>
+
+#include <libsolidity/ast/AST.h>
+#include <libsolidity/ast/ASTUtils.h>
+
+#include <liblangutil/CharStream.h>
+
+#include <libsolutil/CommonData.h>
+
+#include <boost/algorithm/string/predicate.hpp>
+
+using namespace solidity::frontend;
+using namespace solidity::langutil;
+using namespace solidity::lsp;
+using namespace solidity;
+
+std::pair<ASTNode const*, int> SourceUnitSnapshot::nodeAt(Json const& _params) const
+{
+	std::optional<LineColumn> const position = parseLineColumn(_params["position"]);
+	lspRequire(position, ErrorCode::InvalidParams, "Invalid position.");
+	std::optional<int> const offset = charStream.translateLineColumnToPosition(
+		*position,
+		CharStream::ColumnUnit::UTF16CodeUnits
+	);
+	if (!offset)
+		return {nullptr, -1};
+	return {locateInnermostASTNode(*offset, *ast), *offset};
+}
+
+Json SourceUnitSnapshot::hover(Json const& _params) const
+{
+	auto const [node, offset] = nodeAt(_params);
+	Replies const* nodeReplies = node ? util::valueOrNullptr(replies, node->id()) : nullptr;
+	if (!nodeReplies)
+		return Json();
+	if (auto const* identifierPath = dynamic_cast<IdentifierPath const*>(node))
+		for (size_t i = 0; i < identifierPath->pathLocations().size(); ++i)
+			if (identifierPath->pathLocations()[i].containsOffset(offset))
+				return nodeReplies->pathElementHovers.at(i);
+	return nodeReplies->hover;
+}
+
+Json SourceUnitSnapshot::definition(Json const& _params) const
+{
+	ASTNode const* node = nodeAt(_params).first;
+	Replies const* nodeReplies = node ? util::valueOrNullptr(replies, node->id()) : nullptr;
+	return nodeReplies ? nodeReplies->definition : Json::array();
+}
+
+SourceUnitSnapshot const* AnalysisSnapshot::sourceUnit(std::string const& _uri) const
+{
+	lspRequire(boost::algorithm::starts_with(_uri, "file://"), ErrorCode::InvalidParams, "URI must start with file://");
+	if (auto const* sourceUnit = util::valueOrNullptr(sourceUnits, stripFileUriSchemePrefix(_uri)))
+		return sourceUnit->get();
+	return nullptr;
+}
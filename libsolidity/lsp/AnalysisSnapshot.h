@@ -0,0 +1,87 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+#pragma once
+
+#include <liblangutil/CharStream.h>
+#include <liblangutil/SourceLocation.h>
+
+#include <libsolutil/JSON.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace solidity::frontend
+{
+class ASTNode;
+class SourceUnit;
+}
+
+namespace solidity::lsp
+{
+
+/**
+ * Replies to the requests about a single source unit, as of its last successful analysis.
+ */
+struct SourceUnitSnapshot
+{
+	/// Replies to hover and definition requests on an AST node.
+	struct Replies
+	{
+		Json hover;
+		Json definition;
+		/// Replies to hover requests on the elements of an identifier path, in the order of its path locations.
+		std::vector<Json> pathElementHovers;
+	};
+
+	/// Source code the snapshot was computed from. Shares its line index with the compiler stack.
+	langutil::CharStream charStream;
+	/// Semantic tokens of the whole source unit.
+	Json semanticTokens;
+	/// AST the replies were computed from. Later analyses create new ASTs, so it does not change.
+	/// Only the locations of its nodes are used, since their annotations refer to other source units.
+	std::shared_ptr<frontend::SourceUnit const> ast;
+	/// Replies for each AST node of the source unit, by the node ID.
+	std::map<int64_t, Replies> replies;
+
+	/// @returns the reply to a hover request with the given parameters.
+	Json hover(Json const& _params) const;
+	/// @returns the reply to a definition request with the given parameters.
+	Json definition(Json const& _params) const;
+	/// @returns the innermost AST node at the text document position given in the parameters
+	/// of a request, or nullptr if there is none, together with the offset of the position.
+	std::pair<frontend::ASTNode const*, int> nodeAt(Json const& _params) const;
+};
+
+/**
+ * Results of the last successful analysis of each source unit open in the client. Computed by
+ * the analysis worker of the language server, so that requests can be answered while the
+ * analysis of newer changes is still in progress.
+ */
+struct AnalysisSnapshot
+{
+	std::map<std::string, std::shared_ptr<SourceUnitSnapshot const>> sourceUnits;
+
+	/// @returns the snapshot of the source unit with the given URI, or nullptr if it is not
+	/// open or was not analysed successfully yet.
+	SourceUnitSnapshot const* sourceUnit(std::string const& _uri) const;
+};
+
+}
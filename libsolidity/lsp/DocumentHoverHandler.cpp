@@ -53,43 +53,71 @@ struct MarkdownBuilder
 	}
 };
 
+Type const* declarationType(Declaration const& _declaration)
+{
+	if (auto const* function = dynamic_cast<FunctionDefinition const*>(&_declaration))
+	{
+		// Constructors have neither a visibility nor a function type.
+		if (function->isConstructor())
+			return nullptr;
+		// External functions only have an external function type.
+		if (function->visibility() == Visibility::External)
+			return function->functionType(false);
+	}
+	return _declaration.type();
+}
+
 }
 
 void DocumentHoverHandler::operator()(MessageID _id, Json const& _args)
 {
-	auto const [sourceUnitName, lineColumn] = HandlerBase(*this).extractSourceUnitNameAndLineColumn(_args);
+	auto const [sourceUnitName, lineColumn] = extractSourceUnitNameAndLineColumn(_args);
 	auto const [sourceNode, sourceOffset] = m_server.astNodeAndOffsetAtSourceLocation(sourceUnitName, lineColumn);
+	client().reply(_id, sourceNode ? hover(*sourceNode, sourceOffset) : Json());
+}
 
+bool DocumentHoverHandler::replyFromSnapshot(MessageID _id, Json const& _args) const
+{
+	std::shared_ptr<AnalysisSnapshot const> const snapshot = m_server.snapshot();
+	SourceUnitSnapshot const* sourceUnit = snapshot->sourceUnit(_args["textDocument"]["uri"].get<std::string>());
+	if (!sourceUnit)
+		return false;
+	client().reply(_id, sourceUnit->hover(_args));
+	return true;
+}
+
+Json DocumentHoverHandler::hover(ASTNode const& _sourceNode, int _sourceOffset) const
+{
 	MarkdownBuilder markdown;
-	auto rangeToHighlight = toRange(sourceNode->location());
+	auto rangeToHighlight = toRange(_sourceNode.location());
 
 	// Try getting the type definition of the underlying AST node, if available.
-	if (auto const* expression = dynamic_cast<Expression const*>(sourceNode))
+	if (auto const* expression = dynamic_cast<Expression const*>(&_sourceNode))
 	{
 		if (auto const* declaration = ASTNode::referencedDeclaration(*expression))
-			if (declaration->type())
-				markdown.solidityCode(declaration->type()->toString(false));
+			if (Type const* type = declarationType(*declaration))
+				markdown.solidityCode(type->toString(false));
 	}
-	else if (auto const* declaration = dynamic_cast<Declaration const*>(sourceNode))
+	else if (auto const* declaration = dynamic_cast<Declaration const*>(&_sourceNode))
 	{
-		if (declaration->type())
-			markdown.solidityCode(declaration->type()->toString(false));
+		if (Type const* type = declarationType(*declaration))
+			markdown.solidityCode(type->toString(false));
 	}
-	else if (auto const* identifierPath = dynamic_cast<IdentifierPath const*>(sourceNode))
+	else if (auto const* identifierPath = dynamic_cast<IdentifierPath const*>(&_sourceNode))
 	{
 		for (size_t i = 0; i < identifierPath->path().size(); ++i)
 		{
-			if (identifierPath->pathLocations()[i].containsOffset(sourceOffset))
+			if (identifierPath->pathLocations()[i].containsOffset(_sourceOffset))
 			{
 				rangeToHighlight = toRange(identifierPath->pathLocations()[i]);
 
 				if (i < identifierPath->annotation().pathDeclarations.size())
 				{
 					Declaration const* declaration = identifierPath->annotation().pathDeclarations[i];
-					if (declaration && declaration->type())
-						markdown.solidityCode(declaration->type()->toString(false));
+					if (Type const* type = declaration ? declarationType(*declaration) : nullptr)
+						markdown.solidityCode(type->toString(false));
 					if (auto const* structurallyDocumented = dynamic_cast<StructurallyDocumented const*>(declaration))
-						if (structurallyDocumented->documentation()->text())
+						if (structurallyDocumented->documentation() && structurallyDocumented->documentation()->text())
 							markdown.paragraph(*structurallyDocumented->documentation()->text());
 				}
 				break;
@@ -98,7 +126,7 @@ void DocumentHoverHandler::operator()(MessageID _id, Json const& _args)
 	}
 
 	// If this AST node contains documentation itself, append it.
-	if (auto const* documented = dynamic_cast<StructurallyDocumented const*>(sourceNode))
+	if (auto const* documented = dynamic_cast<StructurallyDocumented const*>(&_sourceNode))
 	{
 		if (documented->documentation())
 			markdown.paragraph(*documented->documentation()->text());
@@ -107,17 +135,13 @@ void DocumentHoverHandler::operator()(MessageID _id, Json const& _args)
 	auto tooltipText = markdown.result.str();
 
 	if (tooltipText.empty())
-	{
-		client().reply(_id, Json());
-		return;
-	}
+		return Json();
 
 	Json reply;
 	reply["range"] = rangeToHighlight;
 	reply["contents"]["kind"] = "markdown";
 	reply["contents"]["value"] = std::move(tooltipText);
-
-	client().reply(_id, reply);
+	return reply;
 }
 
 }
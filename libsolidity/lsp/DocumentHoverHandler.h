@@ -26,7 +26,16 @@ class DocumentHoverHandler: public HandlerBase
 public:
 	using HandlerBase::HandlerBase;
 
+	/// Replies to the request from the current analysis, analysing pending changes first.
 	void operator()(MessageID, Json const&);
+
+	/// Replies to the request from the last analysis snapshot.
+	/// @returns false without replying if the snapshot does not cover the document.
+	bool replyFromSnapshot(MessageID, Json const&) const;
+
+	/// @returns the reply to a hover request at @a _sourceOffset inside @a _sourceNode, which
+	/// has to be the innermost AST node at that offset. Requires the analysed compiler stack.
+	Json hover(frontend::ASTNode const& _sourceNode, int _sourceOffset) const;
 };
 
 }
@@ -55,7 +55,7 @@ void FileRepository::setIncludePaths(std::vector<boost::filesystem::path> _paths
 
 std::string FileRepository::sourceUnitNameToUri(std::string const& _sourceUnitName) const
 {
-	std::regex const windowsDriveLetterPath("^[a-zA-Z]:/");
+	static std::regex const windowsDriveLetterPath("^[a-zA-Z]:/");
 
 	auto const ensurePathIsUnixLike = [&](std::string inputPath) -> std::string {
 		if (!regex_search(inputPath, windowsDriveLetterPath))
@@ -99,6 +99,18 @@ void FileRepository::setSourceByUri(std::string const& _uri, std::string _source
 	lspDebug(fmt::format("FileRepository.setSourceByUri({}): {}", _uri, _source));
 	m_sourceUnitNamesToUri.emplace(sourceUnitName, _uri);
 	m_sourceCodes[sourceUnitName] = std::move(_source);
+	m_charStreams.erase(sourceUnitName);
+}
+
+langutil::CharStream const& FileRepository::charStream(std::string const& _sourceUnitName) const
+{
+	auto it = m_charStreams.find(_sourceUnitName);
+	if (it == m_charStreams.end())
+		it = m_charStreams.emplace(
+			_sourceUnitName,
+			langutil::CharStream(m_sourceCodes.at(_sourceUnitName), _sourceUnitName)
+		).first;
+	return it->second;
 }
 
 Result<boost::filesystem::path> FileRepository::tryResolvePath(std::string const& _strippedSourceUnitName) const
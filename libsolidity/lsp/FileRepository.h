@@ -18,6 +18,7 @@
 #pragma once
 
 #include <libsolidity/interface/FileReader.h>
+#include <liblangutil/CharStream.h>
 #include <libsolutil/Result.h>
 
 #include <string>
@@ -45,6 +46,10 @@ public:
 	/// @returns all sources by their compiler-internal source unit name.
 	StringMap const& sourceUnits() const noexcept { return m_sourceCodes; }
 
+	/// @returns a character stream of the current contents of the given source unit, which
+	/// has to exist. Its line index is kept until the source unit changes.
+	langutil::CharStream const& charStream(std::string const& _sourceUnitName) const;
+
 	/// Changes the source identified by the LSP client path _uri to _text.
 	void setSourceByUri(std::string const& _uri, std::string _text);
 
@@ -69,6 +74,8 @@ private:
 
 	/// Mapping of source unit names to their file content.
 	StringMap m_sourceCodes;
+	/// Character streams of the source units requested so far, reset when their content changes.
+	mutable std::map<std::string, langutil::CharStream> m_charStreams;
 };
 
 }
@@ -30,28 +30,42 @@
 using namespace solidity::frontend;
 using namespace solidity::langutil;
 using namespace solidity::lsp;
+using namespace solidity;
 
 void GotoDefinition::operator()(MessageID _id, Json const& _args)
 {
 	auto const [sourceUnitName, lineColumn] = extractSourceUnitNameAndLineColumn(_args);
-
 	ASTNode const* sourceNode = m_server.astNodeAtSourceLocation(sourceUnitName, lineColumn);
+	client().reply(_id, sourceNode ? definition(*sourceNode) : Json::array());
+}
+
+bool GotoDefinition::replyFromSnapshot(MessageID _id, Json const& _args) const
+{
+	std::shared_ptr<AnalysisSnapshot const> const snapshot = m_server.snapshot();
+	SourceUnitSnapshot const* sourceUnit = snapshot->sourceUnit(_args["textDocument"]["uri"].get<std::string>());
+	if (!sourceUnit)
+		return false;
+	client().reply(_id, sourceUnit->definition(_args));
+	return true;
+}
 
+Json GotoDefinition::definition(ASTNode const& _sourceNode) const
+{
 	std::vector<SourceLocation> locations;
-	if (auto const* expression = dynamic_cast<Expression const*>(sourceNode))
+	if (auto const* expression = dynamic_cast<Expression const*>(&_sourceNode))
 	{
 		// Handles all expressions that can have one or more declaration annotation.
 		if (auto const* declaration = referencedDeclaration(expression))
 			if (auto location = declarationLocation(declaration))
 				locations.emplace_back(std::move(location.value()));
 	}
-	else if (auto const* identifierPath = dynamic_cast<IdentifierPath const*>(sourceNode))
+	else if (auto const* identifierPath = dynamic_cast<IdentifierPath const*>(&_sourceNode))
 	{
 		if (auto const* declaration = identifierPath->annotation().referencedDeclaration)
 			if (auto location = declarationLocation(declaration))
 				locations.emplace_back(std::move(location.value()));
 	}
-	else if (auto const* importDirective = dynamic_cast<ImportDirective const*>(sourceNode))
+	else if (auto const* importDirective = dynamic_cast<ImportDirective const*>(&_sourceNode))
 	{
 		auto const& path = *importDirective->annotation().absolutePath;
 		if (fileRepository().sourceUnits().count(path))
@@ -61,5 +75,5 @@ void GotoDefinition::operator()(MessageID _id, Json const& _args)
 	Json reply = Json::array();
 	for (SourceLocation const& location: locations)
 		reply.emplace_back(toJson(location));
-	client().reply(_id, reply);
+	return reply;
 }
@@ -25,7 +25,16 @@ class GotoDefinition: public HandlerBase
 public:
 	explicit GotoDefinition(LanguageServer& _server): HandlerBase(_server) {}
 
+	/// Replies to the request from the current analysis, analysing pending changes first.
 	void operator()(MessageID, Json const&);
+
+	/// Replies to the request from the last analysis snapshot.
+	/// @returns false without replying if the snapshot does not cover the document.
+	bool replyFromSnapshot(MessageID, Json const&) const;
+
+	/// @returns the reply to a definition request on @a _sourceNode.
+	/// Requires the analysed compiler stack.
+	Json definition(frontend::ASTNode const& _sourceNode) const;
 };
 
 }
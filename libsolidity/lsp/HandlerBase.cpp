@@ -38,8 +38,10 @@ Json HandlerBase::toRange(SourceLocation const& _location) const
 
 	solAssert(_location.sourceName, "");
 	langutil::CharStream const& stream = charStreamProvider().charStream(*_location.sourceName);
-	LineColumn start = stream.translatePositionToLineColumn(_location.start);
-	LineColumn end = stream.translatePositionToLineColumn(_location.end);
+	// LSP positions count columns in UTF-16 code units.
+	auto const unit = langutil::CharStream::ColumnUnit::UTF16CodeUnits;
+	LineColumn start = stream.translatePositionToLineColumn(_location.start, unit);
+	LineColumn end = stream.translatePositionToLineColumn(_location.end, unit);
 	return toJsonRange(start, end);
 }
 
@@ -41,8 +41,11 @@
 #include <boost/filesystem.hpp>
 #include <boost/algorithm/string/predicate.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <ostream>
 #include <string>
+#include <thread>
 
 #include <fmt/format.h>
 
@@ -59,6 +62,9 @@ namespace fs = boost::filesystem;
 namespace
 {
 
+/// Time without further changes after which changes received from the client are analysed.
+std::chrono::milliseconds const analysisDelay{150};
+
 bool resolvesToRegularFile(boost::filesystem::path _path, int maxRecursionDepth = 10)
 {
 	fs::file_status fileStatus = fs::status(_path);
@@ -134,23 +140,31 @@ Json semanticTokensLegend()
 LanguageServer::LanguageServer(Transport& _transport):
 	m_client{_transport},
 	m_handlers{
-		{"$/cancelRequest", [](auto, auto) {/*nothing for now as we are synchronous */}},
-		{"cancelRequest", [](auto, auto) {/*nothing for now as we are synchronous */}},
-		{"exit", [this](auto, auto) { m_state = (m_state == State::ShutdownRequested ? State::ExitRequested : State::ExitWithoutShutdown); }},
 		{"initialize", std::bind(&LanguageServer::handleInitialize, this, _1, _2)},
 		{"initialized", std::bind(&LanguageServer::handleInitialized, this, _1, _2)},
 		{"$/setTrace", [this](auto, Json const& args) { setTrace(args["value"]); }},
-		{"shutdown", [this](auto, auto) { m_state = State::ShutdownRequested; }},
-		{"textDocument/definition", GotoDefinition(*this) },
 		{"textDocument/didOpen", std::bind(&LanguageServer::handleTextDocumentDidOpen, this, _2)},
 		{"textDocument/didChange", std::bind(&LanguageServer::handleTextDocumentDidChange, this, _2)},
 		{"textDocument/didClose", std::bind(&LanguageServer::handleTextDocumentDidClose, this, _2)},
+		{"textDocument/definition", GotoDefinition(*this) },
 		{"textDocument/hover", DocumentHoverHandler(*this) },
-		{"textDocument/rename", RenameSymbol(*this) },
 		{"textDocument/implementation", GotoDefinition(*this) },
+		{"textDocument/rename", RenameSymbol(*this) },
 		{"textDocument/semanticTokens/full", std::bind(&LanguageServer::semanticTokensFull, this, _1, _2)},
 		{"workspace/didChangeConfiguration", std::bind(&LanguageServer::handleWorkspaceDidChangeConfiguration, this, _2)},
 	},
+	m_immediateHandlers{
+		{"$/cancelRequest", std::bind(&LanguageServer::handleCancelRequest, this, _2)},
+		{"cancelRequest", std::bind(&LanguageServer::handleCancelRequest, this, _2)},
+		{"exit", [this](auto, auto) { m_state = (m_state == State::ShutdownRequested ? State::ExitRequested : State::ExitWithoutShutdown); }},
+		{"shutdown", [this](auto, auto) { m_state = State::ShutdownRequested; }},
+	},
+	m_snapshotHandlers{
+		{"textDocument/definition", std::bind(&GotoDefinition::replyFromSnapshot, GotoDefinition(*this), _1, _2)},
+		{"textDocument/hover", std::bind(&DocumentHoverHandler::replyFromSnapshot, DocumentHoverHandler(*this), _1, _2)},
+		{"textDocument/implementation", std::bind(&GotoDefinition::replyFromSnapshot, GotoDefinition(*this), _1, _2)},
+		{"textDocument/semanticTokens/full", std::bind(&LanguageServer::semanticTokensFromSnapshot, this, _1, _2)},
+	},
 	m_fileRepository("/" /* basePath */, {} /* no search paths */),
 	m_compilerStack{m_fileRepository.reader()}
 {
@@ -188,6 +202,11 @@ void LanguageServer::changeConfiguration(Json const& _settings)
 			lspRequire(false, ErrorCode::InvalidParams, "Invalid file load strategy: " + text);
 	}
 
+	// Imports may resolve differently now, so nothing from previous analyses can be reused.
+	m_analysedSources.clear();
+	m_imports.clear();
+	m_sourceUnitsWithUnknownImports.clear();
+
 	m_settingsObject = _settings;
 	Json jsonIncludePaths = _settings.contains("include-paths") ? _settings["include-paths"] : Json::object();
 
@@ -236,8 +255,10 @@ std::vector<boost::filesystem::path> LanguageServer::allSolidityFilesFromProject
 	return collectedPaths;
 }
 
-void LanguageServer::compile()
+std::set<std::string> LanguageServer::compile(std::set<std::string> const& _requiredSourceUnits)
 {
+	m_changesPending = false;
+
 	// For files that are not open, we have to take changes on disk into account,
 	// so we just remove all non-open files.
 
@@ -262,24 +283,147 @@ void LanguageServer::compile()
 			oldRepository.sourceUnits().at(oldRepository.uriToSourceUnitName(fileName))
 		);
 
-	// TODO: optimize! do not recompile if nothing has changed (file(s) not flagged dirty).
+	// Files loaded only because they are imported are not part of the new repository yet.
+	// Load those that are still imported, so that changes to them are detected as well.
+	std::vector<std::string> reachableSourceUnits = ranges::to<std::vector>(m_fileRepository.sourceUnits() | ranges::views::keys);
+	std::set<std::string> visitedSourceUnits(reachableSourceUnits.begin(), reachableSourceUnits.end());
+	for (size_t i = 0; i < reachableSourceUnits.size(); ++i)
+		if (auto const* imports = util::valueOrNullptr(m_imports, reachableSourceUnits[i]))
+			for (std::string const& importedSourceUnit: *imports)
+				if (
+					visitedSourceUnits.insert(importedSourceUnit).second &&
+					m_fileRepository.readFile(ReadCallback::kindString(ReadCallback::Kind::ReadFile), importedSourceUnit).success
+				)
+					reachableSourceUnits.push_back(importedSourceUnit);
+
+	StringMap const& sourceUnits = m_fileRepository.sourceUnits();
+	std::set<std::string> changedSourceUnits;
+	for (auto const& [sourceUnitName, content]: sourceUnits)
+		if (auto it = m_analysedSources.find(sourceUnitName); it == m_analysedSources.end() || it->second != content)
+			changedSourceUnits.insert(sourceUnitName);
+	for (std::string const& sourceUnitName: m_analysedSources | ranges::views::keys)
+		if (!sourceUnits.count(sourceUnitName))
+			changedSourceUnits.insert(sourceUnitName);
+
+	std::set<std::string> requiredSourceUnits;
+	for (std::string const& sourceUnitName: _requiredSourceUnits)
+		if (sourceUnits.count(sourceUnitName))
+			requiredSourceUnits.insert(sourceUnitName);
+	std::vector<std::string> const compiledSourceUnits = m_compilerStack.sourceNames();
+	bool const requiredSourceUnitsCompiled = std::includes(
+		compiledSourceUnits.begin(),
+		compiledSourceUnits.end(),
+		requiredSourceUnits.begin(),
+		requiredSourceUnits.end()
+	);
+	if (changedSourceUnits.empty() && requiredSourceUnitsCompiled)
+		return {};
+
+	// Analysis results of a source unit depend only on the source units it imports,
+	// so a change affects the changed source units and everything importing them.
+	std::map<std::string, std::set<std::string>> importingSourceUnits;
+	for (auto const& [sourceUnitName, imports]: m_imports)
+		for (std::string const& importedSourceUnit: imports)
+			importingSourceUnits[importedSourceUnit].insert(sourceUnitName);
+	std::set<std::string> affectedSourceUnits = changedSourceUnits;
+	std::vector<std::string> worklist(changedSourceUnits.begin(), changedSourceUnits.end());
+	while (!worklist.empty())
+	{
+		std::string const sourceUnitName = std::move(worklist.back());
+		worklist.pop_back();
+		if (auto const* importing = util::valueOrNullptr(importingSourceUnits, sourceUnitName))
+			for (std::string const& importingSourceUnit: *importing)
+				if (affectedSourceUnits.insert(importingSourceUnit).second)
+					worklist.push_back(importingSourceUnit);
+	}
+
+	for (std::string const& sourceUnitName: changedSourceUnits)
+		if (!sourceUnits.count(sourceUnitName))
+		{
+			m_analysedSources.erase(sourceUnitName);
+			m_imports.erase(sourceUnitName);
+			m_sourceUnitsWithUnknownImports.erase(sourceUnitName);
+		}
+
+	StringMap sourcesToCompile;
+	for (std::string const& sourceUnitName: affectedSourceUnits + requiredSourceUnits + m_sourceUnitsWithUnknownImports)
+		if (sourceUnits.count(sourceUnitName))
+			sourcesToCompile[sourceUnitName] = sourceUnits.at(sourceUnitName);
+	lspDebug(fmt::format("compiling {} of {} source units", sourcesToCompile.size(), sourceUnits.size()));
 
+	// Imports of the given sources are loaded from the file repository during parsing.
 	m_compilerStack.reset(false);
-	m_compilerStack.setSources(m_fileRepository.sourceUnits());
+	m_compilerStack.setSources(std::move(sourcesToCompile));
 	m_compilerStack.compile(CompilerStack::State::AnalysisSuccessful);
+
+	bool const importsResolved =
+		m_compilerStack.state() >= CompilerStack::ParsedAndImported &&
+		!m_compilerStack.isExperimentalSolidity();
+	std::set<std::string> sourceUnitsWithUnknownImports;
+	for (std::string const& sourceUnitName: m_compilerStack.sourceNames())
+	{
+		// Skips sources not provided by the client or the file system, i.e. the standard library.
+		if (!m_fileRepository.sourceUnits().count(sourceUnitName))
+			continue;
+
+		// Includes the imports loaded during parsing, whose diagnostics are new as well.
+		affectedSourceUnits.insert(sourceUnitName);
+		m_analysedSources[sourceUnitName] = m_fileRepository.sourceUnits().at(sourceUnitName);
+		if (!importsResolved)
+		{
+			sourceUnitsWithUnknownImports.insert(sourceUnitName);
+			continue;
+		}
+
+		std::set<std::string>& imports = m_imports[sourceUnitName];
+		imports.clear();
+		for (auto const* import: ASTNode::filteredNodes<ImportDirective>(m_compilerStack.ast(sourceUnitName).nodes()))
+			imports.insert(*import->annotation().absolutePath);
+	}
+	m_sourceUnitsWithUnknownImports = std::move(sourceUnitsWithUnknownImports);
+
+	updateSnapshot();
+	return affectedSourceUnits;
 }
 
 void LanguageServer::compileAndUpdateDiagnostics()
 {
-	compile();
+	{
+		std::lock_guard<std::mutex> lock(m_jobMutex);
+		if (m_handledGeneration != m_generation)
+		{
+			// The result would be outdated right away. The changes are analysed together
+			// with the ones waiting to be handled.
+			m_changesPending = true;
+			return;
+		}
+	}
+	publishDiagnostics(compile({}));
+}
 
-	// These are the source units we will sent diagnostics to the client for sure,
-	// even if it is just to clear previous diagnostics.
-	std::map<std::string, Json> diagnosticsBySourceUnit;
-	for (std::string const& sourceUnitName: m_fileRepository.sourceUnits() | ranges::views::keys)
-		diagnosticsBySourceUnit[sourceUnitName] = Json::array();
-	for (std::string const& sourceUnitName: m_nonemptyDiagnostics)
-		diagnosticsBySourceUnit[sourceUnitName] = Json::array();
+void LanguageServer::requireAnalysed(std::set<std::string> const& _sourceUnitNames)
+{
+	std::vector<std::string> const compiledSourceUnits = m_compilerStack.sourceNames();
+	if (
+		!m_changesPending &&
+		std::includes(compiledSourceUnits.begin(), compiledSourceUnits.end(), _sourceUnitNames.begin(), _sourceUnitNames.end())
+	)
+		return;
+
+	std::set<std::string> const affectedSourceUnits = compile(_sourceUnitNames);
+	if (!affectedSourceUnits.empty())
+		publishDiagnostics(affectedSourceUnits);
+}
+
+void LanguageServer::publishDiagnostics(std::set<std::string> const& _affectedSourceUnits)
+{
+	// Diagnostics of the other source units cannot have changed, since neither they nor their
+	// imports changed. They are sent again only to keep every notification complete.
+	for (std::string const& sourceUnitName: _affectedSourceUnits)
+		if (m_fileRepository.sourceUnits().count(sourceUnitName))
+			m_diagnostics[sourceUnitName] = Json::array();
+		else
+			m_diagnostics.erase(sourceUnitName);
 
 	for (std::shared_ptr<Error const> const& error: m_compilerStack.errors())
 	{
@@ -287,6 +431,8 @@ void LanguageServer::compileAndUpdateDiagnostics()
 		if (!location || !location->sourceName)
 			// LSP only has diagnostics applied to individual files.
 			continue;
+		if (!_affectedSourceUnits.count(*location->sourceName) || !m_diagnostics.count(*location->sourceName))
+			continue;
 
 		Json jsonDiag;
 		jsonDiag["source"] = "solc";
@@ -307,9 +453,18 @@ void LanguageServer::compileAndUpdateDiagnostics()
 				jsonDiag["relatedInformation"].emplace_back(jsonRelated);
 			}
 
-		diagnosticsBySourceUnit[*location->sourceName].emplace_back(jsonDiag);
+		m_diagnostics[*location->sourceName].emplace_back(jsonDiag);
 	}
 
+	// These are the source units we will sent diagnostics to the client for sure,
+	// even if it is just to clear previous diagnostics.
+	std::map<std::string, Json> diagnosticsBySourceUnit;
+	for (std::string const& sourceUnitName: m_fileRepository.sourceUnits() | ranges::views::keys)
+		diagnosticsBySourceUnit[sourceUnitName] = util::valueOrDefault(m_diagnostics, sourceUnitName, Json::array(), util::allow_copy);
+	for (std::string const& sourceUnitName: m_nonemptyDiagnostics)
+		if (!diagnosticsBySourceUnit.count(sourceUnitName))
+			diagnosticsBySourceUnit[sourceUnitName] = Json::array();
+
 	if (m_client.traceValue() != TraceValue::Off)
 	{
 		Json extra;
@@ -329,16 +484,79 @@ void LanguageServer::compileAndUpdateDiagnostics()
 	}
 }
 
+std::shared_ptr<AnalysisSnapshot const> LanguageServer::snapshot() const
+{
+	std::lock_guard<std::mutex> lock(m_snapshotMutex);
+	return m_snapshot;
+}
+
+void LanguageServer::updateSnapshot()
+{
+	StringMap const& sourceUnits = m_fileRepository.sourceUnits();
+	std::set<std::string> openSourceUnits;
+	for (std::string const& uri: m_openFiles)
+		openSourceUnits.insert(m_fileRepository.uriToSourceUnitName(uri));
+
+	// Source units that were not compiled keep their results, since neither they nor their imports changed.
+	auto snapshot = std::make_shared<AnalysisSnapshot>();
+	for (auto const& [sourceUnitName, sourceUnitSnapshot]: this->snapshot()->sourceUnits)
+		if (sourceUnits.count(sourceUnitName) && openSourceUnits.count(sourceUnitName))
+			snapshot->sourceUnits.emplace(sourceUnitName, sourceUnitSnapshot);
+
+	// Requests about documents that are not open are rare, so they are left to the analysis worker
+	// instead of computing the replies for every source unit the open ones import.
+	// Requests about source units that failed to analyse are left to the worker as well.
+	bool const analysisSuccessful = m_compilerStack.state() >= CompilerStack::AnalysisSuccessful;
+	for (std::string const& sourceUnitName: m_compilerStack.sourceNames())
+		if (analysisSuccessful && openSourceUnits.count(sourceUnitName) && sourceUnits.count(sourceUnitName))
+			snapshot->sourceUnits[sourceUnitName] = snapshotSourceUnit(sourceUnitName);
+		else
+			snapshot->sourceUnits.erase(sourceUnitName);
+
+	std::lock_guard<std::mutex> lock(m_snapshotMutex);
+	m_snapshot = std::move(snapshot);
+}
+
+std::shared_ptr<SourceUnitSnapshot const> LanguageServer::snapshotSourceUnit(std::string const& _sourceUnitName)
+{
+	auto sourceUnitSnapshot = std::make_shared<SourceUnitSnapshot>();
+	sourceUnitSnapshot->ast = m_compilerStack.sharedAST(_sourceUnitName);
+	CharStream const& charStream = m_compilerStack.charStream(_sourceUnitName);
+	sourceUnitSnapshot->charStream = charStream;
+	sourceUnitSnapshot->semanticTokens = SemanticTokensBuilder().build(*sourceUnitSnapshot->ast, charStream);
+
+	DocumentHoverHandler const hoverHandler(*this);
+	GotoDefinition const definitionHandler(*this);
+	SimpleASTVisitor visitor(
+		[&](ASTNode const& _node) -> bool
+		{
+			SourceUnitSnapshot::Replies& replies = sourceUnitSnapshot->replies[_node.id()];
+			replies.hover = hoverHandler.hover(_node, -1);
+			replies.definition = definitionHandler.definition(_node);
+			// The reply to hover requests on identifier paths depends on the path element.
+			if (auto const* identifierPath = dynamic_cast<IdentifierPath const*>(&_node))
+				for (SourceLocation const& location: identifierPath->pathLocations())
+					replies.pathElementHovers.push_back(hoverHandler.hover(_node, location.start));
+			return true;
+		},
+		[](ASTNode const&) {}
+	);
+	sourceUnitSnapshot->ast->accept(visitor);
+
+	return sourceUnitSnapshot;
+}
+
 bool LanguageServer::run()
 {
+	std::thread analysisWorker(&LanguageServer::runAnalysisWorker, this);
+
 	while (m_state != State::ExitRequested && m_state != State::ExitWithoutShutdown && !m_client.closed())
 	{
 		MessageID id;
-		try
-		{
+		handleMessage(id, [&] {
 			std::optional<Json> const jsonMessage = m_client.receive();
 			if (!jsonMessage)
-				continue;
+				return;
 
 			if ((*jsonMessage).contains("method") && (*jsonMessage)["method"].is_string())
 			{
@@ -347,28 +565,107 @@ bool LanguageServer::run()
 					id = (*jsonMessage)["id"];
 				lspDebug(fmt::format("received method call: {}", methodName));
 
-				if (auto handler = util::valueOrDefault(m_handlers, methodName))
+				if (auto handler = util::valueOrDefault(m_immediateHandlers, methodName))
 					handler(id, (*jsonMessage)["params"]);
+				else if (
+					auto snapshotHandler = util::valueOrDefault(m_snapshotHandlers, methodName);
+					snapshotHandler && snapshotHandler(id, (*jsonMessage)["params"])
+				)
+					lspDebug("answered from the analysis snapshot");
+				else if (m_handlers.count(methodName))
+				{
+					std::lock_guard<std::mutex> lock(m_jobMutex);
+					if (
+						methodName == "textDocument/didOpen" ||
+						methodName == "textDocument/didChange" ||
+						methodName == "textDocument/didClose"
+					)
+						++m_generation;
+					m_jobs.push_back({id, methodName, (*jsonMessage)["params"], m_generation});
+					m_jobQueued.notify_one();
+				}
 				else
 					m_client.error(id, ErrorCode::MethodNotFound, "Unknown method " + methodName);
 			}
 			else
 				m_client.error({}, ErrorCode::ParseError, "\"method\" has to be a string.");
-		}
-		catch (Json::exception const&)
-		{
-			m_client.error(id, ErrorCode::InvalidParams, "JSON object access error. Most likely due to a badly formatted JSON request message."s);
-		}
-		catch (RequestError const& error)
-		{
-			m_client.error(id, error.code(), error.comment() ? *error.comment() : ""s);
-		}
-		catch (...)
+		});
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_jobMutex);
+		m_stopWorker = true;
+	}
+	m_jobQueued.notify_one();
+	analysisWorker.join();
+
+	return m_state == State::ExitRequested;
+}
+
+void LanguageServer::runAnalysisWorker()
+{
+	auto const jobQueued = [&]() { return m_stopWorker || !m_jobs.empty(); };
+
+	std::unique_lock<std::mutex> lock(m_jobMutex);
+	while (true)
+	{
+		if (m_changesPending && !m_jobQueued.wait_until(lock, m_lastChangeTime + analysisDelay, jobQueued))
 		{
-			m_client.error(id, ErrorCode::InternalError, "Unhandled exception: "s + boost::current_exception_diagnostic_information());
+			lock.unlock();
+			handleMessage({}, [&] { compileAndUpdateDiagnostics(); });
+			lock.lock();
+			continue;
 		}
+
+		m_jobQueued.wait(lock, jobQueued);
+		if (m_stopWorker)
+			return;
+
+		Job const job = std::move(m_jobs.front());
+		m_jobs.pop_front();
+		m_handledGeneration = job.generation;
+
+		lock.unlock();
+		handleMessage(job.id, [&] { m_handlers.at(job.methodName)(job.id, job.params); });
+		lock.lock();
 	}
-	return m_state == State::ExitRequested;
+}
+
+void LanguageServer::handleMessage(MessageID const& _id, std::function<void()> const& _handle)
+{
+	try
+	{
+		_handle();
+	}
+	catch (Json::exception const&)
+	{
+		m_client.error(_id, ErrorCode::InvalidParams, "JSON object access error. Most likely due to a badly formatted JSON request message."s);
+	}
+	catch (RequestError const& error)
+	{
+		m_client.error(_id, error.code(), error.comment() ? *error.comment() : ""s);
+	}
+	catch (...)
+	{
+		m_client.error(_id, ErrorCode::InternalError, "Unhandled exception: "s + boost::current_exception_diagnostic_information());
+	}
+}
+
+void LanguageServer::handleCancelRequest(Json const& _args)
+{
+	MessageID id;
+	{
+		std::lock_guard<std::mutex> lock(m_jobMutex);
+		auto const job = std::find_if(m_jobs.begin(), m_jobs.end(), [&](Job const& _job) {
+			return !_job.id.is_null() && _job.id == _args["id"];
+		});
+		// Requests being handled already or answered right away cannot be cancelled.
+		if (job == m_jobs.end())
+			return;
+		id = job->id;
+		m_jobs.erase(job);
+	}
+	m_client.error(id, ErrorCode::RequestCancelled, "Request cancelled.");
 }
 
 void LanguageServer::requireServerInitialized()
@@ -439,17 +736,18 @@ void LanguageServer::semanticTokensFull(MessageID _id, Json const& _args)
 {
 	if (_args.contains("textDocument") && _args["textDocument"].contains("uri"))
 	{
-		auto uri = _args["textDocument"]["uri"];
-
-		compile();
-
-		auto const sourceName = m_fileRepository.uriToSourceUnitName(uri.get<std::string>());
-		SourceUnit const& ast = m_compilerStack.ast(sourceName);
-		m_compilerStack.charStream(sourceName);
-		Json data = SemanticTokensBuilder().build(ast, m_compilerStack.charStream(sourceName));
+		auto const sourceUnitName = m_fileRepository.uriToSourceUnitName(_args["textDocument"]["uri"].get<std::string>());
+		requireAnalysed({sourceUnitName});
 
 		Json reply;
-		reply["data"] = data;
+		// Semantic tokens only need the AST, which exists for all source units once parsing succeeded.
+		if (m_compilerStack.state() >= CompilerStack::Parsed && m_fileRepository.sourceUnits().count(sourceUnitName))
+			reply["data"] = SemanticTokensBuilder().build(
+				m_compilerStack.ast(sourceUnitName),
+				m_compilerStack.charStream(sourceUnitName)
+			);
+		else
+			reply["data"] = Json::array();
 
 		m_client.reply(_id, std::move(reply));
 	}
@@ -457,6 +755,22 @@ void LanguageServer::semanticTokensFull(MessageID _id, Json const& _args)
 		m_client.error(_id, ErrorCode::InvalidParams, "Invalid parameter: textDocument.uri expected.");
 }
 
+bool LanguageServer::semanticTokensFromSnapshot(MessageID _id, Json const& _args)
+{
+	if (!_args.contains("textDocument") || !_args["textDocument"].contains("uri"))
+		return false;
+
+	std::shared_ptr<AnalysisSnapshot const> const snapshot = this->snapshot();
+	SourceUnitSnapshot const* sourceUnit = snapshot->sourceUnit(_args["textDocument"]["uri"].get<std::string>());
+	if (!sourceUnit)
+		return false;
+
+	Json reply;
+	reply["data"] = sourceUnit->semanticTokens;
+	m_client.reply(_id, std::move(reply));
+	return true;
+}
+
 void LanguageServer::handleWorkspaceDidChangeConfiguration(Json const& _args)
 {
 	requireServerInitialized();
@@ -543,7 +857,9 @@ void LanguageServer::handleTextDocumentDidChange(Json const& _args)
 				}
 			}
 
-		compileAndUpdateDiagnostics();
+		// Analysed once no further changes arrive for a while, or when a request needs the result.
+		m_changesPending = true;
+		m_lastChangeTime = std::chrono::steady_clock::now();
 	}
 }
 
@@ -573,12 +889,17 @@ ASTNode const* LanguageServer::astNodeAtSourceLocation(std::string const& _sourc
 
 std::tuple<ASTNode const*, int> LanguageServer::astNodeAndOffsetAtSourceLocation(std::string const& _sourceUnitName, LineColumn const& _filePos)
 {
+	requireAnalysed({_sourceUnitName});
+
 	if (m_compilerStack.state() < CompilerStack::AnalysisSuccessful)
 		return {nullptr, -1};
 	if (!m_fileRepository.sourceUnits().count(_sourceUnitName))
 		return {nullptr, -1};
 
-	std::optional<int> sourcePos = m_compilerStack.charStream(_sourceUnitName).translateLineColumnToPosition(_filePos);
+	std::optional<int> sourcePos = m_compilerStack.charStream(_sourceUnitName).translateLineColumnToPosition(
+		_filePos,
+		CharStream::ColumnUnit::UTF16CodeUnits
+	);
 	if (!sourcePos)
 		return {nullptr, -1};
 
@@ -17,6 +17,7 @@
 // SPDX-License-Identifier: GPL-3.0
 #pragma once
 
+#include <libsolidity/lsp/AnalysisSnapshot.h>
 #include <libsolidity/lsp/Transport.h>
 #include <libsolidity/lsp/FileRepository.h>
 #include <libsolidity/interface/CompilerStack.h>
@@ -24,9 +25,16 @@
 
 #include <libsolutil/JSON.h>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -57,6 +65,11 @@ enum class FileLoadStrategy
  * Solidity Language Server, managing one LSP client.
  * This implements a subset of LSP version 3.16 that can be found at:
  * https://microsoft.github.io/language-server-protocol/specifications/specification-3-16/
+ *
+ * Messages are handled in order by an analysis worker thread, which owns the file repository
+ * and the compiler stack. Hover, definition and semantic tokens requests about open documents
+ * are instead answered right away by the thread reading the messages, from a snapshot of the
+ * last successful analysis.
  */
 class LanguageServer
 {
@@ -64,9 +77,16 @@ public:
 	/// @param _transport Customizable transport layer.
 	explicit LanguageServer(Transport& _transport);
 
-	/// Re-compiles the project and updates the diagnostics pushed to the client.
+	/// Re-compiles the source units changed since the last compilation, together with all source
+	/// units importing them, and pushes the diagnostics of all source units to the client.
+	/// Does nothing but remember the changes if further changes are waiting to be handled.
 	void compileAndUpdateDiagnostics();
 
+	/// Makes sure that the compiler stack contains the given source units and reflects all
+	/// changes received from the client so far. Compiles only if this is not already the case
+	/// and pushes diagnostics only if something changed.
+	void requireAnalysed(std::set<std::string> const& _sourceUnitNames);
+
 	/// Loops over incoming messages via the transport layer until shutdown condition is met.
 	///
 	/// The standard shutdown condition is when the maximum number of consecutive failures
@@ -75,13 +95,38 @@ public:
 	/// @return boolean indicating normal or abnormal termination.
 	bool run();
 
-	FileRepository& fileRepository() noexcept { return m_fileRepository; }
+	/// @returns the results of the last successful analysis of each source unit.
+	/// Can be called from any thread.
+	std::shared_ptr<AnalysisSnapshot const> snapshot() const;
 	Transport& client() noexcept { return m_client; }
+
+	// The following must only be used by handlers running on the analysis worker.
+	FileRepository& fileRepository() noexcept { return m_fileRepository; }
 	std::tuple<frontend::ASTNode const*, int> astNodeAndOffsetAtSourceLocation(std::string const& _sourceUnitName, langutil::LineColumn const& _filePos);
 	frontend::ASTNode const* astNodeAtSourceLocation(std::string const& _sourceUnitName, langutil::LineColumn const& _filePos);
 	frontend::CompilerStack const& compilerStack() const noexcept { return m_compilerStack; }
 
 private:
+	using MessageHandler = std::function<void(MessageID, Json const&)>;
+	/// Handler replying from the analysis snapshot. @returns false if it did not reply.
+	using SnapshotHandler = std::function<bool(MessageID, Json const&)>;
+
+	/// Message from the client waiting to be handled by the analysis worker.
+	struct Job
+	{
+		MessageID id;
+		std::string methodName;
+		Json params;
+		/// Number of messages changing the sources that were received up to this one.
+		uint64_t generation = 0;
+	};
+
+	/// Handles the queued messages and analyses the changes once no further changes arrive for a while.
+	void runAnalysisWorker();
+	/// Runs @a _handle and replies with an error to the request @a _id if it fails.
+	void handleMessage(MessageID const& _id, std::function<void()> const& _handle);
+	void handleCancelRequest(Json const& _args);
+
 	/// Checks if the server is initialized (to be used by messages that need it to be initialized).
 	/// Reports an error and returns false if not.
 	void requireServerInitialized();
@@ -95,32 +140,74 @@ private:
 	void handleRename(Json const& _args);
 	void handleGotoDefinition(MessageID _id, Json const& _args);
 	void semanticTokensFull(MessageID _id, Json const& _args);
+	bool semanticTokensFromSnapshot(MessageID _id, Json const& _args);
 
 	/// Invoked when the server user-supplied configuration changes (initiated by the client).
 	void changeConfiguration(Json const&);
 
-	/// Compile everything until after analysis phase.
-	void compile();
+	/// Compiles the source units affected by changes since the last compilation until after
+	/// the analysis phase, together with the source units in @a _requiredSourceUnits.
+	/// Source units that are neither affected nor required are not part of the compiler stack afterwards.
+	/// @returns the names of the source units whose diagnostics may have changed, including removed ones.
+	std::set<std::string> compile(std::set<std::string> const& _requiredSourceUnits);
+	/// Replaces the stored diagnostics of @a _affectedSourceUnits with the errors of the
+	/// current compilation and sends the diagnostics of all source units to the client.
+	void publishDiagnostics(std::set<std::string> const& _affectedSourceUnits);
+	/// Replaces the snapshot of the open source units with the results of the current compilation
+	/// if it was successful, and drops the source units that are no longer open or no longer exist.
+	void updateSnapshot();
+	/// @returns the replies to all requests about the given source unit of the current compilation.
+	std::shared_ptr<SourceUnitSnapshot const> snapshotSourceUnit(std::string const& _sourceUnitName);
 
 	std::vector<boost::filesystem::path> allSolidityFilesFromProject() const;
 
-	using MessageHandler = std::function<void(MessageID, Json const&)>;
-
 	Json toRange(langutil::SourceLocation const& _location);
 	Json toJson(langutil::SourceLocation const& _location);
 
 	// LSP related member fields
 
 	enum class State { Started, Initialized, ShutdownRequested, ExitRequested, ExitWithoutShutdown };
-	State m_state = State::Started;
+	std::atomic<State> m_state{State::Started};
 
 	Transport& m_client;
+	/// Handlers of the messages that are queued for the analysis worker.
 	std::map<std::string, MessageHandler> m_handlers;
+	/// Handlers of the messages that are handled right away when received.
+	std::map<std::string, MessageHandler> m_immediateHandlers;
+	/// Handlers of the requests that are answered right away if the snapshot covers the document.
+	/// Otherwise, the request is queued for the analysis worker.
+	std::map<std::string, SnapshotHandler> m_snapshotHandlers;
+
+	std::mutex m_jobMutex;
+	std::condition_variable m_jobQueued;
+	std::deque<Job> m_jobs;
+	bool m_stopWorker = false;
+	/// Number of messages changing the sources received so far.
+	uint64_t m_generation = 0;
+	/// Generation of the message handled last by the analysis worker.
+	uint64_t m_handledGeneration = 0;
+
+	mutable std::mutex m_snapshotMutex;
+	std::shared_ptr<AnalysisSnapshot const> m_snapshot = std::make_shared<AnalysisSnapshot const>();
 
 	/// Set of files (names in URI form) known to be open by the client.
 	std::set<std::string> m_openFiles;
 	/// Set of source unit names for which we sent diagnostics to the client in the last iteration.
 	std::set<std::string> m_nonemptyDiagnostics;
+	/// Diagnostics from the last analysis of each source unit.
+	std::map<std::string, Json> m_diagnostics;
+	/// Contents of the source units at the time of their last analysis.
+	StringMap m_analysedSources;
+	/// Source units imported by each source unit, as of its last analysis.
+	std::map<std::string, std::set<std::string>> m_imports;
+	/// Source units to compile again, because their last compilation did not get far enough
+	/// to determine their imports.
+	std::set<std::string> m_sourceUnitsWithUnknownImports;
+	/// Whether the client changed sources that have not been analysed yet.
+	bool m_changesPending = false;
+	/// Time of the last change received from the client. Analysis starts once no further changes
+	/// arrived for a while, so that a burst of changes is analysed only once.
+	std::chrono::steady_clock::time_point m_lastChangeTime;
 	FileRepository m_fileRepository;
 	FileLoadStrategy m_fileLoadStrategy = FileLoadStrategy::ProjectDirectory;
 
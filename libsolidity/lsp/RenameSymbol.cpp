@@ -22,7 +22,11 @@
 
 #include <fmt/format.h>
 
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/view/map.hpp>
+
 #include <memory>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -53,6 +57,9 @@ void RenameSymbol::operator()(MessageID _id, Json const& _args)
 	std::string const newName = _args["newName"].get<std::string>();
 	std::string const uri = _args["textDocument"]["uri"].get<std::string>();
 
+	// References can be in any source unit, so all of them have to be analysed.
+	m_server.requireAnalysed(ranges::to<std::set<std::string>>(fileRepository().sourceUnits() | ranges::views::keys));
+
 	ASTNode const* sourceNode = m_server.astNodeAtSourceLocation(sourceUnitName, lineColumn);
 
 	m_symbolName = {};
@@ -62,7 +69,7 @@ void RenameSymbol::operator()(MessageID _id, Json const& _args)
 
 	std::optional<int> cursorBytePosition = charStreamProvider()
 		.charStream(sourceUnitName)
-		.translateLineColumnToPosition(lineColumn);
+		.translateLineColumnToPosition(lineColumn, CharStream::ColumnUnit::UTF16CodeUnits);
 	solAssert(cursorBytePosition.has_value(), "Expected source pos");
 
 	extractNameAndDeclaration(*sourceNode, *cursorBytePosition);
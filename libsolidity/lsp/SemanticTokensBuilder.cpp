@@ -115,8 +115,11 @@ void SemanticTokensBuilder::encode(
 	if (!_sourceLocation.isValid())
 		return;
 
-	auto const [line, startChar] = m_charStream->translatePositionToLineColumn(_sourceLocation.start);
-	auto const length = _sourceLocation.end - _sourceLocation.start;
+	auto const unit = CharStream::ColumnUnit::UTF16CodeUnits;
+	auto const [line, startChar] = m_charStream->translatePositionToLineColumn(_sourceLocation.start, unit);
+	auto const [endLine, endChar] = m_charStream->translatePositionToLineColumn(_sourceLocation.end, unit);
+	// Tokens spanning several lines fall back to their length in bytes.
+	auto const length = endLine == line ? endChar - startChar : _sourceLocation.end - _sourceLocation.start;
 
 	lspDebug(fmt::format("encode [{}:{}..{}] {}", line, startChar, length, static_cast<int>(_tokenType)));
 
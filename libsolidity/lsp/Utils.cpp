@@ -93,9 +93,9 @@ std::optional<SourceLocation> parsePosition(
 		return std::nullopt;
 
 	if (std::optional<LineColumn> lineColumn = parseLineColumn(_position))
-		if (std::optional<int> const offset = CharStream::translateLineColumnToPosition(
-			_fileRepository.sourceUnits().at(_sourceUnitName),
-			*lineColumn
+		if (std::optional<int> const offset = _fileRepository.charStream(_sourceUnitName).translateLineColumnToPosition(
+			*lineColumn,
+			CharStream::ColumnUnit::UTF16CodeUnits
 		))
 			return SourceLocation{*offset, *offset, std::make_shared<std::string>(_sourceUnitName)};
 	return std::nullopt;
@@ -116,7 +116,7 @@ std::optional<SourceLocation> parseRange(FileRepository const& _fileRepository,
 
 std::string stripFileUriSchemePrefix(std::string const& _path)
 {
-	std::regex const windowsDriveLetterPath("^file:///[a-zA-Z]:/");
+	static std::regex const windowsDriveLetterPath("^file:///[a-zA-Z]:/");
 	if (regex_search(_path, windowsDriveLetterPath))
 		return _path.substr(8);
 	if (_path.find("file://") == 0)
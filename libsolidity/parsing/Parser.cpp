@@ -76,7 +76,12 @@ public:
 		solAssert(m_location.sourceName, "");
 		if (m_location.end < 0)
 			markEndPosition();
-		return std::make_shared<NodeType>(m_parser.nextID(), m_location, std::forward<Args>(_args)...);
+		return std::allocate_shared<NodeType>(
+			util::ArenaAllocator<NodeType>(*m_parser.m_arena),
+			m_parser.nextID(),
+			m_location,
+			std::forward<Args>(_args)...
+		);
 	}
 
 	SourceLocation const& location() const noexcept { return m_location; }
@@ -89,6 +94,13 @@ private:
 ASTPointer<SourceUnit> Parser::parse(CharStream& _charStream)
 {
 	solAssert(!m_insideModifier, "");
+	// The nodes keep the arena alive, release the parser's reference once the source unit is done.
+	m_arena = util::CountedArena::create();
+	ScopeGuard releaseArena([&]() {
+		m_internedStrings.clear();
+		m_arena->release();
+		m_arena = nullptr;
+	});
 	try
 	{
 		m_recursionDepth = 0;
@@ -283,7 +295,7 @@ ASTPointer<ImportDirective> Parser::parseImportDirective()
 	ASTNodeFactory nodeFactory(*this);
 	expectToken(Token::Import);
 	ASTPointer<ASTString> path;
-	ASTPointer<ASTString> unitAlias = std::make_shared<std::string>();
+	ASTPointer<ASTString> unitAlias = internString({});
 	SourceLocation unitAliasLocation{};
 	ImportDirective::SymbolAliasList symbolAliases;
 
@@ -674,7 +686,7 @@ ASTPointer<FunctionDefinition> Parser::parseFunctionDefinition(bool _freeFunctio
 				{Token::Receive, "receive function"},
 			}.at(m_scanner->currentToken());
 			nameLocation = currentLocation();
-			name = std::make_shared<ASTString>(TokenTraits::toString(m_scanner->currentToken()));
+			name = internString(TokenTraits::toString(m_scanner->currentToken()));
 			std::string message{
 				"This function is named \"" + *name + "\" but is not the " + expected + " of the contract. "
 				"If you intend this to be a " + expected + ", use \"" + *name + "(...) { ... }\" without "
@@ -693,7 +705,7 @@ ASTPointer<FunctionDefinition> Parser::parseFunctionDefinition(bool _freeFunctio
 	{
 		solAssert(kind == Token::Constructor || kind == Token::Fallback || kind == Token::Receive, "");
 		advance();
-		name = std::make_shared<ASTString>();
+		name = internString({});
 	}
 
 	FunctionHeaderParserResult header = parseFunctionHeader(false);
@@ -906,7 +918,7 @@ ASTPointer<VariableDeclaration> Parser::parseVariableDeclaration(
 	}
 
 	if (_options.allowEmptyName && m_scanner->currentToken() != Token::Identifier)
-		identifier = std::make_shared<ASTString>("");
+		identifier = internString({});
 	else
 	{
 		nodeFactory.markEndPosition();
@@ -1295,13 +1307,13 @@ ASTPointer<Mapping> Parser::parseMapping()
 	}
 	else
 		fatalParserError(1005_error, "Expected elementary type name or identifier for mapping key type");
-	ASTPointer<ASTString> keyName = std::make_shared<ASTString>("");
+	ASTPointer<ASTString> keyName = internString({});
 	SourceLocation keyNameLocation{};
 	if (m_scanner->currentToken() == Token::Identifier)
 		tie(keyName, keyNameLocation) = expectIdentifierWithLocation();
 	expectToken(Token::DoubleArrow);
 	ASTPointer<TypeName> valueType = parseTypeName();
-	ASTPointer<ASTString> valueName = std::make_shared<ASTString>("");
+	ASTPointer<ASTString> valueName = internString({});
 	SourceLocation valueNameLocation{};
 	if (m_scanner->currentToken() == Token::Identifier)
 		tie(valueName, valueNameLocation) = expectIdentifierWithLocation();
@@ -1465,7 +1477,7 @@ ASTPointer<InlineAssembly> Parser::parseInlineAssembly(ASTPointer<ASTString> con
 		{
 			advance();
 			expectToken(Token::StringLiteral, false);
-			flags->emplace_back(std::make_shared<ASTString>(m_scanner->currentLiteral()));
+			flags->emplace_back(internString(m_scanner->currentLiteral()));
 			advance();
 		}
 		while (m_scanner->currentToken() == Token::Comma);
@@ -1478,7 +1490,15 @@ ASTPointer<InlineAssembly> Parser::parseInlineAssembly(ASTPointer<ASTString> con
 		BOOST_THROW_EXCEPTION(FatalError());
 
 	location.end = nativeLocationOf(ast->root()).end;
-	return std::make_shared<InlineAssembly>(nextID(), location, _docString, dialect, std::move(flags), ast);
+	return std::allocate_shared<InlineAssembly>(
+		util::ArenaAllocator<InlineAssembly>(*m_arena),
+		nextID(),
+		location,
+		_docString,
+		dialect,
+		std::move(flags),
+		ast
+	);
 }
 
 ASTPointer<IfStatement> Parser::parseIfStatement(ASTPointer<ASTString> const& _docString)
@@ -1523,7 +1543,7 @@ ASTPointer<TryStatement> Parser::parseTryStatement(ASTPointer<ASTString> const&
 	ASTPointer<Block> successBlock = parseBlock();
 	successClauseFactory.setEndPositionFromNode(successBlock);
 	clauses.emplace_back(successClauseFactory.createNode<TryCatchClause>(
-		std::make_shared<ASTString>(), returnsParameters, successBlock
+		internString({}), returnsParameters, successBlock
 	));
 
 	do
@@ -1542,7 +1562,7 @@ ASTPointer<TryCatchClause> Parser::parseCatchClause()
 	RecursionGuard recursionGuard(*this);
 	ASTNodeFactory nodeFactory(*this);
 	expectToken(Token::Catch);
-	ASTPointer<ASTString> errorName = std::make_shared<std::string>();
+	ASTPointer<ASTString> errorName = internString({});
 	ASTPointer<ParameterList> errorParameters;
 	if (m_scanner->currentToken() != Token::LBrace)
 	{
@@ -1879,7 +1899,7 @@ ASTPointer<TypeDefinition> Parser::parseTypeDefinition()
 			expectToken(Token::LParen);
 
 			expression = nodeFactory.createNode<Builtin>(
-				std::make_shared<std::string>(m_scanner->currentLiteral()),
+				internString(m_scanner->currentLiteral()),
 				m_scanner->currentLocation()
 			);
 
@@ -2289,7 +2309,7 @@ ASTPointer<Expression> Parser::parseLiteral()
 	RecursionGuard recursionGuard(*this);
 	ASTNodeFactory nodeFactory(*this);
 	Token initialToken = m_scanner->currentToken();
-	ASTPointer<ASTString> value = std::make_shared<std::string>(m_scanner->currentLiteral());
+	ASTPointer<ASTString> value = internString(m_scanner->currentLiteral());
 
 	switch (initialToken)
 	{
@@ -2359,7 +2379,7 @@ ASTPointer<Expression> Parser::parsePrimaryExpression()
 		// Inside expressions "type" is the name of a special, globally-available function.
 		nodeFactory.markEndPosition();
 		advance();
-		expression = nodeFactory.createNode<Identifier>(std::make_shared<ASTString>("type"));
+		expression = nodeFactory.createNode<Identifier>(internString("type"));
 		break;
 	case Token::LParen:
 	case Token::LBrack:
@@ -2709,7 +2729,7 @@ ASTPointer<Expression> Parser::expressionFromIndexAccessStructure(
 		Identifier const& identifier = dynamic_cast<Identifier const&>(*_iap.path[i]);
 		expression = nodeFactory.createNode<MemberAccess>(
 			expression,
-			std::make_shared<ASTString>(identifier.name()),
+			internString(identifier.name()),
 			identifier.location()
 		);
 	}
@@ -2743,7 +2763,7 @@ ASTPointer<ASTString> Parser::expectIdentifierTokenOrAddress()
 	ASTPointer<ASTString> result;
 	if (m_scanner->currentToken() == Token::Address)
 	{
-		result = std::make_shared<ASTString>("address");
+		result = internString("address");
 		advance();
 	}
 	else
@@ -2756,11 +2776,26 @@ ASTPointer<ASTString> Parser::expectIdentifierTokenOrAddress()
 
 ASTPointer<ASTString> Parser::getLiteralAndAdvance()
 {
-	ASTPointer<ASTString> identifier = std::make_shared<ASTString>(m_scanner->currentLiteral());
+	ASTPointer<ASTString> identifier = internString(m_scanner->currentLiteral());
 	advance();
 	return identifier;
 }
 
+ASTPointer<ASTString> Parser::internString(std::string_view _value)
+{
+	if (!m_arena)
+		return std::make_shared<ASTString>(_value);
+
+	auto it = m_internedStrings.find(_value);
+	if (it == m_internedStrings.end())
+	{
+		auto interned = std::allocate_shared<ASTString>(util::ArenaAllocator<ASTString>(*m_arena), _value);
+		// The key refers to the interned string itself, which never moves.
+		it = m_internedStrings.emplace(std::string_view(*interned), std::move(interned)).first;
+	}
+	return it->second;
+}
+
 bool Parser::isQuotedPath() const
 {
 	return m_scanner->currentToken() == Token::StringLiteral;
@@ -26,6 +26,10 @@
 #include <libsolidity/ast/AST.h>
 #include <liblangutil/ParserBase.h>
 #include <liblangutil/EVMVersion.h>
+#include <libsolutil/Arena.h>
+
+#include <string_view>
+#include <unordered_map>
 
 namespace solidity::langutil
 {
@@ -234,6 +238,9 @@ private:
 	ASTPointer<ASTString> expectIdentifierToken();
 	ASTPointer<ASTString> expectIdentifierTokenOrAddress();
 	ASTPointer<ASTString> getLiteralAndAdvance();
+	/// @returns a string with the contents of @a _value that is shared with all other nodes
+	/// of the current source unit using the same string.
+	ASTPointer<ASTString> internString(std::string_view _value);
 	///@}
 
 	bool isQuotedPath() const;
@@ -254,6 +261,10 @@ private:
 	int64_t m_currentNodeID = 0;
 	/// Flag that indicates whether experimental mode is enabled in the current source unit
 	bool m_experimentalSolidityEnabledInCurrentSourceUnit = false;
+	/// Memory for the nodes and strings of the source unit being parsed. Kept alive by the nodes.
+	util::CountedArena* m_arena = nullptr;
+	/// Strings of the source unit being parsed, keyed by their contents.
+	std::unordered_map<std::string_view, ASTPointer<ASTString>> m_internedStrings;
 };
 
 }
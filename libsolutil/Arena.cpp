@@ -0,0 +1,49 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolutil/Arena.h>
+
+#include <liblangutil/Exceptions.h>
+
+#include <algorithm>
+#include <cstdint>
+
+using namespace solidity::util;
+
+void* Arena::allocate(size_t _size, size_t _alignment)
+{
+	solAssert(_alignment > 0 && (_alignment & (_alignment - 1)) == 0, "Alignment has to be a power of two.");
+
+	auto padding = [&]() { return (_alignment - reinterpret_cast<uintptr_t>(m_current) % _alignment) % _alignment; };
+	if (!m_current || padding() + _size > m_remaining)
+	{
+		size_t const chunkSize = std::max(m_nextChunkSize, _size + _alignment);
+		// Not value-initialised on purpose, the memory is overwritten by the objects placed into it.
+		m_chunks.emplace_back(new std::byte[chunkSize]);
+		m_current = m_chunks.back().get();
+		m_remaining = chunkSize;
+		m_reservedBytes += chunkSize;
+		m_nextChunkSize = std::min(m_nextChunkSize * 2, c_maxChunkSize);
+	}
+
+	size_t const offset = padding();
+	void* result = m_current + offset;
+	m_current += offset + _size;
+	m_remaining -= offset + _size;
+	return result;
+}
@@ -0,0 +1,127 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace solidity::util
+{
+
+/**
+ * Bump allocator for objects that are released all at once, e.g. the nodes of an AST.
+ *
+ * Memory is handed out from chunks of growing size and is only returned to the system when
+ * the arena is destroyed. Allocation is not thread-safe.
+ */
+class Arena
+{
+public:
+	Arena() = default;
+	Arena(Arena const&) = delete;
+	Arena& operator=(Arena const&) = delete;
+
+	/// @returns uninitialised memory for @a _size bytes, aligned to @a _alignment,
+	/// which has to be a power of two.
+	void* allocate(size_t _size, size_t _alignment);
+
+	/// @returns the number of bytes obtained from the system so far.
+	size_t reservedBytes() const { return m_reservedBytes; }
+
+private:
+	static size_t constexpr c_initialChunkSize = 4096;
+	static size_t constexpr c_maxChunkSize = 1024 * 1024;
+
+	std::vector<std::unique_ptr<std::byte[]>> m_chunks;
+	std::byte* m_current = nullptr;
+	size_t m_remaining = 0;
+	size_t m_nextChunkSize = c_initialChunkSize;
+	size_t m_reservedBytes = 0;
+};
+
+/**
+ * Arena that deletes itself once its creator has released it and every object allocated from it
+ * through an ArenaAllocator has been deallocated.
+ *
+ * A single surviving object keeps all memory of the arena reserved, so it should only be used
+ * for objects that are released together, like the AST of a source unit.
+ */
+class CountedArena: public Arena
+{
+public:
+	/// @returns a new arena that is owned by the caller until it calls release().
+	static CountedArena* create() { return new CountedArena(); }
+
+	/// Gives up the ownership of the creator.
+	void release() { removeReference(); }
+
+	void addReference() { m_references.fetch_add(1, std::memory_order_relaxed); }
+	void removeReference()
+	{
+		if (m_references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			delete this;
+	}
+
+private:
+	CountedArena() = default;
+	~CountedArena() = default;
+
+	/// Number of live allocations plus one for the creator until it releases the arena.
+	std::atomic<size_t> m_references{1};
+};
+
+/**
+ * Standard allocator that takes its memory from a CountedArena.
+ *
+ * Copies only hold a pointer to the arena. Each allocation counts as a reference to it, so objects
+ * created with std::allocate_shared keep their arena alive on their own.
+ */
+template<typename T>
+class ArenaAllocator
+{
+public:
+	using value_type = T;
+
+	explicit ArenaAllocator(CountedArena& _arena): m_arena(&_arena) {}
+	template<typename U>
+	ArenaAllocator(ArenaAllocator<U> const& _other): m_arena(&_other.arena()) {}
+
+	T* allocate(size_t _count)
+	{
+		T* memory = static_cast<T*>(m_arena->allocate(_count * sizeof(T), alignof(T)));
+		m_arena->addReference();
+		return memory;
+	}
+	/// The memory itself is only returned to the system together with the whole arena.
+	void deallocate(T*, size_t) noexcept { m_arena->removeReference(); }
+
+	CountedArena& arena() const { return *m_arena; }
+
+	template<typename U>
+	bool operator==(ArenaAllocator<U> const& _other) const { return m_arena == &_other.arena(); }
+	template<typename U>
+	bool operator!=(ArenaAllocator<U> const& _other) const { return m_arena != &_other.arena(); }
+
+private:
+	CountedArena* m_arena;
+};
+
+}
@@ -0,0 +1,171 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolutil/FileCache.h>
+
+#include <libsolutil/Keccak256.h>
+
+#include <liblangutil/Exceptions.h>
+
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <tuple>
+#include <vector>
+
+using namespace solidity;
+using namespace solidity::util;
+
+namespace fs = boost::filesystem;
+
+FileCache::FileCache(fs::path _directory, std::string _version, std::string _extension):
+	m_directory(std::move(_directory)),
+	m_version(std::move(_version)),
+	m_extension(std::move(_extension))
+{
+	solAssert(m_version.find('\n') == std::string::npos);
+	fs::create_directories(m_directory);
+}
+
+std::optional<std::string> FileCache::load(h256 const& _key)
+{
+	fs::path const path = entryPath(_key);
+	std::ifstream file(path.string(), std::ios::binary);
+	if (!file)
+	{
+		++m_misses;
+		return std::nullopt;
+	}
+
+	// Entry format: version and hash of the content, each on its own line, followed by the content.
+	// The hash protects against entries truncated by a crashing process or a full disk.
+	std::string version;
+	std::string contentHash;
+	std::getline(file, version);
+	std::getline(file, contentHash);
+	std::string content{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+	if (file.bad() || version != m_version || contentHash != keccak256(content).hex())
+	{
+		++m_misses;
+		return std::nullopt;
+	}
+
+	// Eviction is based on modification times, so refresh it to mark the entry as recently used.
+	boost::system::error_code errorCode;
+	fs::last_write_time(path, std::time(nullptr), errorCode);
+
+	++m_hits;
+	m_bytesRead += content.size();
+	return content;
+}
+
+void FileCache::store(h256 const& _key, std::string const& _content)
+{
+	std::ostringstream entry;
+	entry << m_version << '\n' << keccak256(_content).hex() << '\n' << _content;
+	std::string const serializedEntry = entry.str();
+
+	boost::system::error_code errorCode;
+	fs::path const temporaryPath = m_directory / fs::unique_path("%%%%-%%%%-%%%%-%%%%.tmp", errorCode);
+	if (errorCode)
+		return;
+
+	{
+		std::ofstream file(temporaryPath.string(), std::ios::binary | std::ios::trunc);
+		file << serializedEntry;
+		if (!file)
+		{
+			fs::remove(temporaryPath, errorCode);
+			return;
+		}
+	}
+
+	fs::rename(temporaryPath, entryPath(_key), errorCode);
+	if (errorCode)
+		fs::remove(temporaryPath, errorCode);
+	else
+		m_bytesWritten += serializedEntry.size();
+}
+
+void FileCache::evict(size_t _sizeLimit)
+{
+	struct Entry
+	{
+		std::time_t lastUse;
+		uintmax_t size;
+		fs::path path;
+	};
+
+	std::vector<Entry> entries;
+	uintmax_t totalSize = 0;
+	boost::system::error_code errorCode;
+	for (fs::directory_iterator it(m_directory, errorCode), end; !errorCode && it != end; it.increment(errorCode))
+	{
+		fs::path const& path = it->path();
+		if (path.extension() != m_extension)
+			continue;
+
+		// Entries can be removed concurrently by other processes. Skip those we cannot inspect.
+		boost::system::error_code entryErrorCode;
+		uintmax_t size = fs::file_size(path, entryErrorCode);
+		std::time_t lastUse = entryErrorCode ? 0 : fs::last_write_time(path, entryErrorCode);
+		if (entryErrorCode)
+			continue;
+
+		entries.push_back({lastUse, size, path});
+		totalSize += size;
+	}
+
+	if (totalSize <= _sizeLimit)
+		return;
+
+	std::sort(entries.begin(), entries.end(), [](Entry const& _lhs, Entry const& _rhs) {
+		return std::tie(_lhs.lastUse, _lhs.path) < std::tie(_rhs.lastUse, _rhs.path);
+	});
+	for (Entry const& entry: entries)
+	{
+		if (totalSize <= _sizeLimit)
+			break;
+
+		boost::system::error_code removalErrorCode;
+		if (fs::remove(entry.path, removalErrorCode))
+			++m_evictedEntries;
+		// Count the entry as gone even if another process removed it first.
+		totalSize -= entry.size;
+	}
+}
+
+FileCache::Statistics FileCache::statistics() const
+{
+	return {
+		m_hits.load(),
+		m_misses.load(),
+		m_bytesRead.load(),
+		m_bytesWritten.load(),
+		m_evictedEntries.load(),
+	};
+}
+
+fs::path FileCache::entryPath(h256 const& _key) const
+{
+	// Mix the version into the file name so that users of different versions sharing one directory
+	// do not keep overwriting each other's entries.
+	return m_directory / (keccak256(m_version + _key.hex()).hex() + m_extension);
+}
@@ -0,0 +1,85 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Content store in a directory, shared by processes that use the same directory.
+ */
+
+#pragma once
+
+#include <libsolutil/FixedHash.h>
+
+#include <boost/filesystem.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <string>
+
+namespace solidity::util
+{
+
+/// Directory of entries that are opaque strings addressed by 256-bit keys. Entries written with
+/// a different version string are never returned.
+///
+/// The cache is best-effort: I/O errors are treated as misses and never reported. Entries are
+/// written to a temporary file first and then atomically renamed, so that concurrent processes
+/// never observe partially written entries. All member functions are thread-safe.
+class FileCache
+{
+public:
+	struct Statistics
+	{
+		size_t hits = 0;
+		size_t misses = 0;
+		size_t bytesRead = 0;
+		size_t bytesWritten = 0;
+		size_t evictedEntries = 0;
+	};
+
+	/// Creates @a _directory if it does not exist yet.
+	/// @param _version is stored in every entry and becomes a part of every key.
+	/// @param _extension file name extension of the entries, including the dot.
+	/// @throws boost::filesystem::filesystem_error if the directory cannot be created.
+	FileCache(boost::filesystem::path _directory, std::string _version, std::string _extension);
+
+	/// @returns the content stored under @a _key or nullopt if there is no valid entry.
+	/// Marks the entry as recently used.
+	std::optional<std::string> load(h256 const& _key);
+	/// Stores @a _content under @a _key, replacing any existing entry.
+	void store(h256 const& _key, std::string const& _content);
+	/// Removes the least recently used entries until their total size no longer exceeds @a _sizeLimit.
+	void evict(size_t _sizeLimit);
+
+	Statistics statistics() const;
+	boost::filesystem::path const& directory() const { return m_directory; }
+
+private:
+	boost::filesystem::path entryPath(h256 const& _key) const;
+
+	boost::filesystem::path const m_directory;
+	std::string const m_version;
+	std::string const m_extension;
+
+	std::atomic<size_t> m_hits = 0;
+	std::atomic<size_t> m_misses = 0;
+	std::atomic<size_t> m_bytesRead = 0;
+	std::atomic<size_t> m_bytesWritten = 0;
+	std::atomic<size_t> m_evictedEntries = 0;
+};
+
+}
@@ -22,6 +22,7 @@
 #include <libsolutil/FixedHash.h>
 
 #include <string>
+#include <vector>
 
 namespace solidity::util
 {
@@ -32,6 +33,17 @@ inline FixedHash<4> selectorFromSignatureH32(std::string const& _signature)
 	return FixedHash<4>(util::keccak256(_signature), FixedHash<4>::AlignLeft);
 }
 
+/// @returns the ABI selectors for the given function signatures, as FixedHash h32s.
+/// Hashes all signatures in one batch, which is faster than computing the selectors one by one.
+inline std::vector<FixedHash<4>> selectorsFromSignaturesH32(std::vector<std::string> const& _signatures)
+{
+	std::vector<FixedHash<4>> selectors;
+	selectors.reserve(_signatures.size());
+	for (h256 const& hash: util::keccak256Batch(_signatures))
+		selectors.emplace_back(hash, FixedHash<4>::AlignLeft);
+	return selectors;
+}
+
 /// @returns the ABI selector for a given function signature, as a 32 bit number.
 inline uint32_t selectorFromSignatureU32(std::string const& _signature)
 {
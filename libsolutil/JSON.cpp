@@ -24,6 +24,8 @@
 
 #include <libsolutil/CommonData.h>
 
+#include <liblangutil/Exceptions.h>
+
 #include <boost/algorithm/string.hpp>
 
 #include <sstream>
@@ -138,6 +140,105 @@ std::string jsonPrint(Json const& _input, JsonFormat const& _format)
 	return dumped;
 }
 
+void JsonStreamWriter::write(std::vector<std::string> const& _path, Json const& _value)
+{
+	solAssert(canWrite(_path));
+	if (!m_started)
+	{
+		m_stream << "{";
+		m_started = true;
+		m_lastKeys.emplace_back();
+	}
+
+	size_t commonPrefix = 0;
+	while (commonPrefix < m_openPath.size() && m_openPath[commonPrefix] == _path[commonPrefix])
+		commonPrefix++;
+	while (m_openPath.size() > commonPrefix)
+		closeObject();
+	for (size_t i = commonPrefix; i + 1 < _path.size(); i++)
+	{
+		openMember(_path[i]);
+		m_stream << "{";
+		m_openPath.push_back(_path[i]);
+		m_lastKeys.emplace_back();
+	}
+
+	openMember(_path.back());
+	if (m_format.format == JsonFormat::Pretty)
+	{
+		// Values are dumped on their own and then shifted to the indentation of the member.
+		// Newlines only occur between tokens since they are escaped within strings.
+		std::string indentation(m_format.indent * m_lastKeys.size(), ' ');
+		for (char c: jsonPrint(_value, m_format))
+		{
+			m_stream << c;
+			if (c == '\n')
+				m_stream << indentation;
+		}
+	}
+	else
+		m_stream << jsonPrint(_value, m_format);
+}
+
+bool JsonStreamWriter::canWrite(std::vector<std::string> const& _path) const
+{
+	if (m_finished || _path.empty())
+		return false;
+	// Compare with the open objects until the paths diverge. The first key differing
+	// from the open path has to come after the last key written on that level.
+	for (size_t depth = 0; depth < m_lastKeys.size() && depth < _path.size(); depth++)
+	{
+		if (depth < m_openPath.size() && _path[depth] == m_openPath[depth])
+		{
+			if (depth + 1 == _path.size())
+				// Cannot overwrite an object that is still open.
+				return false;
+			continue;
+		}
+		return !m_lastKeys[depth] || *m_lastKeys[depth] < _path[depth];
+	}
+	return true;
+}
+
+void JsonStreamWriter::finish()
+{
+	solAssert(!m_finished);
+	if (!m_started)
+		m_stream << "{";
+	else
+		while (!m_lastKeys.empty())
+			closeObject();
+	m_stream << "}";
+	m_finished = true;
+}
+
+void JsonStreamWriter::writeIndentation(size_t _depth)
+{
+	if (m_format.format == JsonFormat::Pretty)
+		m_stream << "\n" << std::string(m_format.indent * _depth, ' ');
+}
+
+void JsonStreamWriter::openMember(std::string const& _key)
+{
+	if (m_lastKeys.back())
+		m_stream << ",";
+	writeIndentation(m_lastKeys.size());
+	m_stream << jsonCompactPrint(Json(_key)) << (m_format.format == JsonFormat::Pretty ? ": " : ":");
+	m_lastKeys.back() = _key;
+}
+
+void JsonStreamWriter::closeObject()
+{
+	// Only objects with at least one member are ever opened.
+	m_lastKeys.pop_back();
+	writeIndentation(m_lastKeys.size());
+	if (!m_openPath.empty())
+	{
+		m_stream << "}";
+		m_openPath.pop_back();
+	}
+}
+
 bool jsonParseStrict(std::string const& _input, Json& _json, std::string* _errs /* = nullptr */)
 {
 	try
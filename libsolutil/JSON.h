@@ -26,8 +26,10 @@
 #include <libsolutil/Assertions.h>
 #include <nlohmann/json.hpp>
 
+#include <ostream>
 #include <string>
 #include <string_view>
+#include <vector>
 #include <optional>
 #include <limits>
 
@@ -71,6 +73,42 @@ std::string jsonCompactPrint(Json const& _input);
 /// Serialise the JSON object (@a _input) using specified format (@a _format)
 std::string jsonPrint(Json const& _input, JsonFormat const& _format);
 
+/// Writes a JSON object to a stream member by member, so that the complete object never
+/// has to be held in memory. The written text is identical to what jsonPrint() produces for
+/// the complete object, which requires the members to be written in the order of their keys.
+class JsonStreamWriter
+{
+public:
+	JsonStreamWriter(std::ostream& _stream, JsonFormat const& _format): m_stream(_stream), m_format(_format) {}
+
+	/// Writes @a _value as the member at @a _path, opening and closing the objects enclosing it
+	/// as needed. The path has to be non-empty and come after all previously written paths
+	/// in key order.
+	void write(std::vector<std::string> const& _path, Json const& _value);
+	/// @returns true if a member at @a _path can still be written.
+	bool canWrite(std::vector<std::string> const& _path) const;
+	/// Closes all open objects, including the top-level one. Nothing can be written afterwards.
+	void finish();
+
+	/// @returns true if anything has been written to the stream.
+	bool started() const { return m_started; }
+	bool finished() const { return m_finished; }
+
+private:
+	void writeIndentation(size_t _depth);
+	void openMember(std::string const& _key);
+	void closeObject();
+
+	std::ostream& m_stream;
+	JsonFormat m_format;
+	bool m_started = false;
+	bool m_finished = false;
+	/// Keys of the objects that are currently open below the top-level object.
+	std::vector<std::string> m_openPath;
+	/// For the top-level object and each open object, the last key written into it, if any.
+	std::vector<std::optional<std::string>> m_lastKeys;
+};
+
 /// Parse a JSON string (@a _input) with enabled strict-mode and writes resulting JSON object to (@a _json)
 /// \param _input JSON input string
 /// \param _json [out] resulting JSON object
@@ -22,8 +22,10 @@
 
 #include <libsolutil/Keccak256.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <numeric>
 
 namespace solidity::util
 {
@@ -167,6 +169,138 @@ inline void hash(
 	memset(a, 0, 200);
 }
 
+/// The rate of Keccak-256 in bytes, see below.
+size_t constexpr keccak256Rate = 200 - (256 / 4);
+
+/// Number of Keccak-f permutations needed to hash an input of the given length.
+size_t keccak256Blocks(size_t _length)
+{
+	return _length / keccak256Rate + 1;
+}
+
+/******** Multi-buffer Keccak-256 ********/
+
+// The multi-buffer variant keeps the states of several independent hashes in SIMD
+// registers: word i of the state of lane l is stored at a[i][l]. The permutation is
+// written using GCC vector extensions and compiled for AVX2 and AVX-512 via target
+// attributes, so the generic code below is only ever inlined into the dispatched
+// instances and no vector type crosses a function boundary by value.
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define SOLIDITY_KECCAK_MULTIBUFFER 1
+
+typedef uint64_t Lanes4 __attribute__((vector_size(32)));
+typedef uint64_t Lanes8 __attribute__((vector_size(64)));
+
+/// Keccak-f[1600] on all lanes, unrolled the same way as keccakf above.
+template<typename Lanes>
+__attribute__((always_inline)) inline void keccakfLanes(Lanes* a)
+{
+	Lanes b[5];
+	Lanes d[5];
+
+	for (int i = 0; i < 24; i++)
+	{
+		uint8_t x, y;
+		// Theta
+		FOR5(uint8_t, x, 1,
+			b[x] = a[x] ^ a[x + 5] ^ a[x + 10] ^ a[x + 15] ^ a[x + 20];)
+		FOR5(uint8_t, x, 1,
+			d[x] = b[(x + 4) % 5] ^ rol(b[(x + 1) % 5], 1);)
+		FOR5(uint8_t, x, 1,
+			FOR5(uint8_t, y, 5,
+				a[y + x] ^= d[x]; ))
+		// Rho and pi
+		Lanes t = a[1];
+		x = 0;
+		REPEAT24(b[0] = a[pi[x]];
+				a[pi[x]] = rol(t, rho[x]);
+				t = b[0];
+				x++; )
+		// Chi
+		FOR5(uint8_t,
+			y,
+			5,
+			FOR5(uint8_t, x, 1,
+				b[x] = a[y + x];)
+			FOR5(uint8_t, x, 1,
+				a[y + x] = b[x] ^ ((~b[(x + 1) % 5]) & b[(x + 2) % 5]); ))
+		// Iota
+		a[0] ^= RC[i];
+	}
+}
+
+/// Hashes up to as many inputs as there are lanes. All inputs have to need the same
+/// number of permutations.
+template<typename Lanes, size_t laneCount>
+__attribute__((always_inline)) inline void keccak256Lanes(
+	bytesConstRef const* const* _inputs,
+	h256* const* _outputs,
+	size_t _count
+)
+{
+	Lanes a[25] = {};
+	size_t const blocks = keccak256Blocks(_inputs[0]->size());
+	uint8_t lastBlock[keccak256Rate];
+	// Input words of the current block, transposed into lanes.
+	uint64_t words[keccak256Rate / 8][laneCount] = {};
+	for (size_t block = 0; block < blocks; block++)
+	{
+		for (size_t lane = 0; lane < _count; lane++)
+		{
+			bytesConstRef const& input = *_inputs[lane];
+			uint8_t const* data = input.data() + block * keccak256Rate;
+			if (block + 1 == blocks)
+			{
+				// Pad the remaining input with the keccak delimiter and the final bit.
+				size_t remaining = input.size() - block * keccak256Rate;
+				memset(lastBlock, 0, keccak256Rate);
+				if (remaining > 0)
+					memcpy(lastBlock, data, remaining);
+				lastBlock[remaining] ^= 0x01;
+				lastBlock[keccak256Rate - 1] ^= 0x80;
+				data = lastBlock;
+			}
+			for (size_t word = 0; word < keccak256Rate / 8; word++)
+				memcpy(&words[word][lane], data + word * 8, 8);
+		}
+		for (size_t word = 0; word < keccak256Rate / 8; word++)
+		{
+			Lanes value;
+			memcpy(&value, words[word], sizeof(Lanes));
+			a[word] ^= value;
+		}
+		keccakfLanes(a);
+	}
+	for (size_t lane = 0; lane < _count; lane++)
+		for (size_t word = 0; word < 4; word++)
+		{
+			uint64_t value = a[word][lane];
+			memcpy(_outputs[lane]->data() + word * 8, &value, 8);
+		}
+}
+
+__attribute__((target("avx2"))) void keccak256x4(bytesConstRef const* const* _inputs, h256* const* _outputs, size_t _count)
+{
+	keccak256Lanes<Lanes4, 4>(_inputs, _outputs, _count);
+}
+
+__attribute__((target("avx512f"))) void keccak256x8(bytesConstRef const* const* _inputs, h256* const* _outputs, size_t _count)
+{
+	keccak256Lanes<Lanes8, 8>(_inputs, _outputs, _count);
+}
+
+size_t detectLanes()
+{
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f"))
+		return 8;
+	else if (__builtin_cpu_supports("avx2"))
+		return 4;
+	else
+		return 1;
+}
+#endif
+
 }
 
 h256 keccak256(bytesConstRef _input)
@@ -176,8 +310,76 @@ h256 keccak256(bytesConstRef _input)
 	// The 0x01 is the specific padding for keccak (sha3 uses 0x06) and
 	// the way the round size (or window or whatever it was) is calculated.
 	// 200 - (256 / 4) is the "rate"
-	hash(output.data(), output.size, _input.data(), _input.size(), 200 - (256 / 4), 0x01);
+	hash(output.data(), output.size, _input.data(), _input.size(), keccak256Rate, 0x01);
 	return output;
 }
 
+size_t keccak256BatchLanes()
+{
+#ifdef SOLIDITY_KECCAK_MULTIBUFFER
+	static size_t const lanes = detectLanes();
+	return lanes;
+#else
+	return 1;
+#endif
+}
+
+std::vector<h256> keccak256Batch(std::vector<bytesConstRef> const& _inputs, size_t _maxLanes)
+{
+	std::vector<h256> outputs(_inputs.size());
+	size_t const lanes = std::min(keccak256BatchLanes(), _maxLanes);
+	if (lanes <= 1)
+	{
+		for (size_t i = 0; i < _inputs.size(); i++)
+			outputs[i] = keccak256(_inputs[i]);
+		return outputs;
+	}
+
+#ifdef SOLIDITY_KECCAK_MULTIBUFFER
+	// Group the inputs by the number of permutations they need, so that the lanes
+	// hashed together finish at the same time.
+	std::vector<size_t> order(_inputs.size());
+	std::iota(order.begin(), order.end(), 0);
+	std::stable_sort(order.begin(), order.end(), [&](size_t _a, size_t _b) {
+		return keccak256Blocks(_inputs[_a].size()) < keccak256Blocks(_inputs[_b].size());
+	});
+
+	bytesConstRef const* inputs[8];
+	h256* outputPointers[8];
+	for (size_t begin = 0; begin < order.size();)
+	{
+		size_t const blocks = keccak256Blocks(_inputs[order[begin]].size());
+		size_t count = 0;
+		while (
+			count < lanes &&
+			begin + count < order.size() &&
+			keccak256Blocks(_inputs[order[begin + count]].size()) == blocks
+		)
+		{
+			inputs[count] = &_inputs[order[begin + count]];
+			outputPointers[count] = &outputs[order[begin + count]];
+			count++;
+		}
+
+		if (count == 1)
+			*outputPointers[0] = keccak256(*inputs[0]);
+		else if (count > 4)
+			keccak256x8(inputs, outputPointers, count);
+		else
+			keccak256x4(inputs, outputPointers, count);
+		begin += count;
+	}
+#endif
+	return outputs;
+}
+
+std::vector<h256> keccak256Batch(std::vector<std::string> const& _inputs)
+{
+	std::vector<bytesConstRef> inputs;
+	inputs.reserve(_inputs.size());
+	for (std::string const& input: _inputs)
+		inputs.emplace_back(bytesConstRef(input));
+	return keccak256Batch(inputs);
+}
+
 }
@@ -26,7 +26,9 @@
 
 #include <libsolutil/FixedHash.h>
 
+#include <limits>
 #include <string>
+#include <vector>
 
 namespace solidity::util
 {
@@ -43,4 +45,20 @@ inline h256 keccak256(std::string const& _input) { return keccak256(bytesConstRe
 /// Calculate Keccak-256 hash of the given input (presented as a FixedHash), returns a 256-bit hash.
 template<unsigned N> inline h256 keccak256(FixedHash<N> const& _input) { return keccak256(_input.ref()); }
 
+/// Calculate the Keccak-256 hashes of all given inputs, returning them in the same order.
+/// Inputs that need the same number of permutations are hashed together in SIMD lanes
+/// if the CPU supports AVX2 or AVX-512, which is considerably faster than hashing them
+/// one by one for many short inputs like function signatures.
+/// @param _maxLanes upper bound on the number of inputs hashed together, 1 forces the scalar code.
+std::vector<h256> keccak256Batch(
+	std::vector<bytesConstRef> const& _inputs,
+	size_t _maxLanes = std::numeric_limits<size_t>::max()
+);
+
+/// Calculate the Keccak-256 hashes of all given inputs (presented as binary-filled strings).
+std::vector<h256> keccak256Batch(std::vector<std::string> const& _inputs);
+
+/// @returns the number of inputs keccak256Batch can hash together on this CPU.
+size_t keccak256BatchLanes();
+
 }
@@ -0,0 +1,87 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolutil/Parallel.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace solidity::util;
+
+size_t solidity::util::resolveThreadCount(size_t _jobs)
+{
+	if (_jobs != 0)
+		return _jobs;
+	return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+void solidity::util::parallelFor(size_t _count, size_t _threads, std::function<void(size_t)> const& _task)
+{
+	size_t threadCount = std::min(resolveThreadCount(_threads), _count);
+	if (threadCount <= 1)
+	{
+		for (size_t i = 0; i < _count; ++i)
+			_task(i);
+		return;
+	}
+
+	std::atomic<size_t> nextIndex = 0;
+	std::mutex failureMutex;
+	size_t failedIndex = _count;
+	std::exception_ptr failure;
+
+	auto worker = [&]()
+	{
+		for (size_t i = nextIndex++; i < _count; i = nextIndex++)
+		{
+			{
+				std::lock_guard<std::mutex> lock(failureMutex);
+				if (i > failedIndex)
+					continue;
+			}
+			try
+			{
+				_task(i);
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(failureMutex);
+				if (i < failedIndex)
+				{
+					failedIndex = i;
+					failure = std::current_exception();
+				}
+			}
+		}
+	};
+
+	std::vector<std::thread> workers;
+	workers.reserve(threadCount - 1);
+	for (size_t i = 1; i < threadCount; ++i)
+		workers.emplace_back(worker);
+	worker();
+	for (std::thread& thread: workers)
+		thread.join();
+
+	if (failure)
+		std::rethrow_exception(failure);
+}
@@ -0,0 +1,43 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Minimal helpers for running independent pieces of work on several threads.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace solidity::util
+{
+
+/// @returns the number of threads to use when the user requested @a _jobs threads.
+/// Zero means "as many as there are hardware threads". The result is never zero.
+size_t resolveThreadCount(size_t _jobs);
+
+/// Invokes @a _task once for every index in the range [0, @a _count) using up to @a _threads
+/// worker threads. Indices are handed out in increasing order. If @a _threads or @a _count is
+/// at most one, all tasks run sequentially on the calling thread.
+///
+/// If some invocations throw, tasks with higher indices than the lowest failed one are skipped
+/// and, once all workers are done, the exception of the lowest failed index is rethrown.
+/// This way the observable failure does not depend on thread scheduling.
+void parallelFor(size_t _count, size_t _threads, std::function<void(size_t)> const& _task);
+
+}
@@ -26,14 +26,36 @@
 
 #include <libsolutil/Assertions.h>
 
-#include <regex>
+#include <algorithm>
+#include <mutex>
+#include <string_view>
 
 using namespace solidity::util;
 
+struct Whiskers::CompiledTemplate
+{
+	enum class Kind { Text, Parameter, List, Condition };
+	struct Element
+	{
+		Kind kind;
+		/// Text for Kind::Text, name of the parameter, list or condition otherwise.
+		/// Names of conditional value parameters start with "+".
+		std::string value;
+		/// Part between the tags of a list, or the first part of a condition.
+		std::unique_ptr<CompiledTemplate> body;
+		/// Second part of a condition.
+		std::unique_ptr<CompiledTemplate> elseBody;
+	};
+
+	/// Source text, used in error messages.
+	std::string source;
+	std::vector<Element> elements;
+};
+
 Whiskers::Whiskers(std::string _template):
-	m_template(std::move(_template))
+	m_template(std::move(_template)),
+	m_compiled(compile(m_template))
 {
-	checkTemplateValid();
 }
 
 Whiskers& Whiskers::operator()(std::string _parameter, std::string _value)
@@ -71,25 +93,40 @@ Whiskers& Whiskers::operator()(
 
 std::string Whiskers::render() const
 {
-	return replace(m_template, m_parameters, m_conditions, m_listParameters);
+	std::string result;
+	render(*m_compiled, m_parameters, nullptr, m_conditions, &m_listParameters, result);
+	return result;
 }
 
-void Whiskers::checkTemplateValid() const
+void Whiskers::checkTemplateValid(std::string const& _template)
 {
-	std::regex validTemplate("<[#?!\\/]\\+{0,1}[a-zA-Z0-9_$-]+(?:[^a-zA-Z0-9_$>-]|$)");
-	std::smatch match;
-	assertThrow(
-		!regex_search(m_template, match, validTemplate),
-		WhiskersError,
-		"Template contains an invalid/unclosed tag " + match.str()
-	);
+	// Looks for "<" followed by one of "#?!/", an optional "+" and a parameter name
+	// that is not terminated by ">".
+	for (size_t start = _template.find('<'); start != std::string::npos; start = _template.find('<', start + 1))
+	{
+		size_t pos = start + 1;
+		if (pos == _template.size() || std::string_view("#?!/").find(_template[pos]) == std::string_view::npos)
+			continue;
+		++pos;
+		if (pos < _template.size() && _template[pos] == '+')
+			++pos;
+		size_t nameStart = pos;
+		while (pos < _template.size() && isParameterCharacter(_template[pos]))
+			++pos;
+		if (pos == nameStart || (pos < _template.size() && _template[pos] == '>'))
+			continue;
+		assertThrow(
+			false,
+			WhiskersError,
+			"Template contains an invalid/unclosed tag " + _template.substr(start, pos + 1 - start)
+		);
+	}
 }
 
 void Whiskers::checkParameterValid(std::string const& _parameter) const
 {
-	static std::regex validParam("^" + paramRegex() + "$");
 	assertThrow(
-		regex_match(_parameter, validParam),
+		!_parameter.empty() && std::all_of(_parameter.begin(), _parameter.end(), isParameterCharacter),
 		WhiskersError,
 		"Parameter" + _parameter + " contains invalid characters."
 	);
@@ -127,117 +164,215 @@ void Whiskers::checkTemplateContainsTags(std::string const& _parameter, std::vec
 	}
 }
 
-namespace
+bool Whiskers::isParameterCharacter(char _c)
 {
-template<class ReplaceCallback>
-std::string regex_replace(
-	std::string const& _source,
-	std::regex const& _pattern,
-	ReplaceCallback _replace,
-	std::regex_constants::match_flag_type _flags = std::regex_constants::match_default
-)
+	return
+		('a' <= _c && _c <= 'z') ||
+		('A' <= _c && _c <= 'Z') ||
+		('0' <= _c && _c <= '9') ||
+		_c == '_' || _c == '$' || _c == '-';
+}
+
+std::shared_ptr<Whiskers::CompiledTemplate const> Whiskers::compile(std::string const& _template)
 {
-	std::sregex_iterator curMatch(_source.begin(), _source.end(), _pattern, _flags);
-	std::sregex_iterator matchEnd;
-	std::string::const_iterator lastMatchedPos(_source.cbegin());
-	std::string result;
-	while (curMatch != matchEnd)
+	// Almost all templates are string literals in the code generator, so the number of distinct
+	// templates is small. The cache is still bounded in case templates are generated dynamically.
+	static size_t constexpr maxCacheSize = 4096;
+	static std::mutex mutex;
+	static std::map<std::string, std::shared_ptr<CompiledTemplate const>> cache;
+
 	{
-		result.append(curMatch->prefix().first, curMatch->prefix().second);
-		result.append(_replace(*curMatch));
-		lastMatchedPos = (*curMatch)[0].second;
-		++curMatch;
+		std::lock_guard<std::mutex> lock(mutex);
+		if (auto it = cache.find(_template); it != cache.end())
+			return it->second;
 	}
-	result.append(lastMatchedPos, _source.cend());
-	return result;
+
+	checkTemplateValid(_template);
+	std::shared_ptr<CompiledTemplate const> compiled = parse(_template);
+
+	std::lock_guard<std::mutex> lock(mutex);
+	if (cache.size() >= maxCacheSize)
+		cache.clear();
+	return cache.emplace(_template, std::move(compiled)).first->second;
 }
+
+std::unique_ptr<Whiskers::CompiledTemplate> Whiskers::parse(std::string _template)
+{
+	auto result = std::make_unique<CompiledTemplate>();
+	std::string const& source = result->source = std::move(_template);
+
+	auto parameterEnd = [&](size_t _pos) {
+		while (_pos < source.size() && isParameterCharacter(source[_pos]))
+			++_pos;
+		return _pos;
+	};
+	auto addText = [&](size_t _begin, size_t _end) {
+		if (_begin < _end)
+			result->elements.push_back({CompiledTemplate::Kind::Text, source.substr(_begin, _end - _begin), {}, {}});
+	};
+
+	// Tags that cannot be matched are kept as text.
+	size_t textStart = 0;
+	for (size_t start = source.find('<'); start != std::string::npos; start = source.find('<', start + 1))
+	{
+		size_t pos = start + 1;
+		if (pos == source.size())
+			break;
+		if (isParameterCharacter(source[pos]))
+		{
+			// <name>
+			size_t nameEnd = parameterEnd(pos);
+			if (nameEnd == source.size() || source[nameEnd] != '>')
+				continue;
+			addText(textStart, start);
+			result->elements.push_back({CompiledTemplate::Kind::Parameter, source.substr(pos, nameEnd - pos), {}, {}});
+			start = textStart = nameEnd + 1;
+		}
+		else if (source[pos] == '#')
+		{
+			// <#name>...</name>
+			size_t nameEnd = parameterEnd(pos + 1);
+			if (nameEnd == pos + 1 || nameEnd == source.size() || source[nameEnd] != '>')
+				continue;
+			std::string name = source.substr(pos + 1, nameEnd - pos - 1);
+			std::string closingTag = "</" + name + ">";
+			size_t closingTagStart = source.find(closingTag, nameEnd + 1);
+			if (closingTagStart == std::string::npos)
+				continue;
+			addText(textStart, start);
+			result->elements.push_back({
+				CompiledTemplate::Kind::List,
+				std::move(name),
+				parse(source.substr(nameEnd + 1, closingTagStart - nameEnd - 1)),
+				{}
+			});
+			start = textStart = closingTagStart + closingTag.size();
+		}
+		else if (source[pos] == '?')
+		{
+			// <?name>...<!name>...</name> or <?+name>...<!+name>...</+name>, the else part is optional.
+			size_t nameStart = pos + 1;
+			if (nameStart < source.size() && source[nameStart] == '+')
+				++nameStart;
+			size_t nameEnd = parameterEnd(nameStart);
+			if (nameEnd == nameStart || nameEnd == source.size() || source[nameEnd] != '>')
+				continue;
+			std::string name = source.substr(pos + 1, nameEnd - pos - 1);
+			std::string elseTag = "<!" + name + ">";
+			std::string closingTag = "</" + name + ">";
+			size_t closingTagStart = source.find(closingTag, nameEnd + 1);
+			if (closingTagStart == std::string::npos)
+				continue;
+			size_t elseTagStart = source.find(elseTag, nameEnd + 1);
+			if (elseTagStart > closingTagStart)
+				elseTagStart = closingTagStart;
+			size_t elseStart = std::min(elseTagStart + elseTag.size(), closingTagStart);
+			addText(textStart, start);
+			result->elements.push_back({
+				CompiledTemplate::Kind::Condition,
+				std::move(name),
+				parse(source.substr(nameEnd + 1, elseTagStart - nameEnd - 1)),
+				parse(source.substr(elseStart, closingTagStart - elseStart))
+			});
+			start = textStart = closingTagStart + closingTag.size();
+		}
+		else
+			continue;
+		// The next tag may start right after the current one.
+		if (start == source.size())
+			break;
+		--start;
+	}
+	addText(textStart, source.size());
+	return result;
 }
 
-std::string Whiskers::replace(
-	std::string const& _template,
+void Whiskers::render(
+	CompiledTemplate const& _template,
 	StringMap const& _parameters,
+	StringMap const* _listElement,
 	std::map<std::string, bool> const& _conditions,
-	std::map<std::string, std::vector<StringMap>> const& _listParameters
+	StringListMap const* _listParameters,
+	std::string& _output
 )
 {
-	static std::regex listOrTag(
-		"<(" + paramRegex() + ")>|"
-		"<#(" + paramRegex() + ")>((?:.|\\r|\\n)*?)</\\2>|"
-		"<\\?(\\+?" + paramRegex() + ")>((?:.|\\r|\\n)*?)(<!\\4>((?:.|\\r|\\n)*?))?</\\4>"
-	);
-	return regex_replace(_template, listOrTag, [&](std::match_results<std::string::const_iterator> _match) -> std::string
-	{
-		std::string tagName(_match[1]);
-		std::string listName(_match[2]);
-		std::string conditionName(_match[4]);
-		if (!tagName.empty())
+	auto findParameter = [&](std::string const& _name) -> std::string const* {
+		if (_listElement)
+			if (auto it = _listElement->find(_name); it != _listElement->end())
+				return &it->second;
+		if (auto it = _parameters.find(_name); it != _parameters.end())
+			return &it->second;
+		return nullptr;
+	};
+
+	for (auto const& element: _template.elements)
+		switch (element.kind)
 		{
+		case CompiledTemplate::Kind::Text:
+			_output += element.value;
+			break;
+		case CompiledTemplate::Kind::Parameter:
+		{
+			std::string const* value = findParameter(element.value);
 			assertThrow(
-				_parameters.count(tagName),
+				value,
 				WhiskersError,
-				"Value for tag " + tagName + " not provided.\n" +
+				"Value for tag " + element.value + " not provided.\n" +
 				"Template:\n" +
-				_template
+				_template.source
 			);
-			return _parameters.at(tagName);
+			_output += *value;
+			break;
 		}
-		else if (!listName.empty())
+		case CompiledTemplate::Kind::List:
 		{
-			std::string templ(_match[3]);
 			assertThrow(
-				_listParameters.count(listName),
-				WhiskersError, "List parameter " + listName + " not set."
+				_listParameters && _listParameters->count(element.value),
+				WhiskersError, "List parameter " + element.value + " not set."
 			);
-			std::string replacement;
-			for (auto const& parameters: _listParameters.at(listName))
-				replacement += replace(templ, joinMaps(_parameters, parameters), _conditions);
-			return replacement;
+			for (auto const& listElement: _listParameters->at(element.value))
+			{
+				for (auto const& parameter: listElement)
+					assertThrow(
+						!_parameters.count(parameter.first),
+						WhiskersError,
+						"Parameter collision"
+					);
+				render(*element.body, _parameters, &listElement, _conditions, nullptr, _output);
+			}
+			break;
 		}
-		else
+		case CompiledTemplate::Kind::Condition:
 		{
-			assertThrow(!conditionName.empty(), WhiskersError, "");
 			bool conditionValue = false;
-			if (conditionName[0] == '+')
+			if (element.value[0] == '+')
 			{
-				std::string tag = conditionName.substr(1);
+				std::string tag = element.value.substr(1);
 
-				if (_parameters.count(tag))
-					conditionValue = !_parameters.at(tag).empty();
-				else if (_listParameters.count(tag))
-					conditionValue = !_listParameters.at(tag).empty();
+				if (std::string const* value = findParameter(tag))
+					conditionValue = !value->empty();
+				else if (_listParameters && _listParameters->count(tag))
+					conditionValue = !_listParameters->at(tag).empty();
 				else
 					assertThrow(false, WhiskersError, "Tag " + tag + " used as condition but was not set.");
 			}
 			else
 			{
 				assertThrow(
-					_conditions.count(conditionName),
-					WhiskersError, "Condition parameter " + conditionName + " not set."
+					_conditions.count(element.value),
+					WhiskersError, "Condition parameter " + element.value + " not set."
 				);
-				conditionValue = _conditions.at(conditionName);
+				conditionValue = _conditions.at(element.value);
 			}
-			return replace(
-				conditionValue ? _match[5] : _match[7],
+			render(
+				conditionValue ? *element.body : *element.elseBody,
 				_parameters,
+				_listElement,
 				_conditions,
-				_listParameters
+				_listParameters,
+				_output
 			);
+			break;
+		}
 		}
-	});
-}
-
-Whiskers::StringMap Whiskers::joinMaps(
-	Whiskers::StringMap const& _a,
-	Whiskers::StringMap const& _b
-)
-{
-	Whiskers::StringMap ret = _a;
-	for (auto const& x: _b)
-		assertThrow(
-			ret.insert(x).second,
-			WhiskersError,
-			"Parameter collision"
-		);
-	return ret;
 }
-
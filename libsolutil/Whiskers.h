@@ -28,6 +28,7 @@
 
 #include <string>
 #include <map>
+#include <memory>
 #include <vector>
 
 namespace solidity::util
@@ -67,6 +68,9 @@ DEV_SIMPLE_EXCEPTION(WhiskersError);
  *    Works similar to a conditional parameter where the checked condition is
  *    that the string or list parameter called "name" is non-empty or contains
  *    no elements respectively.
+ *
+ * Templates are parsed only once per distinct template text. The parsed form is cached
+ * and shared by all objects constructed from the same text.
  */
 class Whiskers
 {
@@ -92,7 +96,6 @@ public:
 private:
 	// Prevent implicit cast to bool
 	Whiskers& operator()(std::string _parameter, long long);
-	void checkTemplateValid() const;
 	void checkParameterValid(std::string const& _parameter) const;
 	void checkParameterUnknown(std::string const& _parameter) const;
 
@@ -102,19 +105,31 @@ private:
 	///        like `"<" + element + _parameter + ">"`. Each element of _prefixes is used as a prefix of the tag name.
 	void checkTemplateContainsTags(std::string const& _parameter, std::vector<std::string> const& _prefixes) const;
 
-	static std::string replace(
-		std::string const& _template,
+	/// Parsed template: a sequence of text and tags, where the parts between the opening
+	/// and closing tags of conditions and lists are parsed recursively.
+	struct CompiledTemplate;
+
+	/// @returns the parsed form of @a _template, from the cache if it was parsed before.
+	static std::shared_ptr<CompiledTemplate const> compile(std::string const& _template);
+	static std::unique_ptr<CompiledTemplate> parse(std::string _template);
+	/// Throws if @a _template contains a tag that is not closed by ">".
+	static void checkTemplateValid(std::string const& _template);
+
+	/// Appends the expansion of @a _template to @a _output. Inside of lists, @a _listElement
+	/// points to the parameters of the current element and @a _listParameters is null.
+	static void render(
+		CompiledTemplate const& _template,
 		StringMap const& _parameters,
+		StringMap const* _listElement,
 		std::map<std::string, bool> const& _conditions,
-		StringListMap const& _listParameters = StringListMap()
+		StringListMap const* _listParameters,
+		std::string& _output
 	);
 
-	static std::string paramRegex() { return "[a-zA-Z0-9_$-]+"; }
-
-	/// Joins the two maps throwing an exception if two keys are equal.
-	static StringMap joinMaps(StringMap const& _a, StringMap const& _b);
+	static bool isParameterCharacter(char _c);
 
 	std::string m_template;
+	std::shared_ptr<CompiledTemplate const> m_compiled;
 	StringMap m_parameters;
 	std::map<std::string, bool> m_conditions;
 	StringListMap m_listParameters;
@@ -20,15 +20,18 @@
 
 #include <libyul/AsmAnalysisInfo.h>
 #include <libyul/AsmAnalysis.h>
+#include <libyul/AsmParser.h>
 #include <libyul/AsmPrinter.h>
 #include <libyul/AST.h>
 #include <libyul/Exceptions.h>
+#include <libyul/PersistentObjectCache.h>
 #include <libyul/backends/evm/EVMDialect.h>
 #include <libyul/backends/evm/EVMMetrics.h>
-#include <libyul/optimiser/ASTCopier.h>
 #include <libyul/optimiser/Suite.h>
 
+#include <liblangutil/CharStream.h>
 #include <liblangutil/DebugInfoSelection.h>
+#include <liblangutil/ErrorReporter.h>
 
 #include <libsolutil/Keccak256.h>
 
@@ -83,10 +86,16 @@ void ObjectOptimizer::optimize(Object& _object, Settings const& _settings, bool
 		meter = std::make_unique<GasMeter>(*evmDialect, _isCreation, _settings.expectedExecutionsPerDeployment);
 
 	std::optional<h256> cacheKey = calculateCacheKey(_object.code()->root(), *_object.debugData, _settings, _isCreation);
-	if (cacheKey.has_value() && m_cachedObjects.count(*cacheKey) != 0)
+	if (cacheKey.has_value())
 	{
-		overwriteWithOptimizedObject(*cacheKey, _object);
-		return;
+		std::optional<CachedObject> cachedObject = findCachedObject(*cacheKey);
+		if (!cachedObject)
+			cachedObject = loadPersistedObject(*cacheKey, *_object.debugData, dialect);
+		if (cachedObject)
+		{
+			overwriteWithOptimizedObject(*cachedObject, _object);
+			return;
+		}
 	}
 
 	OptimiserSuite::run(
@@ -104,29 +113,83 @@ void ObjectOptimizer::optimize(Object& _object, Settings const& _settings, bool
 		storeOptimizedObject(*cacheKey, _object, dialect);
 }
 
+size_t ObjectOptimizer::size() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_cachedObjects.size();
+}
+
+std::optional<ObjectOptimizer::CachedObject> ObjectOptimizer::findCachedObject(util::h256 _cacheKey) const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	auto it = m_cachedObjects.find(_cacheKey);
+	if (it == m_cachedObjects.end())
+		return std::nullopt;
+	return it->second;
+}
+
 void ObjectOptimizer::storeOptimizedObject(util::h256 _cacheKey, Object const& _optimizedObject, Dialect const& _dialect)
 {
-	m_cachedObjects[_cacheKey] = CachedObject{
-		std::make_shared<Block>(ASTCopier{}.translate(_optimizedObject.code()->root())),
+	CachedObject cachedObject{
+		_optimizedObject.code(),
 		&_dialect,
 	};
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_cachedObjects[_cacheKey] = cachedObject;
+	}
+
+	if (m_persistentCache && _optimizedObject.debugData->sourceNames.has_value())
+		m_persistentCache->store(
+			_cacheKey,
+			AsmPrinter(_optimizedObject.debugData->sourceNames, DebugInfoSelection::All())(cachedObject.optimizedAST->root())
+		);
 }
 
-void ObjectOptimizer::overwriteWithOptimizedObject(util::h256 _cacheKey, Object& _object) const
+std::optional<ObjectOptimizer::CachedObject> ObjectOptimizer::loadPersistedObject(
+	util::h256 _cacheKey,
+	ObjectDebugData const& _debugData,
+	Dialect const& _dialect
+)
 {
-	yulAssert(m_cachedObjects.count(_cacheKey) != 0);
-	CachedObject const& cachedObject = m_cachedObjects.at(_cacheKey);
+	if (!m_persistentCache || !_debugData.sourceNames.has_value())
+		return std::nullopt;
+
+	std::optional<std::string> source = m_persistentCache->load(_cacheKey);
+	if (!source.has_value())
+		return std::nullopt;
+
+	// The cache key is derived from the AST printed with all debug info, i.e. the printed form is
+	// assumed to capture everything that matters about the AST. The same holds for the stored code.
+	CharStream charStream(std::move(*source), "");
+	ErrorList errors;
+	ErrorReporter errorReporter(errors);
+	std::unique_ptr<AST> ast = Parser(errorReporter, _dialect, _debugData.sourceNames).parse(charStream);
+	if (!ast || errorReporter.hasErrors())
+		return std::nullopt;
+
+	CachedObject cachedObject{
+		std::move(ast),
+		&_dialect,
+	};
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_cachedObjects.emplace(_cacheKey, std::move(cachedObject)).first->second;
+}
 
-	yulAssert(cachedObject.optimizedAST);
-	_object.setCode(std::make_shared<AST>(ASTCopier{}.translate(*cachedObject.optimizedAST)));
+void ObjectOptimizer::overwriteWithOptimizedObject(CachedObject const& _cachedObject, Object& _object)
+{
+	yulAssert(_cachedObject.optimizedAST);
+	// The AST is immutable, so there is no need to copy it. The optimizer copies it anyway before
+	// transforming it and later stages replace it via setCode() instead of modifying it.
+	_object.setCode(_cachedObject.optimizedAST);
 	yulAssert(_object.code());
 
-	// There's no point in caching AnalysisInfo because it references AST nodes. It can't be shared
-	// by multiple ASTs and it's easier to recalculate it than properly clone it.
-	yulAssert(cachedObject.dialect);
+	// AnalysisInfo is still recomputed because the analysis also checks the code against the data
+	// and sub-objects of the object it is restored into.
+	yulAssert(_cachedObject.dialect);
 	_object.analysisInfo = std::make_shared<AsmAnalysisInfo>(
 		AsmAnalyzer::analyzeStrictAssertCorrect(
-			*cachedObject.dialect,
+			*_cachedObject.dialect,
 			_object
 		)
 	);
@@ -159,7 +222,8 @@ std::optional<h256> ObjectOptimizer::calculateCacheKey(
 	rawKey += FixedHash<1>(uint8_t(_isCreation ? 0 : 1)).asBytes();
 	rawKey += keccak256(_settings.evmVersion.name()).asBytes();
 	yulAssert(!_settings.eofVersion.has_value() || *_settings.eofVersion > 0);
-	rawKey += FixedHash<1>(uint8_t(_settings.eofVersion ? 0 : *_settings.eofVersion)).asBytes();
+	// Zero stands for legacy code, so that it cannot collide with any EOF version.
+	rawKey += h256(u256(_settings.eofVersion ? *_settings.eofVersion + 1 : 0)).asBytes();
 	rawKey += keccak256(_settings.yulOptimiserSteps).asBytes();
 	rawKey += keccak256(_settings.yulOptimiserCleanupSteps).asBytes();
 
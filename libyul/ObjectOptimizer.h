@@ -27,6 +27,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 
 namespace solidity::yul
@@ -38,6 +39,8 @@ enum class Language
 	StrictAssembly,
 };
 
+class PersistentObjectCache;
+
 Dialect const& languageToDialect(Language _language, langutil::EVMVersion _version, std::optional<uint8_t> _eofVersion);
 
 /// Encapsulates logic for applying @a yul::OptimiserSuite to a whole hierarchy of Yul objects.
@@ -71,19 +74,32 @@ public:
 	/// @warning Does not ensure that nativeLocations in the resulting AST match the optimized code.
 	void optimize(Object& _object, Settings const& _settings);
 
-	size_t size() const { return m_cachedObjects.size(); }
+	/// Makes the optimizer also look up optimized objects in @a _cache and store them there.
+	/// Only objects with source names in their debug data are persisted. Others do not have their
+	/// debug information fully expressible in the stored Yul code.
+	void setPersistentCache(std::shared_ptr<PersistentObjectCache> _cache) { m_persistentCache = std::move(_cache); }
+
+	size_t size() const;
 
 private:
 	struct CachedObject
 	{
-		std::shared_ptr<Block const> optimizedAST;
+		/// The optimized code. Shared with the objects it was stored from or restored into,
+		/// which is safe because ASTs are immutable once assigned to an object.
+		std::shared_ptr<AST const> optimizedAST;
 		Dialect const* dialect;
 	};
 
 	void optimize(Object& _object, Settings const& _settings, bool _isCreation);
 
+	std::optional<CachedObject> findCachedObject(util::h256 _cacheKey) const;
+	std::optional<CachedObject> loadPersistedObject(
+		util::h256 _cacheKey,
+		ObjectDebugData const& _debugData,
+		Dialect const& _dialect
+	);
 	void storeOptimizedObject(util::h256 _cacheKey, Object const& _optimizedObject, Dialect const& _dialect);
-	void overwriteWithOptimizedObject(util::h256 _cacheKey, Object& _object) const;
+	static void overwriteWithOptimizedObject(CachedObject const& _cachedObject, Object& _object);
 
 	static std::optional<util::h256> calculateCacheKey(
 		Block const& _ast,
@@ -92,7 +108,10 @@ private:
 		bool _isCreation
 	);
 
+	/// Guards @a m_cachedObjects. The cache may be shared by stacks optimizing on different threads.
+	mutable std::mutex m_mutex;
 	std::map<util::h256, CachedObject> m_cachedObjects;
+	std::shared_ptr<PersistentObjectCache> m_persistentCache;
 };
 
 }
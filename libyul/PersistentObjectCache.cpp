@@ -0,0 +1,41 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libyul/PersistentObjectCache.h>
+
+using namespace solidity;
+using namespace solidity::yul;
+
+namespace
+{
+
+/// Has to be incremented whenever the meaning of keys or the format of entries changes,
+/// so that entries written by earlier builds of the same compiler version are ignored.
+std::string const c_formatVersion = "2";
+
+}
+
+PersistentObjectCache::PersistentObjectCache(
+	boost::filesystem::path _directory,
+	size_t _sizeLimit,
+	std::string const& _compilerVersion
+):
+	m_files(std::move(_directory), c_formatVersion + " " + _compilerVersion, ".yul"),
+	m_sizeLimit(_sizeLimit)
+{
+}
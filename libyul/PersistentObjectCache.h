@@ -0,0 +1,63 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#pragma once
+
+#include <libsolutil/FileCache.h>
+
+#include <boost/filesystem.hpp>
+
+#include <cstddef>
+#include <optional>
+#include <string>
+
+namespace solidity::yul
+{
+
+/// On-disk store for optimized Yul code, shared by compiler processes that use the same directory.
+/// Entries are opaque strings addressed by the cache keys computed by @a ObjectOptimizer.
+/// Entries written by a different compiler version or in a different format are never returned.
+/// See @a util::FileCache for the guarantees about concurrent use and I/O errors.
+class PersistentObjectCache
+{
+public:
+	using Statistics = util::FileCache::Statistics;
+
+	/// Creates @a _directory if it does not exist yet.
+	/// @param _sizeLimit maximum total size of all entries in bytes. Enforced only by @a evict().
+	/// @param _compilerVersion becomes a part of every key.
+	/// @throws boost::filesystem::filesystem_error if the directory cannot be created.
+	PersistentObjectCache(boost::filesystem::path _directory, size_t _sizeLimit, std::string const& _compilerVersion);
+
+	/// @returns the content stored under @a _key or nullopt if there is no valid entry.
+	/// Marks the entry as recently used.
+	std::optional<std::string> load(util::h256 const& _key) { return m_files.load(_key); }
+	/// Stores @a _content under @a _key, replacing any existing entry.
+	void store(util::h256 const& _key, std::string const& _content) { m_files.store(_key, _content); }
+	/// Removes the least recently used entries until their total size no longer exceeds the limit.
+	void evict() { m_files.evict(m_sizeLimit); }
+
+	Statistics statistics() const { return m_files.statistics(); }
+	boost::filesystem::path const& directory() const { return m_files.directory(); }
+
+private:
+	util::FileCache m_files;
+	size_t const m_sizeLimit;
+};
+
+}
@@ -30,6 +30,7 @@
 #include <libyul/Object.h>
 #include <libyul/ObjectOptimizer.h>
 #include <libyul/ObjectParser.h>
+#include <libyul/YulString.h>
 
 #include <libsolidity/interface/OptimiserSettings.h>
 
@@ -166,6 +167,9 @@ private:
 
 	void reportUnimplementedFeatureError(langutil::UnimplementedFeatureError const& _error);
 
+	/// Keeps the strings of this stack's code alive while other compilations in the same process
+	/// finish and reset the YulStringRepository. Declared first, so that it is released last.
+	YulStringRepository::CompilationScope m_yulStringScope;
 	Language m_language = Language::Assembly;
 	langutil::EVMVersion m_evmVersion;
 	std::optional<uint8_t> m_eofVersion;
@@ -0,0 +1,137 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libyul/YulString.h>
+
+#include <libyul/Exceptions.h>
+
+using namespace solidity::yul;
+
+YulStringRepository::YulStringRepository()
+{
+	clear();
+}
+
+YulStringRepository::~YulStringRepository()
+{
+	for (auto& chunk: m_chunks)
+		delete[] chunk.load(std::memory_order_relaxed);
+}
+
+size_t YulStringRepository::intern(std::string const& _string, std::uint64_t _hash)
+{
+	Shard& shard = m_shards[_hash % c_shardCount];
+	std::lock_guard<std::mutex> lock(shard.mutex);
+
+	auto range = shard.hashToID.equal_range(_hash);
+	for (auto it = range.first; it != range.second; ++it)
+		if (idToString(it->second) == _string)
+			return it->second;
+
+	size_t id = m_nextID.fetch_add(1, std::memory_order_acq_rel);
+	size_t chunkIndex = id >> c_chunkSizeLog2;
+	yulAssert(chunkIndex < c_maxChunks, "Too many distinct Yul identifiers.");
+	std::string* chunk = m_chunks[chunkIndex].load(std::memory_order_acquire);
+	if (!chunk)
+	{
+		std::lock_guard<std::mutex> allocationLock(m_chunkAllocationMutex);
+		chunk = m_chunks[chunkIndex].load(std::memory_order_relaxed);
+		if (!chunk)
+		{
+			chunk = new std::string[c_chunkSize];
+			m_chunks[chunkIndex].store(chunk, std::memory_order_release);
+		}
+	}
+	// Writing the slot happens before the ID is published, either through the shard
+	// (guarded by its mutex) or through the handle returned to the caller.
+	chunk[id & (c_chunkSize - 1)] = _string;
+	shard.hashToID.emplace(_hash, id);
+	return id;
+}
+
+void YulStringRepository::clear()
+{
+	for (Shard& shard: m_shards)
+		shard.hashToID.clear();
+	for (auto& chunk: m_chunks)
+		delete[] chunk.exchange(nullptr, std::memory_order_acq_rel);
+
+	// The empty string always has ID zero.
+	m_chunks[0].store(new std::string[c_chunkSize], std::memory_order_release);
+	m_shards[emptyHash() % c_shardCount].hashToID.emplace(emptyHash(), 0);
+	m_nextID.store(1, std::memory_order_release);
+}
+
+void YulStringRepository::reset()
+{
+	YulStringRepository& repository = instance();
+	// Holding the lock prevents new compilations from starting while the repository is cleared.
+	std::lock_guard<std::mutex> lock(repository.m_scopeMutex);
+	if (repository.m_activeScopes > 0)
+		repository.m_resetPending = true;
+	else
+		repository.resetWithoutActiveScopes();
+}
+
+void YulStringRepository::resetWithoutActiveScopes()
+{
+	{
+		std::lock_guard<std::mutex> lock(resetCallbacksMutex());
+		for (auto const& cb: resetCallbacks())
+			cb();
+	}
+	clear();
+	m_resetPending = false;
+}
+
+YulStringRepository::ResetCallback::ResetCallback(std::function<void()> _fun)
+{
+	std::lock_guard<std::mutex> lock(YulStringRepository::resetCallbacksMutex());
+	YulStringRepository::resetCallbacks().emplace_back(std::move(_fun));
+}
+
+YulStringRepository::CompilationScope::CompilationScope(bool _resetWhenDone):
+	m_resetWhenDone(_resetWhenDone)
+{
+	YulStringRepository& repository = instance();
+	std::lock_guard<std::mutex> lock(repository.m_scopeMutex);
+	++repository.m_activeScopes;
+}
+
+YulStringRepository::CompilationScope::~CompilationScope()
+{
+	YulStringRepository& repository = instance();
+	std::lock_guard<std::mutex> lock(repository.m_scopeMutex);
+	--repository.m_activeScopes;
+	if (m_resetWhenDone)
+		repository.m_resetPending = true;
+	if (repository.m_activeScopes == 0 && repository.m_resetPending)
+		repository.resetWithoutActiveScopes();
+}
+
+std::vector<std::function<void()>>& YulStringRepository::resetCallbacks()
+{
+	static std::vector<std::function<void()>> callbacks;
+	return callbacks;
+}
+
+std::mutex& YulStringRepository::resetCallbacksMutex()
+{
+	static std::mutex mutex;
+	return mutex;
+}
@@ -23,11 +23,15 @@
 
 #include <fmt/format.h>
 
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <string>
 #include <unordered_map>
-#include <memory>
 #include <vector>
-#include <string>
-#include <functional>
 
 namespace solidity::yul
 {
@@ -36,6 +40,11 @@ namespace solidity::yul
 /// Owns the string data for all YulStrings, which can be referenced by a Handle.
 /// A Handle consists of an ID (that depends on the insertion order of YulStrings and is potentially
 /// non-deterministic) and a deterministic string hash.
+///
+/// The repository is safe to use from multiple threads: interning locks only one of several
+/// shards selected by the string hash and looking up the string of an ID does not lock at all.
+/// Strings are stored in chunks that never move, so references returned by idToString() stay
+/// valid until the repository is reset.
 class YulStringRepository
 {
 public:
@@ -56,17 +65,15 @@ public:
 		if (_string.empty())
 			return { 0, emptyHash() };
 		std::uint64_t h = hash(_string);
-		auto range = m_hashToID.equal_range(h);
-		for (auto it = range.first; it != range.second; ++it)
-			if (*m_strings[it->second] == _string)
-				return Handle{it->second, h};
-		m_strings.emplace_back(std::make_shared<std::string>(_string));
-		size_t id = m_strings.size() - 1;
-		m_hashToID.emplace_hint(range.second, std::make_pair(h, id));
-
-		return Handle{id, h};
+		return Handle{intern(_string, h), h};
+	}
+	std::string const& idToString(size_t _id) const
+	{
+		if (_id >= m_nextID.load(std::memory_order_acquire))
+			throw std::out_of_range("Invalid YulString ID.");
+		std::string const* chunk = m_chunks[_id >> c_chunkSizeLog2].load(std::memory_order_acquire);
+		return chunk[_id & (c_chunkSize - 1)];
 	}
-	std::string const& idToString(size_t _id) const { return *m_strings.at(_id); }
 
 	static std::uint64_t hash(std::string const& v)
 	{
@@ -85,37 +92,75 @@ public:
 	/// Use with care - there cannot be any dangling YulString references.
 	/// If references need to be cleared manually, register the callback via
 	/// resetCallback.
-	static void reset()
-	{
-		for (auto const& cb: resetCallbacks())
-			cb();
-		instance() = YulStringRepository{};
-	}
+	/// If a CompilationScope is active on any thread, clearing is postponed until the last
+	/// active scope ends.
+	static void reset();
 	/// Struct that registers a reset callback as a side-effect of its construction.
 	/// Useful as static local variable to register a reset callback once.
 	struct ResetCallback
 	{
-		ResetCallback(std::function<void()> _fun)
-		{
-			YulStringRepository::resetCallbacks().emplace_back(std::move(_fun));
-		}
+		ResetCallback(std::function<void()> _fun);
 	};
+	/// Marks a compilation that is using YulStrings. Used to make reset() safe in processes
+	/// that run several compilations concurrently: the repository is only cleared once no
+	/// compilation is in progress any more, which reclaims the memory of all of them.
+	/// If @a _resetWhenDone is true, a reset is requested when the scope ends.
+	/// A copy is a scope of its own, so that objects holding a scope as a member stay movable.
+	class CompilationScope
+	{
+	public:
+		explicit CompilationScope(bool _resetWhenDone = false);
+		~CompilationScope();
+		CompilationScope(CompilationScope const& _other): CompilationScope(_other.m_resetWhenDone) {}
+		CompilationScope& operator=(CompilationScope const&) { return *this; }
+	private:
+		bool m_resetWhenDone = false;
+	};
+
+	/// @returns the number of distinct strings currently stored, including the empty string.
+	size_t size() const { return m_nextID.load(std::memory_order_acquire); }
 
 private:
-	YulStringRepository() = default;
-	YulStringRepository(YulStringRepository const&) = delete;
-	YulStringRepository(YulStringRepository&&) = default;
-	YulStringRepository& operator=(YulStringRepository const& _rhs) = delete;
-	YulStringRepository& operator=(YulStringRepository&& _rhs) = default;
+	/// Strings are stored in chunks of fixed size, allocated on demand.
+	static constexpr size_t c_chunkSizeLog2 = 12;
+	static constexpr size_t c_chunkSize = size_t(1) << c_chunkSizeLog2;
+	static constexpr size_t c_maxChunks = size_t(1) << 14;
+	static constexpr size_t c_shardCount = 64;
 
-	static std::vector<std::function<void()>>& resetCallbacks()
+	struct Shard
 	{
-		static std::vector<std::function<void()>> callbacks;
-		return callbacks;
-	}
+		std::mutex mutex;
+		std::unordered_multimap<std::uint64_t, size_t> hashToID;
+	};
+
+	YulStringRepository();
+	~YulStringRepository();
+	YulStringRepository(YulStringRepository const&) = delete;
+	YulStringRepository& operator=(YulStringRepository const& _rhs) = delete;
 
-	std::vector<std::shared_ptr<std::string>> m_strings = {std::make_shared<std::string>()};
-	std::unordered_multimap<std::uint64_t, size_t> m_hashToID = {{emptyHash(), 0}};
+	/// @returns the ID of @a _string with hash @a _hash, adding it to the repository if necessary.
+	size_t intern(std::string const& _string, std::uint64_t _hash);
+	/// Releases all strings and re-inserts the empty string. Must not run concurrently
+	/// with any other use of the repository.
+	void clear();
+	/// Invokes the reset callbacks and clears the repository.
+	/// Has to be called while holding @a m_scopeMutex with no active CompilationScope.
+	void resetWithoutActiveScopes();
+
+	static std::vector<std::function<void()>>& resetCallbacks();
+	static std::mutex& resetCallbacksMutex();
+
+	std::array<Shard, c_shardCount> m_shards;
+	std::array<std::atomic<std::string*>, c_maxChunks> m_chunks{};
+	/// Guards the allocation of new chunks.
+	std::mutex m_chunkAllocationMutex;
+	std::atomic<size_t> m_nextID{0};
+
+	/// Number of active CompilationScopes and whether a reset was requested while
+	/// any of them was active.
+	std::mutex m_scopeMutex;
+	size_t m_activeScopes = 0;
+	bool m_resetPending = false;
 };
 
 /// Wrapper around handles into the YulString repository.
@@ -156,6 +201,8 @@ public:
 	}
 
 	uint64_t hash() const { return m_handle.hash; }
+	/// IDs are assigned consecutively from zero, so they are suitable as indices into dense tables.
+	size_t id() const { return m_handle.id; }
 
 private:
 	/// Handle of the string. Assumes that the empty string has ID zero.
@@ -31,6 +31,9 @@
 #include <libyul/Utilities.h>
 #include <libyul/backends/evm/AbstractAssembly.h>
 
+#include <boost/algorithm/string/predicate.hpp>
+
+#include <mutex>
 #include <regex>
 
 using namespace std::string_literals;
@@ -365,21 +368,37 @@ EVMDialect::EVMDialect(langutil::EVMVersion _evmVersion, std::optional<uint8_t>
 	m_functions(createBuiltins(_evmVersion, _eofVersion, _objectAccess)),
 	m_reserved(createReservedIdentifiers(_evmVersion))
 {
+	for (auto const& [name, function]: m_functions)
+	{
+		if (name.id() >= m_functionsByID.size())
+			m_functionsByID.resize(name.id() + 1, nullptr);
+		m_functionsByID[name.id()] = &function;
+	}
+
+	m_discardFunction = builtin("pop"_yulname);
+	m_equalityFunction = builtin("eq"_yulname);
+	m_booleanNegationFunction = builtin("iszero"_yulname);
+	m_memoryStoreFunction = builtin("mstore"_yulname);
+	m_memoryLoadFunction = builtin("mload"_yulname);
+	m_storageStoreFunction = builtin("sstore"_yulname);
+	m_storageLoadFunction = builtin("sload"_yulname);
+	m_hashFunction = "keccak256"_yulname;
 }
 
 BuiltinFunctionForEVM const* EVMDialect::builtin(YulName _name) const
 {
-	if (m_objectAccess)
+	if (_name.id() < m_functionsByID.size())
+		if (BuiltinFunctionForEVM const* function = m_functionsByID[_name.id()])
+			return function;
+
+	// Names of verbatim functions never collide with other builtins.
+	if (m_objectAccess && boost::starts_with(_name.str(), "verbatim_"))
 	{
 		std::smatch match;
 		if (regex_match(_name.str(), match, verbatimPattern()))
 			return verbatimFunction(stoul(match[1]), stoul(match[2]));
 	}
-	auto it = m_functions.find(_name);
-	if (it != m_functions.end())
-		return &it->second;
-	else
-		return nullptr;
+	return nullptr;
 }
 
 bool EVMDialect::reservedIdentifier(YulName _name) const
@@ -393,7 +412,12 @@ bool EVMDialect::reservedIdentifier(YulName _name) const
 EVMDialect const& EVMDialect::strictAssemblyForEVM(langutil::EVMVersion _evmVersion, std::optional<uint8_t> _eofVersion)
 {
 	static std::map<std::pair<langutil::EVMVersion, std::optional<uint8_t>>, std::unique_ptr<EVMDialect const>> dialects;
-	static YulStringRepository::ResetCallback callback{[&] { dialects.clear(); }};
+	static std::mutex dialectsMutex;
+	static YulStringRepository::ResetCallback callback{[&] {
+		std::lock_guard<std::mutex> lock(dialectsMutex);
+		dialects.clear();
+	}};
+	std::lock_guard<std::mutex> lock(dialectsMutex);
 	if (!dialects[{_evmVersion, _eofVersion}])
 		dialects[{_evmVersion, _eofVersion}] = std::make_unique<EVMDialect>(_evmVersion, _eofVersion, false);
 	return *dialects[{_evmVersion, _eofVersion}];
@@ -402,7 +426,12 @@ EVMDialect const& EVMDialect::strictAssemblyForEVM(langutil::EVMVersion _evmVers
 EVMDialect const& EVMDialect::strictAssemblyForEVMObjects(langutil::EVMVersion _evmVersion, std::optional<uint8_t> _eofVersion)
 {
 	static std::map<std::pair<langutil::EVMVersion, std::optional<uint8_t>>, std::unique_ptr<EVMDialect const>> dialects;
-	static YulStringRepository::ResetCallback callback{[&] { dialects.clear(); }};
+	static std::mutex dialectsMutex;
+	static YulStringRepository::ResetCallback callback{[&] {
+		std::lock_guard<std::mutex> lock(dialectsMutex);
+		dialects.clear();
+	}};
+	std::lock_guard<std::mutex> lock(dialectsMutex);
 	if (!dialects[{_evmVersion, _eofVersion}])
 		dialects[{_evmVersion, _eofVersion}] = std::make_unique<EVMDialect>(_evmVersion, _eofVersion, true);
 	return *dialects[{_evmVersion, _eofVersion}];
@@ -29,6 +29,7 @@
 
 #include <map>
 #include <set>
+#include <vector>
 
 namespace solidity::yul
 {
@@ -73,14 +74,14 @@ struct EVMDialect: public Dialect
 	/// @returns true if the identifier is reserved. This includes the builtins too.
 	bool reservedIdentifier(YulName _name) const override;
 
-	BuiltinFunctionForEVM const* discardFunction() const override { return builtin("pop"_yulname); }
-	BuiltinFunctionForEVM const* equalityFunction() const override { return builtin("eq"_yulname); }
-	BuiltinFunctionForEVM const* booleanNegationFunction() const override { return builtin("iszero"_yulname); }
-	BuiltinFunctionForEVM const* memoryStoreFunction() const override { return builtin("mstore"_yulname); }
-	BuiltinFunctionForEVM const* memoryLoadFunction() const override { return builtin("mload"_yulname); }
-	BuiltinFunctionForEVM const* storageStoreFunction() const override { return builtin("sstore"_yulname); }
-	BuiltinFunctionForEVM const* storageLoadFunction() const override { return builtin("sload"_yulname); }
-	YulName hashFunction() const override { return "keccak256"_yulname; }
+	BuiltinFunctionForEVM const* discardFunction() const override { return m_discardFunction; }
+	BuiltinFunctionForEVM const* equalityFunction() const override { return m_equalityFunction; }
+	BuiltinFunctionForEVM const* booleanNegationFunction() const override { return m_booleanNegationFunction; }
+	BuiltinFunctionForEVM const* memoryStoreFunction() const override { return m_memoryStoreFunction; }
+	BuiltinFunctionForEVM const* memoryLoadFunction() const override { return m_memoryLoadFunction; }
+	BuiltinFunctionForEVM const* storageStoreFunction() const override { return m_storageStoreFunction; }
+	BuiltinFunctionForEVM const* storageLoadFunction() const override { return m_storageLoadFunction; }
+	YulName hashFunction() const override { return m_hashFunction; }
 
 	static EVMDialect const& strictAssemblyForEVM(langutil::EVMVersion _evmVersion, std::optional<uint8_t> _eofVersion);
 	static EVMDialect const& strictAssemblyForEVMObjects(langutil::EVMVersion _evmVersion, std::optional<uint8_t> _eofVersion);
@@ -99,8 +100,20 @@ protected:
 	langutil::EVMVersion const m_evmVersion;
 	std::optional<uint8_t> m_eofVersion;
 	std::map<YulName, BuiltinFunctionForEVM> m_functions;
+	/// Entries of @a m_functions indexed by the ID of their name, nullptr for other IDs.
+	/// Used by builtin(), which is called for almost every function call by every optimiser step.
+	std::vector<BuiltinFunctionForEVM const*> m_functionsByID;
 	std::map<std::pair<size_t, size_t>, std::shared_ptr<BuiltinFunctionForEVM const>> mutable m_verbatimFunctions;
 	std::set<YulName> m_reserved;
+
+	BuiltinFunctionForEVM const* m_discardFunction = nullptr;
+	BuiltinFunctionForEVM const* m_equalityFunction = nullptr;
+	BuiltinFunctionForEVM const* m_booleanNegationFunction = nullptr;
+	BuiltinFunctionForEVM const* m_memoryStoreFunction = nullptr;
+	BuiltinFunctionForEVM const* m_memoryLoadFunction = nullptr;
+	BuiltinFunctionForEVM const* m_storageStoreFunction = nullptr;
+	BuiltinFunctionForEVM const* m_storageLoadFunction = nullptr;
+	YulName m_hashFunction;
 };
 
 }
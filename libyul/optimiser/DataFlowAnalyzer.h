@@ -24,6 +24,7 @@
 #pragma once
 
 #include <libyul/optimiser/ASTWalker.h>
+#include <libyul/optimiser/JournaledMap.h>
 #include <libyul/optimiser/KnowledgeBase.h>
 #include <libyul/YulName.h>
 #include <libyul/AST.h> // Needed for m_zero below.
@@ -33,7 +34,10 @@
 #include <libsolutil/Common.h>
 
 #include <map>
+#include <optional>
 #include <set>
+#include <unordered_map>
+#include <vector>
 
 namespace solidity::yul
 {
@@ -170,10 +174,19 @@ protected:
 private:
 	struct Environment
 	{
-		std::unordered_map<YulName, YulName> storage;
-		std::unordered_map<YulName, YulName> memory;
+		struct Snapshot
+		{
+			size_t storage;
+			size_t memory;
+			size_t keccak;
+		};
+
+		JournaledMap<std::unordered_map<YulName, YulName>> storage;
+		JournaledMap<std::unordered_map<YulName, YulName>> memory;
 		/// If keccak[s, l] = y then y := keccak256(s, l) occurs in the code.
-		std::map<std::pair<YulName, YulName>, YulName> keccak;
+		JournaledMap<std::map<std::pair<YulName, YulName>, YulName>> keccak;
+
+		Snapshot snapshot() { return {storage.snapshot(), memory.snapshot(), keccak.snapshot()}; }
 	};
 	struct State
 	{
@@ -185,16 +198,11 @@ private:
 		Environment environment;
 	};
 
-	/// Joins knowledge about storage and memory with an older point in the control-flow.
+	/// Joins knowledge about storage and memory with an older point in the control-flow,
+	/// given by a snapshot of the environment taken at that point.
 	/// This only works if the current state is a direct successor of the older point,
-	/// i.e. `_olderState.storage` and `_olderState.memory` cannot have additional changes.
-	/// Does nothing if memory and storage analysis is disabled / ignored.
-	void joinKnowledge(Environment const& _olderEnvironment);
-
-	static void joinKnowledgeHelper(
-		std::unordered_map<YulName, YulName>& _thisData,
-		std::unordered_map<YulName, YulName> const& _olderData
-	);
+	/// i.e. the older storage and memory cannot have additional changes.
+	void joinKnowledge(Environment::Snapshot const& _olderEnvironment);
 
 	State m_state;
 
@@ -46,14 +46,24 @@ using namespace solidity::yul;
 
 void FullInliner::run(OptimiserStepContext& _context, Block& _ast)
 {
-	FullInliner inliner{_ast, _context.dispenser, _context.dialect};
+	FullInliner inliner{
+		_ast,
+		_context.analysisCache.update(_context.dialect, _ast).recursiveFunctions(),
+		_context.dispenser,
+		_context.dialect
+	};
 	inliner.run(Pass::InlineTiny);
 	inliner.run(Pass::InlineRest);
 }
 
-FullInliner::FullInliner(Block& _ast, NameDispenser& _dispenser, Dialect const& _dialect):
+FullInliner::FullInliner(
+	Block& _ast,
+	std::set<YulName> _recursiveFunctions,
+	NameDispenser& _dispenser,
+	Dialect const& _dialect
+):
 	m_ast(_ast),
-	m_recursiveFunctions(CallGraphGenerator::callGraph(_ast).recursiveFunctions()),
+	m_recursiveFunctions(std::move(_recursiveFunctions)),
 	m_nameDispenser(_dispenser),
 	m_dialect(_dialect)
 {
@@ -293,6 +303,12 @@ std::vector<Statement> InlineModifier::performInline(Statement& _statement, Func
 
 	FunctionDefinition* function = m_driver.function(_funCall.functionName.name);
 	assertThrow(!!function, OptimizerException, "Attempt to inline invalid function.");
+	// Parameters, return variables, the body and at most one assignment per return variable.
+	newStatements.reserve(
+		function->parameters.size() +
+		2 * function->returnVariables.size() +
+		function->body.statements.size()
+	);
 
 	m_driver.tentativelyUpdateCodeSize(function->name, m_currentFunction);
 
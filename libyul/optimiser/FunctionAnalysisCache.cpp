@@ -0,0 +1,307 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libyul/optimiser/FunctionAnalysisCache.h>
+
+#include <libyul/optimiser/ASTWalker.h>
+#include <libyul/optimiser/Semantics.h>
+#include <libyul/AST.h>
+#include <libyul/ControlFlowSideEffectsCollector.h>
+
+#include <libsolutil/CommonData.h>
+#include <libsolutil/FixedHash.h>
+
+using namespace solidity;
+using namespace solidity::yul;
+using namespace solidity::util;
+
+namespace
+{
+
+/**
+ * Builds the call graph like CallGraphGenerator and, in the same pass, an
+ * unambiguous serialization of everything in the AST except debug data.
+ */
+class FunctionFactsCollector: public ASTWalker
+{
+public:
+	explicit FunctionFactsCollector(size_t _expectedSize)
+	{
+		m_callGraph.functionCalls[YulName{}] = {};
+		m_fingerprint.reserve(_expectedSize);
+	}
+
+	CallGraph& callGraph() { return m_callGraph; }
+	bytes& fingerprint() { return m_fingerprint; }
+
+	using ASTWalker::operator();
+	void operator()(Literal const& _literal) override
+	{
+		appendTag(Tag::Literal);
+		m_fingerprint.push_back(static_cast<uint8_t>(_literal.kind));
+		if (_literal.value.unlimited())
+		{
+			std::string const& value = _literal.value.builtinStringLiteralValue();
+			appendNumber(value.size());
+			m_fingerprint += asBytes(value);
+		}
+		else
+		{
+			appendNumber(h256::size);
+			h256 const value{_literal.value.value()};
+			m_fingerprint.insert(m_fingerprint.end(), value.data(), value.data() + h256::size);
+		}
+	}
+	void operator()(Identifier const& _identifier) override
+	{
+		appendTag(Tag::Identifier);
+		appendNumber(_identifier.name.id());
+	}
+	void operator()(FunctionCall const& _functionCall) override
+	{
+		appendTag(Tag::FunctionCall);
+		appendNumber(_functionCall.functionName.name.id());
+		appendNumber(_functionCall.arguments.size());
+		auto& functionCalls = m_callGraph.functionCalls[m_currentFunction];
+		if (!util::contains(functionCalls, _functionCall.functionName.name))
+			functionCalls.emplace_back(_functionCall.functionName.name);
+		ASTWalker::operator()(_functionCall);
+	}
+	void operator()(ExpressionStatement const& _statement) override
+	{
+		appendTag(Tag::ExpressionStatement);
+		ASTWalker::operator()(_statement);
+	}
+	void operator()(Assignment const& _assignment) override
+	{
+		appendTag(Tag::Assignment);
+		appendNumber(_assignment.variableNames.size());
+		ASTWalker::operator()(_assignment);
+	}
+	void operator()(VariableDeclaration const& _varDecl) override
+	{
+		appendTag(Tag::VariableDeclaration);
+		appendNames(_varDecl.variables);
+		m_fingerprint.push_back(_varDecl.value ? 1 : 0);
+		ASTWalker::operator()(_varDecl);
+	}
+	void operator()(If const& _if) override
+	{
+		appendTag(Tag::If);
+		ASTWalker::operator()(_if);
+	}
+	void operator()(Switch const& _switch) override
+	{
+		appendTag(Tag::Switch);
+		appendNumber(_switch.cases.size());
+		for (Case const& _case: _switch.cases)
+			m_fingerprint.push_back(_case.value ? 1 : 0);
+		ASTWalker::operator()(_switch);
+	}
+	void operator()(FunctionDefinition const& _functionDefinition) override
+	{
+		appendTag(Tag::FunctionDefinition);
+		appendNumber(_functionDefinition.name.id());
+		appendNames(_functionDefinition.parameters);
+		appendNames(_functionDefinition.returnVariables);
+
+		YulName previousFunction = m_currentFunction;
+		m_currentFunction = _functionDefinition.name;
+		yulAssert(m_callGraph.functionCalls.count(m_currentFunction) == 0, "");
+		m_callGraph.functionCalls[m_currentFunction] = {};
+		ASTWalker::operator()(_functionDefinition);
+		m_currentFunction = previousFunction;
+	}
+	void operator()(ForLoop const& _forLoop) override
+	{
+		appendTag(Tag::ForLoop);
+		m_callGraph.functionsWithLoops.insert(m_currentFunction);
+		ASTWalker::operator()(_forLoop);
+	}
+	void operator()(Break const&) override { appendTag(Tag::Break); }
+	void operator()(Continue const&) override { appendTag(Tag::Continue); }
+	void operator()(Leave const&) override { appendTag(Tag::Leave); }
+	void operator()(Block const& _block) override
+	{
+		appendTag(Tag::Block);
+		appendNumber(_block.statements.size());
+		ASTWalker::operator()(_block);
+	}
+
+private:
+	enum class Tag: uint8_t
+	{
+		Literal,
+		Identifier,
+		FunctionCall,
+		ExpressionStatement,
+		Assignment,
+		VariableDeclaration,
+		If,
+		Switch,
+		FunctionDefinition,
+		ForLoop,
+		Break,
+		Continue,
+		Leave,
+		Block
+	};
+
+	void appendTag(Tag _tag) { m_fingerprint.push_back(static_cast<uint8_t>(_tag)); }
+	void appendNumber(size_t _value)
+	{
+		for (size_t i = 0; i < sizeof(_value); ++i)
+			m_fingerprint.push_back(static_cast<uint8_t>(_value >> (8 * i)));
+	}
+	void appendNames(NameWithDebugDataList const& _names)
+	{
+		appendNumber(_names.size());
+		for (NameWithDebugData const& name: _names)
+			appendNumber(name.name.id());
+	}
+
+	CallGraph m_callGraph;
+	bytes m_fingerprint;
+	/// The name of the function we are currently visiting during traversal.
+	YulName m_currentFunction;
+};
+
+}
+
+FunctionAnalysisCache& FunctionAnalysisCache::update(Dialect const& _dialect, Block const& _ast)
+{
+	if (m_dialect != &_dialect)
+	{
+		invalidate();
+		m_dialect = &_dialect;
+	}
+	m_ast = &_ast;
+
+	FunctionFactsCollector collector{m_fingerprint.size()};
+	collector(_ast);
+	if (collector.fingerprint() == m_fingerprint)
+		return *this;
+	m_fingerprint = std::move(collector.fingerprint());
+	m_controlFlowSideEffects.reset();
+
+	CallGraph& callGraph = collector.callGraph();
+	auto hasLoops = [](CallGraph const& _graph, YulName _function) {
+		return _graph.functionsWithLoops.count(_function) > 0;
+	};
+	bool callsChanged = false;
+	for (auto const& [function, calls]: callGraph.functionCalls)
+	{
+		auto previous = m_callGraph.functionCalls.find(function);
+		if (
+			previous == m_callGraph.functionCalls.end() ||
+			previous->second != calls ||
+			hasLoops(m_callGraph, function) != hasLoops(callGraph, function)
+		)
+		{
+			m_changedFunctions.insert(function);
+			callsChanged = true;
+		}
+	}
+	for (auto const& previous: m_callGraph.functionCalls)
+		if (!callGraph.functionCalls.count(previous.first))
+		{
+			m_changedFunctions.insert(previous.first);
+			callsChanged = true;
+		}
+	if (callsChanged)
+		m_recursiveFunctions.reset();
+
+	m_callGraph = std::move(callGraph);
+	return *this;
+}
+
+std::set<YulName> const& FunctionAnalysisCache::recursiveFunctions()
+{
+	yulAssert(m_ast, "Analysis cache not initialized.");
+	if (!m_recursiveFunctions)
+		m_recursiveFunctions = m_callGraph.recursiveFunctions();
+	return *m_recursiveFunctions;
+}
+
+std::map<YulName, SideEffects> const& FunctionAnalysisCache::functionSideEffects()
+{
+	yulAssert(m_ast, "Analysis cache not initialized.");
+	if (!m_functionSideEffects)
+	{
+		m_functionSideEffects = SideEffectsPropagator::sideEffects(*m_dialect, m_callGraph);
+		m_changedFunctions.clear();
+		return *m_functionSideEffects;
+	}
+	if (m_changedFunctions.empty())
+		return *m_functionSideEffects;
+
+	// The side effects of a function only depend on the functions it can reach, so only
+	// the functions that can reach a changed one have to be recomputed. If a call to a
+	// function was removed, the function that contained the call has itself changed
+	// and is still reachable.
+	std::map<YulName, std::vector<YulName>> callers;
+	for (auto const& [caller, callees]: m_callGraph.functionCalls)
+		for (YulName callee: callees)
+			callers[callee].emplace_back(caller);
+
+	std::set<YulName> outdated;
+	std::vector<YulName> toVisit(m_changedFunctions.begin(), m_changedFunctions.end());
+	while (!toVisit.empty())
+	{
+		YulName function = toVisit.back();
+		toVisit.pop_back();
+		if (!outdated.insert(function).second)
+			continue;
+		if (auto it = callers.find(function); it != callers.end())
+			toVisit += it->second;
+	}
+
+	std::set<YulName> const nonMovableFunctions = m_callGraph.functionsWithLoops + recursiveFunctions();
+	for (YulName function: outdated)
+		if (m_callGraph.functionCalls.count(function))
+			(*m_functionSideEffects)[function] = SideEffectsPropagator::sideEffects(
+				function,
+				*m_dialect,
+				m_callGraph,
+				nonMovableFunctions
+			);
+		else
+			m_functionSideEffects->erase(function);
+	m_changedFunctions.clear();
+	return *m_functionSideEffects;
+}
+
+std::map<YulName, ControlFlowSideEffects> const& FunctionAnalysisCache::controlFlowSideEffects()
+{
+	yulAssert(m_ast, "Analysis cache not initialized.");
+	if (!m_controlFlowSideEffects)
+		m_controlFlowSideEffects = ControlFlowSideEffectsCollector{*m_dialect, *m_ast}.functionSideEffectsNamed();
+	return *m_controlFlowSideEffects;
+}
+
+void FunctionAnalysisCache::invalidate()
+{
+	m_dialect = nullptr;
+	m_ast = nullptr;
+	m_fingerprint.clear();
+	m_callGraph = {};
+	m_changedFunctions.clear();
+	m_recursiveFunctions.reset();
+	m_functionSideEffects.reset();
+	m_controlFlowSideEffects.reset();
+}
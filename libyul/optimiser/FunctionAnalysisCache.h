@@ -0,0 +1,81 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Cache for analyses of user-defined functions that are shared between optimiser steps.
+ */
+
+#pragma once
+
+#include <libyul/ControlFlowSideEffects.h>
+#include <libyul/SideEffects.h>
+#include <libyul/optimiser/CallGraphGenerator.h>
+
+#include <libsolutil/Common.h>
+
+#include <map>
+#include <optional>
+#include <set>
+
+namespace solidity::yul
+{
+
+struct Dialect;
+struct Block;
+
+/**
+ * Caches the call graph, the side effects and the control-flow side effects of the
+ * user-defined functions of an AST, so that consecutive optimiser steps do not have
+ * to recompute them if the functions did not change in between.
+ *
+ * Steps do not have to report their modifications: ``update`` collects the direct calls
+ * and loops of all functions in a single pass over the AST and compares them to the
+ * previous state. Side effects are recomputed only for the functions that can reach a
+ * function whose calls or loops changed. Control-flow side effects are reused only if
+ * the AST did not change at all.
+ *
+ * Requires the AST to have unique function names.
+ */
+class FunctionAnalysisCache
+{
+public:
+	/// Brings the cache up to date with @a _ast. The accessors refer to this AST and
+	/// must not be used after it was modified.
+	FunctionAnalysisCache& update(Dialect const& _dialect, Block const& _ast);
+
+	CallGraph const& callGraph() const { return m_callGraph; }
+	std::set<YulName> const& recursiveFunctions();
+	std::map<YulName, SideEffects> const& functionSideEffects();
+	std::map<YulName, ControlFlowSideEffects> const& controlFlowSideEffects();
+
+	/// Drops all cached results.
+	void invalidate();
+
+private:
+	Dialect const* m_dialect = nullptr;
+	Block const* m_ast = nullptr;
+	/// Serialized form of the AST passed to the last update, used to detect modifications.
+	bytes m_fingerprint;
+	CallGraph m_callGraph;
+	/// Functions whose direct calls or loops changed since the side effects were computed.
+	std::set<YulName> m_changedFunctions;
+	std::optional<std::set<YulName>> m_recursiveFunctions;
+	std::optional<std::map<YulName, SideEffects>> m_functionSideEffects;
+	std::optional<std::map<YulName, ControlFlowSideEffects>> m_controlFlowSideEffects;
+};
+
+}
@@ -0,0 +1,137 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Map that records its changes, so that knowledge from different control-flow paths can be joined.
+ */
+
+#pragma once
+
+#include <libyul/Exceptions.h>
+
+#include <libsolutil/CommonData.h>
+
+#include <cstddef>
+#include <optional>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace solidity::yul
+{
+
+/**
+ * Map that can remember the changes made to it since a given point in time, so that
+ * the knowledge of a control-flow branch can be joined with the knowledge before it
+ * in time proportional to the number of changes in the branch rather than the size of the map.
+ * Changes are only recorded while there is at least one active snapshot.
+ */
+template<typename Map>
+class JournaledMap
+{
+public:
+	using Key = typename Map::key_type;
+	using Value = typename Map::mapped_type;
+
+	Value const* find(Key const& _key) const { return util::valueOrNullptr(m_data, _key); }
+
+	void set(Key const& _key, Value _value)
+	{
+		record(_key);
+		m_data[_key] = std::move(_value);
+	}
+	void erase(Key const& _key)
+	{
+		record(_key);
+		m_data.erase(_key);
+	}
+	/// Removes all entries for which @a _predicate, called with a key-value pair, returns true.
+	template<typename Predicate>
+	void eraseIf(Predicate&& _predicate)
+	{
+		for (auto it = m_data.begin(); it != m_data.end();)
+			if (_predicate(*it))
+			{
+				record(it->first, it->second);
+				it = m_data.erase(it);
+			}
+			else
+				++it;
+	}
+	void clear()
+	{
+		if (m_activeSnapshots > 0)
+			for (auto const& [key, value]: m_data)
+				record(key, value);
+		m_data.clear();
+	}
+
+	/// Starts recording changes. Every call has to be matched by a call to @a joinWith().
+	size_t snapshot()
+	{
+		++m_activeSnapshots;
+		return m_journal.size();
+	}
+	/// Removes entries that did not exist or had a different value at the time of
+	/// the snapshot. Only entries changed since then need to be checked.
+	/// This only works if there were no other changes to the state in the meantime,
+	/// i.e. the current state is a direct successor of the one at the time of the snapshot.
+	void joinWith(size_t _snapshot)
+	{
+		yulAssert(m_activeSnapshots > 0 && _snapshot <= m_journal.size());
+
+		size_t const end = m_journal.size();
+		std::set<Key> visitedKeys;
+		for (size_t i = _snapshot; i < end; ++i)
+		{
+			// Copy since erasing below appends to the journal.
+			auto [key, oldValue] = m_journal[i];
+			// The first change to a key since the snapshot records its value at the time of the snapshot.
+			if (!visitedKeys.insert(key).second)
+				continue;
+			Value const* currentValue = find(key);
+			if (currentValue && (!oldValue || *oldValue != *currentValue))
+				erase(key);
+		}
+
+		if (--m_activeSnapshots == 0)
+			m_journal.clear();
+	}
+
+private:
+	void record(Key const& _key)
+	{
+		if (m_activeSnapshots == 0)
+			return;
+		if (Value const* value = find(_key))
+			m_journal.emplace_back(_key, *value);
+		else
+			m_journal.emplace_back(_key, std::nullopt);
+	}
+	void record(Key const& _key, Value const& _value)
+	{
+		if (m_activeSnapshots > 0)
+			m_journal.emplace_back(_key, _value);
+	}
+
+	Map m_data;
+	/// Keys changed while a snapshot was active, together with their values before the change.
+	std::vector<std::pair<Key, std::optional<Value>>> m_journal;
+	size_t m_activeSnapshots = 0;
+};
+
+}
@@ -19,6 +19,7 @@
 #pragma once
 
 #include <libyul/Exceptions.h>
+#include <libyul/optimiser/FunctionAnalysisCache.h>
 
 #include <optional>
 #include <string>
@@ -38,6 +39,8 @@ struct OptimiserStepContext
 	std::set<YulName> const& reservedIdentifiers;
 	/// The value nullopt represents creation code
 	std::optional<size_t> expectedExecutionsPerDeployment;
+	/// Function analyses shared between the steps run in this context.
+	FunctionAnalysisCache analysisCache{};
 };
 
 
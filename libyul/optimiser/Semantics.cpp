@@ -119,46 +119,58 @@ std::map<YulName, SideEffects> SideEffectsPropagator::sideEffects(
 	Dialect const& _dialect,
 	CallGraph const& _directCallGraph
 )
+{
+	std::set<YulName> const nonMovableFunctions =
+		_directCallGraph.functionsWithLoops + _directCallGraph.recursiveFunctions();
+
+	std::map<YulName, SideEffects> ret;
+	for (auto const& call: _directCallGraph.functionCalls)
+		ret[call.first] = sideEffects(call.first, _dialect, _directCallGraph, nonMovableFunctions);
+	return ret;
+}
+
+SideEffects SideEffectsPropagator::sideEffects(
+	YulName _function,
+	Dialect const& _dialect,
+	CallGraph const& _directCallGraph,
+	std::set<YulName> const& _nonMovableFunctions
+)
 {
 	// Any loop currently makes a function non-movable, because
 	// it could be a non-terminating loop.
 	// The same is true for any function part of a call cycle.
 	// In the future, we should refine that, because the property
 	// is actually a bit different from "not movable".
-
-	std::map<YulName, SideEffects> ret;
-	for (auto const& function: _directCallGraph.functionsWithLoops + _directCallGraph.recursiveFunctions())
-	{
-		ret[function].movable = false;
-		ret[function].canBeRemoved = false;
-		ret[function].canBeRemovedIfNoMSize = false;
-		ret[function].cannotLoop = false;
-	}
-
-	for (auto const& call: _directCallGraph.functionCalls)
-	{
-		YulName funName = call.first;
-		SideEffects sideEffects;
-		auto _visit = [&, visited = std::set<YulName>{}](YulName _function, auto&& _recurse) mutable {
-			if (!visited.insert(_function).second)
-				return;
-			if (sideEffects == SideEffects::worst())
-				return;
-			if (BuiltinFunction const* f = _dialect.builtin(_function))
-				sideEffects += f->sideEffects;
-			else
-			{
-				if (ret.count(_function))
-					sideEffects += ret[_function];
-				for (YulName callee: _directCallGraph.functionCalls.at(_function))
-					_recurse(callee, _recurse);
-			}
-		};
-		for (auto const& _v: call.second)
-			_visit(_v, _visit);
-		ret[funName] += sideEffects;
-	}
-	return ret;
+	auto ownSideEffects = [&](YulName _name) {
+		SideEffects ret;
+		if (_nonMovableFunctions.count(_name))
+		{
+			ret.movable = false;
+			ret.canBeRemoved = false;
+			ret.canBeRemovedIfNoMSize = false;
+			ret.cannotLoop = false;
+		}
+		return ret;
+	};
+
+	SideEffects sideEffects = ownSideEffects(_function);
+	auto _visit = [&, visited = std::set<YulName>{}](YulName _callee, auto&& _recurse) mutable {
+		if (!visited.insert(_callee).second)
+			return;
+		if (sideEffects == SideEffects::worst())
+			return;
+		if (BuiltinFunction const* f = _dialect.builtin(_callee))
+			sideEffects += f->sideEffects;
+		else
+		{
+			sideEffects += ownSideEffects(_callee);
+			for (YulName callee: _directCallGraph.functionCalls.at(_callee))
+				_recurse(callee, _recurse);
+		}
+	};
+	for (YulName callee: _directCallGraph.functionCalls.at(_function))
+		_visit(callee, _visit);
+	return sideEffects;
 }
 
 MovableChecker::MovableChecker(Dialect const& _dialect, Expression const& _expression):
@@ -134,6 +134,14 @@ public:
 		Dialect const& _dialect,
 		CallGraph const& _directCallGraph
 	);
+	/// @returns the side effects of the user-defined function @a _function alone.
+	/// @param _nonMovableFunctions the functions that contain loops or are part of a call cycle.
+	static SideEffects sideEffects(
+		YulName _function,
+		Dialect const& _dialect,
+		CallGraph const& _directCallGraph,
+		std::set<YulName> const& _nonMovableFunctions
+	);
 };
 
 /**
@@ -37,6 +37,58 @@ using namespace solidity::evmasm;
 using namespace solidity::langutil;
 using namespace solidity::yul;
 
+namespace
+{
+
+/// Presents expressions to the rule tree the way Pattern::matches() sees them.
+class ExpressionView
+{
+public:
+	ExpressionView(Dialect const& _dialect, std::function<AssignedValue const*(YulName)> const& _ssaValues):
+		m_dialect(_dialect),
+		m_ssaValues(_ssaValues)
+	{}
+
+	std::optional<u256> constant(Expression const* _expr) const
+	{
+		if (Literal const* literal = std::get_if<Literal>(&resolve(*_expr)))
+			if (literal->kind == LiteralKind::Number)
+				return literal->value.value();
+		return std::nullopt;
+	}
+
+	std::optional<Instruction> operation(Expression const* _expr, std::vector<Expression const*>& _arguments) const
+	{
+		auto instrAndArgs = SimplificationRules::instructionAndArguments(m_dialect, resolve(*_expr));
+		if (!instrAndArgs)
+			return std::nullopt;
+		// Function calls in arguments are never matched, see Pattern::matches().
+		for (Expression const& argument: *instrAndArgs->second)
+			if (std::holds_alternative<FunctionCall>(argument))
+				return std::nullopt;
+		for (Expression const& argument: *instrAndArgs->second)
+			_arguments.push_back(&argument);
+		return instrAndArgs->first;
+	}
+
+private:
+	/// Resolves the variable if possible, just like Pattern::matches() does for patterns
+	/// other than "Any".
+	Expression const& resolve(Expression const& _expr) const
+	{
+		if (Identifier const* identifier = std::get_if<Identifier>(&_expr))
+			if (AssignedValue const* value = m_ssaValues(identifier->name))
+				if (value->value)
+					return *value->value;
+		return _expr;
+	}
+
+	Dialect const& m_dialect;
+	std::function<AssignedValue const*(YulName)> const& m_ssaValues;
+};
+
+}
+
 SimplificationRules::Rule const* SimplificationRules::findFirstMatch(
 	Expression const& _expr,
 	Dialect const& _dialect,
@@ -47,7 +99,8 @@ SimplificationRules::Rule const* SimplificationRules::findFirstMatch(
 	if (!instruction)
 		return nullptr;
 
-	static std::map<std::optional<EVMVersion>, std::unique_ptr<SimplificationRules>> evmRules;
+	// Rules keep the state of the current match, so every thread needs its own copy.
+	thread_local std::map<std::optional<EVMVersion>, std::unique_ptr<SimplificationRules>> evmRules;
 
 	std::optional<EVMVersion> version;
 	if (yul::EVMDialect const* evmDialect = dynamic_cast<yul::EVMDialect const*>(&_dialect))
@@ -59,8 +112,9 @@ SimplificationRules::Rule const* SimplificationRules::findFirstMatch(
 	SimplificationRules& rules = *evmRules[version];
 	assertThrow(rules.isInitialized(), OptimizerException, "Rule list not properly initialized.");
 
-	for (auto const& rule: rules.m_rules[uint8_t(instruction->first)])
+	for (size_t ruleIndex: rules.m_ruleTree.candidates(&_expr, ExpressionView{_dialect, _ssaValues}))
 	{
+		Rule const& rule = rules.m_rules[ruleIndex];
 		rules.resetMatchGroups();
 		if (rule.pattern.matches(_expr, _dialect, _ssaValues))
 			if (!rule.feasible || rule.feasible())
@@ -71,7 +125,7 @@ SimplificationRules::Rule const* SimplificationRules::findFirstMatch(
 
 bool SimplificationRules::isInitialized() const
 {
-	return !m_rules[uint8_t(evmasm::Instruction::ADD)].empty();
+	return !m_rules.empty();
 }
 
 std::optional<std::pair<evmasm::Instruction, std::vector<Expression> const*>>
@@ -94,7 +148,8 @@ void SimplificationRules::addRules(std::vector<Rule> const& _rules)
 
 void SimplificationRules::addRule(Rule const& _rule)
 {
-	m_rules[uint8_t(_rule.pattern.instruction())].push_back(_rule);
+	m_ruleTree.insert(_rule.pattern, m_rules.size());
+	m_rules.push_back(_rule);
 }
 
 SimplificationRules::SimplificationRules(std::optional<langutil::EVMVersion> _evmVersion)
@@ -234,6 +289,20 @@ evmasm::Instruction Pattern::instruction() const
 	return m_instruction;
 }
 
+PatternSymbol Pattern::symbol() const
+{
+	switch (m_kind)
+	{
+	case PatternKind::Any:
+		return {};
+	case PatternKind::Constant:
+		return {PatternSymbol::Kind::Constant, Instruction::STOP, 0, m_data ? std::make_optional(*m_data) : std::nullopt};
+	case PatternKind::Operation:
+		return {PatternSymbol::Kind::Operation, m_instruction, m_arguments.size(), std::nullopt};
+	}
+	util::unreachable();
+}
+
 Expression Pattern::toExpression(langutil::DebugData::ConstPtr const& _debugData, langutil::EVMVersion _evmVersion) const
 {
 	if (matchGroup())
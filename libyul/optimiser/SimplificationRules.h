@@ -22,6 +22,7 @@
 #pragma once
 
 #include <libevmasm/SimplificationRule.h>
+#include <libevmasm/SimplificationRuleTree.h>
 
 #include <libyul/ASTForward.h>
 #include <libyul/YulName.h>
@@ -81,7 +82,9 @@ private:
 	void resetMatchGroups() { m_matchGroups.clear(); }
 
 	std::map<unsigned, Expression const*> m_matchGroups;
-	std::vector<evmasm::SimplificationRule<Pattern>> m_rules[256];
+	std::vector<Rule> m_rules;
+	/// Patterns of all rules, used to find the rules whose patterns fit the shape of an expression.
+	evmasm::SimplificationRuleTree<Pattern, Expression const*> m_ruleTree;
 };
 
 enum class PatternKind
@@ -130,6 +133,7 @@ public:
 	u256 d() const;
 
 	evmasm::Instruction instruction() const;
+	evmasm::PatternSymbol symbol() const;
 
 	/// Turns this pattern into an actual expression. Should only be called
 	/// for patterns resulting from an action, i.e. with match groups assigned.
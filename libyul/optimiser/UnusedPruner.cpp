@@ -35,7 +35,10 @@ using namespace solidity::yul;
 
 void UnusedPruner::run(OptimiserStepContext& _context, Block& _ast)
 {
-	UnusedPruner::runUntilStabilisedOnFullAST(_context.dialect, _ast, _context.reservedIdentifiers);
+	std::map<YulName, SideEffects> functionSideEffects =
+		_context.analysisCache.update(_context.dialect, _ast).functionSideEffects();
+	bool allowMSizeOptimization = !MSizeFinder::containsMSize(_context.dialect, _ast);
+	runUntilStabilised(_context.dialect, _ast, allowMSizeOptimization, &functionSideEffects, _context.reservedIdentifiers);
 	FunctionGrouper::run(_context, _ast);
 }
 
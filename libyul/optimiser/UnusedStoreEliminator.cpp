@@ -28,7 +28,6 @@
 #include <libyul/optimiser/SSAValueTracker.h>
 #include <libyul/optimiser/DataFlowAnalyzer.h>
 #include <libyul/optimiser/KnowledgeBase.h>
-#include <libyul/ControlFlowSideEffectsCollector.h>
 #include <libyul/AST.h>
 
 #include <libyul/backends/evm/EVMDialect.h>
@@ -51,10 +50,8 @@ static std::string const thirtyTwo{"@ 32"};
 
 void UnusedStoreEliminator::run(OptimiserStepContext& _context, Block& _ast)
 {
-	std::map<YulName, SideEffects> functionSideEffects = SideEffectsPropagator::sideEffects(
-		_context.dialect,
-		CallGraphGenerator::callGraph(_ast)
-	);
+	FunctionAnalysisCache& analysis = _context.analysisCache.update(_context.dialect, _ast);
+	std::map<YulName, SideEffects> functionSideEffects = analysis.functionSideEffects();
 
 	SSAValueTracker ssaValues;
 	ssaValues(_ast);
@@ -72,7 +69,7 @@ void UnusedStoreEliminator::run(OptimiserStepContext& _context, Block& _ast)
 	UnusedStoreEliminator rse{
 		_context.dialect,
 		functionSideEffects,
-		ControlFlowSideEffectsCollector{_context.dialect, _ast}.functionSideEffectsNamed(),
+		analysis.controlFlowSideEffects(),
 		values,
 		ignoreMemory
 	};
@@ -37,10 +37,12 @@
 #include <libsolidity/interface/GasEstimator.h>
 #include <libsolidity/interface/DebugSettings.h>
 #include <libsolidity/interface/ImportRemapper.h>
+#include <libsolidity/interface/SMTQueryCache.h>
 #include <libsolidity/interface/StorageLayout.h>
 #include <libsolidity/lsp/LanguageServer.h>
 #include <libsolidity/lsp/Transport.h>
 
+#include <libyul/PersistentObjectCache.h>
 #include <libyul/YulStack.h>
 
 #include <libevmasm/Disassemble.h>
@@ -777,6 +779,11 @@ void CommandLineInterface::processInput()
 			"Support for EVM versions older than constantinople is deprecated and will be removed in the future."
 		);
 
+	if (m_options.optimizer.cacheDir.has_value())
+		openOptimizerCache();
+	if (m_options.modelChecker.cacheDir.has_value())
+		openSMTQueryCache();
+
 	switch (m_options.input.mode)
 	{
 	case InputMode::Help:
@@ -793,7 +800,13 @@ void CommandLineInterface::processInput()
 		solAssert(m_standardJsonInput.has_value());
 
 		StandardCompiler compiler(m_universalCallback.callback(), m_options.formatting.json);
-		sout() << compiler.compile(std::move(m_standardJsonInput.value())) << std::endl;
+		if (m_options.output.streamStandardJson)
+		{
+			compiler.compile(m_standardJsonInput.value(), sout());
+			sout() << std::endl;
+		}
+		else
+			sout() << compiler.compile(std::move(m_standardJsonInput.value())) << std::endl;
 		m_standardJsonInput.reset();
 		break;
 	}
@@ -819,6 +832,90 @@ void CommandLineInterface::processInput()
 		handleEVMAssembly(m_assemblyStack->contractNames().front());
 		break;
 	}
+
+	if (m_optimizerCache)
+		closeOptimizerCache();
+	if (m_smtQueryCache)
+		closeSMTQueryCache();
+}
+
+void CommandLineInterface::openSMTQueryCache()
+{
+	solAssert(m_options.modelChecker.cacheDir.has_value());
+	solAssert(!m_smtQueryCache);
+
+	try
+	{
+		m_smtQueryCache = std::make_shared<SMTQueryCache>(*m_options.modelChecker.cacheDir);
+	}
+	catch (boost::filesystem::filesystem_error const& _exception)
+	{
+		solThrow(
+			CommandLineExecutionError,
+			"Could not create the model checker cache directory " + m_options.modelChecker.cacheDir->string() + ": " + _exception.what()
+		);
+	}
+	m_solverCommand.setQueryCache(m_smtQueryCache);
+}
+
+void CommandLineInterface::closeSMTQueryCache()
+{
+	solAssert(m_smtQueryCache);
+
+	m_solverCommand.setQueryCache(nullptr);
+
+	if (m_options.formatting.verbose)
+	{
+		SMTQueryCache::Statistics const statistics = m_smtQueryCache->statistics();
+		serr() << fmt::format(
+			"Model checker cache: {} hits, {} misses, {} bytes written.",
+			statistics.hits,
+			statistics.misses,
+			statistics.bytesWritten
+		) << std::endl;
+	}
+}
+
+void CommandLineInterface::openOptimizerCache()
+{
+	solAssert(m_options.optimizer.cacheDir.has_value());
+	solAssert(!m_optimizerCache);
+
+	try
+	{
+		m_optimizerCache = std::make_shared<yul::PersistentObjectCache>(
+			*m_options.optimizer.cacheDir,
+			m_options.optimizer.cacheSizeLimit,
+			solidity::frontend::VersionString
+		);
+	}
+	catch (boost::filesystem::filesystem_error const& _exception)
+	{
+		solThrow(
+			CommandLineExecutionError,
+			"Could not create the optimizer cache directory " + m_options.optimizer.cacheDir->string() + ": " + _exception.what()
+		);
+	}
+}
+
+void CommandLineInterface::closeOptimizerCache()
+{
+	solAssert(m_optimizerCache);
+
+	m_optimizerCache->evict();
+
+	if (m_options.formatting.verbose)
+	{
+		yul::PersistentObjectCache::Statistics const statistics = m_optimizerCache->statistics();
+		serr() << fmt::format(
+			"Optimizer cache: {} hits, {} misses, {} bytes read, {} bytes written, {} entries evicted.",
+			statistics.hits,
+			statistics.misses,
+			statistics.bytesRead,
+			statistics.bytesWritten,
+			statistics.evictedEntries
+		) << std::endl;
+	}
 }
 
 void CommandLineInterface::printVersion()
@@ -883,6 +980,9 @@ void CommandLineInterface::compile()
 		m_compiler->setRemappings(m_options.input.remappings);
 		m_compiler->setLibraries(m_options.linker.libraries);
 		m_compiler->setViaIR(m_options.output.viaIR);
+		m_compiler->setParallelism(m_options.output.jobs);
+		if (m_optimizerCache)
+			m_compiler->setPersistentOptimizerCache(m_optimizerCache);
 		m_compiler->setEVMVersion(m_options.output.evmVersion);
 		m_compiler->setEOFVersion(m_options.output.eofVersion);
 		m_compiler->setRevertStringBehaviour(m_options.output.revertStrings);
@@ -1005,7 +1105,7 @@ void CommandLineInterface::handleCombinedJSON()
 			if (m_options.compiler.combinedJsonRequests->generatedSourcesRuntime)
 				contractData[g_strGeneratedSourcesRuntime] = m_compiler->generatedSources(contractName, true);
 			if (m_options.compiler.combinedJsonRequests->signatureHashes)
-				contractData[g_strSignatureHashes] = m_compiler->interfaceSymbols(contractName)["methods"];
+				contractData[g_strSignatureHashes] = m_compiler->methodIdentifiers(contractName);
 			if (m_options.compiler.combinedJsonRequests->natspecDev)
 				contractData[g_strNatspecDev] = m_compiler->natspecDev(contractName);
 			if (m_options.compiler.combinedJsonRequests->natspecUser)
@@ -1225,6 +1325,8 @@ void CommandLineInterface::assembleYul(yul::YulStack::Language _language, yul::Y
 
 	bool successful = true;
 	std::map<std::string, yul::YulStack> yulStacks;
+	auto objectOptimizer = std::make_shared<yul::ObjectOptimizer>();
+	objectOptimizer->setPersistentCache(m_optimizerCache);
 	for (auto const& src: m_fileReader.sourceUnits())
 	{
 		auto& stack = yulStacks[src.first] = yul::YulStack(
@@ -1234,7 +1336,9 @@ void CommandLineInterface::assembleYul(yul::YulStack::Language _language, yul::Y
 			m_options.optimiserSettings(),
 			m_options.output.debugInfoSelection.has_value() ?
 				m_options.output.debugInfoSelection.value() :
-				DebugInfoSelection::Default()
+				DebugInfoSelection::Default(),
+			nullptr /* _soliditySourceProvider */,
+			objectOptimizer
 		);
 
 		if (!stack.parseAndAnalyze(src.first, src.second))
@@ -97,6 +97,17 @@ private:
 
 	void assembleYul(yul::YulStack::Language _language, yul::YulStack::Machine _targetMachine);
 
+	/// Opens the directory requested with --optimizer-cache-dir.
+	/// @throws CommandLineExecutionError if the directory cannot be created.
+	void openOptimizerCache();
+	/// Trims the optimizer cache to its size limit and reports its statistics if requested.
+	void closeOptimizerCache();
+	/// Makes the SMT solver command use the directory requested with --model-checker-cache.
+	/// @throws CommandLineExecutionError if the directory cannot be created.
+	void openSMTQueryCache();
+	/// Detaches the SMT query cache from the solver command and reports its statistics if requested.
+	void closeSMTQueryCache();
+
 	void outputCompilationResults();
 
 	void handleCombinedJSON();
@@ -155,6 +166,8 @@ private:
 	std::unique_ptr<frontend::CompilerStack> m_compiler;
 	std::unique_ptr<evmasm::EVMAssemblyStack> m_evmAssemblyStack;
 	evmasm::AbstractAssemblyStack* m_assemblyStack = nullptr;
+	std::shared_ptr<yul::PersistentObjectCache> m_optimizerCache;
+	std::shared_ptr<SMTQueryCache> m_smtQueryCache;
 	CommandLineOptions m_options;
 };
 
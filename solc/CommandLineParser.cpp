@@ -55,6 +55,7 @@ static std::string const g_strHelp = "help";
 static std::string const g_strImportAst = "import-ast";
 static std::string const g_strImportEvmAssemblerJson = "import-asm-json";
 static std::string const g_strInputFile = "input-file";
+static std::string const g_strJobs = "jobs";
 static std::string const g_strYul = "yul";
 static std::string const g_strYulDialect = "yul-dialect";
 static std::string const g_strDebugInfo = "debug-info";
@@ -67,17 +68,21 @@ static std::string const g_strMachine = "machine";
 static std::string const g_strNoCBORMetadata = "no-cbor-metadata";
 static std::string const g_strMetadataHash = "metadata-hash";
 static std::string const g_strMetadataLiteral = "metadata-literal";
+static std::string const g_strModelCheckerCache = "model-checker-cache";
 static std::string const g_strModelCheckerContracts = "model-checker-contracts";
 static std::string const g_strModelCheckerDivModNoSlacks = "model-checker-div-mod-no-slacks";
 static std::string const g_strModelCheckerEngine = "model-checker-engine";
 static std::string const g_strModelCheckerExtCalls = "model-checker-ext-calls";
 static std::string const g_strModelCheckerInvariants = "model-checker-invariants";
 static std::string const g_strModelCheckerPrintQuery = "model-checker-print-query";
+static std::string const g_strModelCheckerRaceSolvers = "model-checker-race-solvers";
 static std::string const g_strModelCheckerShowProvedSafe = "model-checker-show-proved-safe";
 static std::string const g_strModelCheckerShowUnproved = "model-checker-show-unproved";
 static std::string const g_strModelCheckerShowUnsupported = "model-checker-show-unsupported";
+static std::string const g_strModelCheckerSolverProcesses = "model-checker-solver-processes";
 static std::string const g_strModelCheckerSolvers = "model-checker-solvers";
 static std::string const g_strModelCheckerTargets = "model-checker-targets";
+static std::string const g_strModelCheckerThreads = "model-checker-threads";
 static std::string const g_strModelCheckerTimeout = "model-checker-timeout";
 static std::string const g_strModelCheckerBMCLoopIterations = "model-checker-bmc-loop-iterations";
 static std::string const g_strNone = "none";
@@ -86,11 +91,14 @@ static std::string const g_strNoImportCallback = "no-import-callback";
 static std::string const g_strOptimize = "optimize";
 static std::string const g_strOptimizeRuns = "optimize-runs";
 static std::string const g_strOptimizeYul = "optimize-yul";
+static std::string const g_strOptimizerCacheDir = "optimizer-cache-dir";
+static std::string const g_strOptimizerCacheSize = "optimizer-cache-size";
 static std::string const g_strYulOptimizations = "yul-optimizations";
 static std::string const g_strOutputDir = "output-dir";
 static std::string const g_strOverwrite = "overwrite";
 static std::string const g_strRevertStrings = "revert-strings";
 static std::string const g_strStopAfter = "stop-after";
+static std::string const g_strStreamOutput = "stream-output";
 static std::string const g_strParsing = "parsing";
 
 /// Possible arguments to for --revert-strings
@@ -114,6 +122,7 @@ static std::string const g_strIgnoreMissingFiles = "ignore-missing";
 static std::string const g_strColor = "color";
 static std::string const g_strNoColor = "no-color";
 static std::string const g_strErrorIds = "error-codes";
+static std::string const g_strVerbose = "verbose";
 
 /// Possible arguments to for --machine
 static std::set<std::string> const g_machineArgs
@@ -233,8 +242,10 @@ bool CommandLineOptions::operator==(CommandLineOptions const& _other) const noex
 		input.noImportCallback == _other.input.noImportCallback &&
 		output.dir == _other.output.dir &&
 		output.overwriteFiles == _other.output.overwriteFiles &&
+		output.streamStandardJson == _other.output.streamStandardJson &&
 		output.evmVersion == _other.output.evmVersion &&
 		output.viaIR == _other.output.viaIR &&
+		output.jobs == _other.output.jobs &&
 		output.revertStrings == _other.output.revertStrings &&
 		output.debugInfoSelection == _other.output.debugInfoSelection &&
 		output.stopAfter == _other.output.stopAfter &&
@@ -246,6 +257,7 @@ bool CommandLineOptions::operator==(CommandLineOptions const& _other) const noex
 		formatting.json == _other.formatting.json &&
 		formatting.coloredOutput == _other.formatting.coloredOutput &&
 		formatting.withErrorIds == _other.formatting.withErrorIds &&
+		formatting.verbose == _other.formatting.verbose &&
 		compiler.outputs == _other.compiler.outputs &&
 		compiler.estimateGas == _other.compiler.estimateGas &&
 		compiler.combinedJsonRequests == _other.compiler.combinedJsonRequests &&
@@ -256,7 +268,10 @@ bool CommandLineOptions::operator==(CommandLineOptions const& _other) const noex
 		optimizer.optimizeYul == _other.optimizer.optimizeYul &&
 		optimizer.expectedExecutionsPerDeployment == _other.optimizer.expectedExecutionsPerDeployment &&
 		optimizer.yulSteps == _other.optimizer.yulSteps &&
+		optimizer.cacheDir == _other.optimizer.cacheDir &&
+		optimizer.cacheSizeLimit == _other.optimizer.cacheSizeLimit &&
 		modelChecker.initialize == _other.modelChecker.initialize &&
+		modelChecker.cacheDir == _other.modelChecker.cacheDir &&
 		modelChecker.settings == _other.modelChecker.settings;
 }
 
@@ -632,6 +647,13 @@ General Information)").c_str(),
 			g_strViaIR.c_str(),
 			"Turn on compilation mode via the IR."
 		)
+		(
+			g_strJobs.c_str(),
+			po::value<unsigned>()->value_name("n")->default_value(1),
+			"Maximum number of threads used to optimize the IR of independent contracts and to generate "
+			"their bytecode when compiling via the IR. 0 means one thread per CPU core. "
+			"Does not affect the output."
+		)
 		(
 			g_strRevertStrings.c_str(),
 			po::value<std::string>()->value_name(util::joinHumanReadable(g_revertStringsArgs, ",")),
@@ -659,6 +681,12 @@ General Information)").c_str(),
 			"Switch to Standard JSON input / output mode, ignoring all options. "
 			"It reads from standard input, if no input file was given, otherwise it reads from the provided input file. The result will be written to standard output."
 		)
+		(
+			g_strStreamOutput.c_str(),
+			("Write the output of --" + g_strStandardJSON + " piece by piece as soon as the artifacts of each "
+			"source and contract are available instead of assembling the whole output in memory first. "
+			"The output is the same.").c_str()
+		)
 		(
 			g_strLink.c_str(),
 			("Switch to linker mode, ignoring all options apart from --" + g_strLibraries + " "
@@ -740,6 +768,10 @@ General Information)").c_str(),
 			g_strErrorIds.c_str(),
 			"Output error codes."
 		)
+		(
+			g_strVerbose.c_str(),
+			"Print additional diagnostic information, such as optimizer cache statistics, to the standard error."
+		)
 	;
 	desc.add(outputFormatting);
 
@@ -830,11 +862,31 @@ General Information)").c_str(),
 			po::value<std::string>()->value_name("steps"),
 			"Forces Yul optimizer to use the specified sequence of optimization steps instead of the built-in one."
 		)
+		(
+			g_strOptimizerCacheDir.c_str(),
+			po::value<std::string>()->value_name("path"),
+			"Store the Yul code of optimized objects in the given directory and reuse it in subsequent "
+			"compiler runs. The directory can be shared by concurrently running compiler processes. "
+			"Does not affect the output."
+		)
+		(
+			g_strOptimizerCacheSize.c_str(),
+			po::value<unsigned>()->value_name("MiB")->default_value(1024),
+			("Maximum size of the directory given in --" + g_strOptimizerCacheDir + ". "
+			"Least recently used entries are removed after compilation to stay within the limit.").c_str()
+		)
 	;
 	desc.add(optimizerOptions);
 
 	po::options_description smtCheckerOptions("Model Checker Options");
 	smtCheckerOptions.add_options()
+		(
+			g_strModelCheckerCache.c_str(),
+			po::value<std::string>()->value_name("path"),
+			"Store the responses of SMT solvers in the given directory and reuse them for identical "
+			"queries to the same solver version with the same options in subsequent runs. "
+			"The directory can be shared by concurrently running compiler processes."
+		)
 		(
 			g_strModelCheckerContracts.c_str(),
 			po::value<std::string>()->value_name("default,<source>:<contract>")->default_value("default"),
@@ -869,6 +921,11 @@ General Information)").c_str(),
 			g_strModelCheckerPrintQuery.c_str(),
 			"Print the queries created by the SMTChecker in the SMTLIB2 format."
 		)
+		(
+			g_strModelCheckerRaceSolvers.c_str(),
+			"Run the selected solvers concurrently on each BMC query and use the first answer "
+			"instead of waiting for all solvers and checking that their answers agree."
+		)
 		(
 			g_strModelCheckerShowProvedSafe.c_str(),
 			"Show all targets that were proved safe separately."
@@ -881,6 +938,13 @@ General Information)").c_str(),
 			g_strModelCheckerShowUnsupported.c_str(),
 			"Show all unsupported language features separately."
 		)
+		(
+			g_strModelCheckerSolverProcesses.c_str(),
+			po::value<unsigned>()->value_name("n"),
+			"Keep up to n processes of each solver running between queries instead of starting "
+			"a new process for every query. Only applies to cvc5 and z3. "
+			"A process that does not answer within the timeout is killed and replaced."
+		)
 		(
 			g_strModelCheckerSolvers.c_str(),
 			po::value<std::string>()->value_name("cvc5,eld,z3,smtlib2")->default_value("z3"),
@@ -893,6 +957,13 @@ General Information)").c_str(),
 			"Multiple targets can be selected at the same time, separated by a comma and no spaces."
 			" By default all targets except underflow and overflow are selected."
 		)
+		(
+			g_strModelCheckerThreads.c_str(),
+			po::value<unsigned>()->value_name("n"),
+			"Solve the CHC verification targets of a contract using n threads (default: 1). "
+			"0 means one thread per CPU core. Only applies to the eld and smtlib2 solvers. "
+			"With smtlib2 the SMT callback is invoked concurrently."
+		)
 		(
 			g_strModelCheckerTimeout.c_str(),
 			po::value<unsigned>()->value_name("ms"),
@@ -1004,6 +1075,9 @@ void CommandLineParser::processArgs()
 		// TODO: This should eventually contain all options.
 		{g_strExperimentalViaIR, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strViaIR, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strJobs, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strOptimizerCacheDir, {InputMode::Compiler, InputMode::CompilerWithASTImport, InputMode::Assembler}},
+		{g_strOptimizerCacheSize, {InputMode::Compiler, InputMode::CompilerWithASTImport, InputMode::Assembler}},
 		{g_strMetadataLiteral, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strNoCBORMetadata, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strMetadataHash, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
@@ -1012,14 +1086,19 @@ void CommandLineParser::processArgs()
 		{g_strModelCheckerEngine, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerInvariants, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerPrintQuery, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strModelCheckerRaceSolvers, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerShowProvedSafe, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerShowUnproved, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerShowUnsupported, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strModelCheckerSolverProcesses, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerSolvers, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerTimeout, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerBMCLoopIterations, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerContracts, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
-		{g_strModelCheckerTargets, {InputMode::Compiler, InputMode::CompilerWithASTImport}}
+		{g_strModelCheckerCache, {InputMode::Compiler, InputMode::CompilerWithASTImport, InputMode::StandardJson}},
+		{g_strStreamOutput, {InputMode::StandardJson}},
+		{g_strModelCheckerTargets, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strModelCheckerThreads, {InputMode::Compiler, InputMode::CompilerWithASTImport}}
 	};
 	std::vector<std::string> invalidOptionsForCurrentInputMode;
 	for (auto const& [optionName, inputModes]: validOptionInputModeCombinations)
@@ -1106,6 +1185,7 @@ void CommandLineParser::processArgs()
 	}
 
 	m_options.formatting.withErrorIds = m_args.count(g_strErrorIds);
+	m_options.formatting.verbose = m_args.count(g_strVerbose);
 
 	if (m_args.count(g_strRevertStrings))
 	{
@@ -1141,6 +1221,7 @@ void CommandLineParser::processArgs()
 		m_options.output.dir = m_args.at(g_strOutputDir).as<std::string>();
 
 	m_options.output.overwriteFiles = (m_args.count(g_strOverwrite) > 0);
+	m_options.output.streamStandardJson = (m_args.count(g_strStreamOutput) > 0);
 
 	if (m_args.count(g_strPrettyJson) > 0)
 	{
@@ -1196,6 +1277,14 @@ void CommandLineParser::processArgs()
 
 	parseInputPathsAndRemappings();
 
+	if (m_args.count(g_strModelCheckerCache))
+	{
+		std::string const cacheDir = m_args[g_strModelCheckerCache].as<std::string>();
+		if (cacheDir.empty())
+			solThrow(CommandLineValidationError, "Empty values are not allowed in --" + g_strModelCheckerCache + ".");
+		m_options.modelChecker.cacheDir = cacheDir;
+	}
+
 	if (m_options.input.mode == InputMode::StandardJson)
 		return;
 
@@ -1266,6 +1355,20 @@ void CommandLineParser::processArgs()
 		m_options.optimizer.yulSteps = m_args[g_strYulOptimizations].as<std::string>();
 	}
 
+	if (m_args.count(g_strOptimizerCacheDir))
+	{
+		std::string const cacheDir = m_args[g_strOptimizerCacheDir].as<std::string>();
+		if (cacheDir.empty())
+			solThrow(CommandLineValidationError, "Empty values are not allowed in --" + g_strOptimizerCacheDir + ".");
+		m_options.optimizer.cacheDir = cacheDir;
+	}
+	else if (!m_args[g_strOptimizerCacheSize].defaulted())
+		solThrow(
+			CommandLineValidationError,
+			"Option --" + g_strOptimizerCacheSize + " can only be used together with --" + g_strOptimizerCacheDir + "."
+		);
+	m_options.optimizer.cacheSizeLimit = size_t(m_args[g_strOptimizerCacheSize].as<unsigned>()) * 1024 * 1024;
+
 	if (m_options.input.mode == InputMode::Assembler)
 	{
 		std::vector<std::string> const nonAssemblyModeOptions = {
@@ -1387,6 +1490,9 @@ void CommandLineParser::processArgs()
 		m_options.modelChecker.settings.invariants = *invs;
 	}
 
+	if (m_args.count(g_strModelCheckerRaceSolvers))
+		m_options.modelChecker.settings.raceSolvers = true;
+
 	if (m_args.count(g_strModelCheckerShowProvedSafe))
 		m_options.modelChecker.settings.showProvedSafe = true;
 
@@ -1396,6 +1502,9 @@ void CommandLineParser::processArgs()
 	if (m_args.count(g_strModelCheckerShowUnsupported))
 		m_options.modelChecker.settings.showUnsupported = true;
 
+	if (m_args.count(g_strModelCheckerSolverProcesses))
+		m_options.modelChecker.settings.solverProcesses = m_args[g_strModelCheckerSolverProcesses].as<unsigned>();
+
 	if (m_args.count(g_strModelCheckerSolvers))
 	{
 		std::string solversStr = m_args[g_strModelCheckerSolvers].as<std::string>();
@@ -1421,6 +1530,9 @@ void CommandLineParser::processArgs()
 		m_options.modelChecker.settings.targets = *targets;
 	}
 
+	if (m_args.count(g_strModelCheckerThreads))
+		m_options.modelChecker.settings.threads = m_args[g_strModelCheckerThreads].as<unsigned>();
+
 	if (m_args.count(g_strModelCheckerTimeout))
 		m_options.modelChecker.settings.timeout = m_args[g_strModelCheckerTimeout].as<unsigned>();
 
@@ -1438,13 +1550,17 @@ void CommandLineParser::processArgs()
 		m_args.count(g_strModelCheckerEngine) ||
 		m_args.count(g_strModelCheckerExtCalls) ||
 		m_args.count(g_strModelCheckerInvariants) ||
+		m_args.count(g_strModelCheckerRaceSolvers) ||
 		m_args.count(g_strModelCheckerShowProvedSafe) ||
 		m_args.count(g_strModelCheckerShowUnproved) ||
 		m_args.count(g_strModelCheckerShowUnsupported) ||
+		m_args.count(g_strModelCheckerSolverProcesses) ||
 		m_args.count(g_strModelCheckerSolvers) ||
 		m_args.count(g_strModelCheckerTargets) ||
+		m_args.count(g_strModelCheckerThreads) ||
 		m_args.count(g_strModelCheckerTimeout);
 	m_options.output.viaIR = (m_args.count(g_strExperimentalViaIR) > 0 || m_args.count(g_strViaIR) > 0);
+	m_options.output.jobs = m_args[g_strJobs].as<unsigned>();
 
 	solAssert(
 		m_options.input.mode == InputMode::Compiler ||
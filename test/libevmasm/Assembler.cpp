@@ -31,6 +31,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <string>
 #include <tuple>
@@ -422,6 +423,43 @@ BOOST_AUTO_TEST_CASE(subobject_encode_decode)
 	BOOST_CHECK(assembly.decodeSubPath(assembly.encodeSubPath(subPath)) == subPath);
 }
 
+BOOST_AUTO_TEST_CASE(assembly_item_data)
+{
+	u256 const large = (u256(1) << 64) + 1;
+	AssemblyItem const smallPush(u256(1));
+	AssemblyItem const maxSmallPush(u256(std::numeric_limits<uint64_t>::max()));
+	AssemblyItem const largePush(large);
+	AssemblyItem const maxPush(~u256(0));
+
+	BOOST_CHECK(smallPush.data() == 1);
+	BOOST_CHECK(maxSmallPush.data() == std::numeric_limits<uint64_t>::max());
+	BOOST_CHECK(largePush.data() == large);
+	BOOST_CHECK(maxPush.data() == ~u256(0));
+
+	BOOST_CHECK(largePush == AssemblyItem(large));
+	BOOST_CHECK(largePush != maxPush);
+	BOOST_CHECK(smallPush < maxSmallPush);
+	BOOST_CHECK(maxSmallPush < largePush);
+	BOOST_CHECK(!(largePush < maxSmallPush));
+	BOOST_CHECK(largePush < maxPush);
+	BOOST_CHECK(!(largePush < AssemblyItem(large)));
+
+	AssemblyItem item = smallPush;
+	item.setData(large);
+	BOOST_CHECK(item == largePush);
+	BOOST_CHECK(smallPush.data() == 1);
+	item.setData(1);
+	BOOST_CHECK(item == smallPush);
+
+	AssemblyItem const tag = AssemblyItem(Tag, 7).toSubAssemblyTag(2);
+	BOOST_CHECK(tag.data() > std::numeric_limits<uint64_t>::max());
+	BOOST_CHECK((tag.splitForeignPushTag() == std::pair<size_t, size_t>{2, 7}));
+
+	BOOST_CHECK(!tag.pushedValue());
+	tag.setPushedValue(large);
+	BOOST_CHECK(tag.pushedValue() == large);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -30,6 +30,7 @@
 #include <libevmasm/ControlFlowGraph.h>
 #include <libevmasm/BlockDeduplicator.h>
 #include <libevmasm/Assembly.h>
+#include <libevmasm/ConstantOptimiser.h>
 
 #include <boost/test/unit_test.hpp>
 
@@ -2046,6 +2047,32 @@ BOOST_AUTO_TEST_CASE(inliner_invalid)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(constant_optimiser_code_copy)
+{
+	EVMVersion evmVersion = solidity::test::CommonOptions::get().evmVersion();
+	Assembly assembly{evmVersion, true, std::nullopt, {}};
+	std::vector<u256> const values{
+		u256("0x0123456789abcdeffedcba9876543210f0e1d2c3b4a5968778695a4b3c2d1e0f"),
+		u256("0x1f2e3d4c5b6a79881726354453627180ffeeddccbbaa99887766554433221100"),
+		u256("0x2a3b4c5d6e7f8091a2b3c4d5e6f708192a3b4c5d6e7f8091a2b3c4d5e6f70819"),
+	};
+	for (size_t i = 0; i < 10; ++i)
+		for (u256 const& value: values)
+		{
+			assembly.append(value);
+			assembly.append(Instruction::POP);
+		}
+
+	BOOST_REQUIRE(ConstantOptimisationMethod::optimiseConstants(true, 1, evmVersion, assembly) > 0);
+
+	// The replacements copy the constants from the data section, which has to hold the original values.
+	std::set<bytes> copiedValues;
+	for (AssemblyItem const& item: assembly.codeSections().front().items)
+		if (item.type() == PushData)
+			copiedValues.insert(assembly.data(util::h256(item.data())));
+	BOOST_CHECK(copiedValues == (std::set<bytes>{toBigEndian(values[0]), toBigEndian(values[1]), toBigEndian(values[2])}));
+}
+
 
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -130,6 +130,60 @@ BOOST_AUTO_TEST_CASE(translateLineColumnToPosition)
 	BOOST_CHECK_EQUAL(toPosition(2, 2, "ABC\nDEF\nGHI\n"), 10);
 }
 
+BOOST_AUTO_TEST_CASE(translatePositionToLineColumn)
+{
+	CharStream const stream{"ABC\nDEF\n\nGHI", "source"};
+	auto check = [&](int _position, int _line, int _column) {
+		LineColumn const lineColumn = stream.translatePositionToLineColumn(_position);
+		BOOST_CHECK_EQUAL(lineColumn.line, _line);
+		BOOST_CHECK_EQUAL(lineColumn.column, _column);
+	};
+	check(0, 0, 0);
+	check(2, 0, 2);
+	check(3, 0, 3);
+	check(4, 1, 0);
+	check(7, 1, 3);
+	check(8, 2, 0);
+	check(9, 3, 0);
+	check(12, 3, 3);
+	// Positions past the end are clamped.
+	check(13, 3, 3);
+	check(100, 3, 3);
+
+	LineColumn const empty = CharStream{"", "source"}.translatePositionToLineColumn(0);
+	BOOST_CHECK_EQUAL(empty.line, 0);
+	BOOST_CHECK_EQUAL(empty.column, 0);
+}
+
+BOOST_AUTO_TEST_CASE(translateUTF16LineColumn)
+{
+	auto const unit = CharStream::ColumnUnit::UTF16CodeUnits;
+	// "\u00e4" takes two bytes and one UTF-16 code unit, "\U0001F600" four bytes and two code units.
+	std::string const text = "x\nA\u00e4B\U0001F600C\n";
+	CharStream const stream{text, "source"};
+
+	auto check = [&](int _position, int _column) {
+		LineColumn const lineColumn = stream.translatePositionToLineColumn(_position, unit);
+		BOOST_CHECK_EQUAL(lineColumn.line, 1);
+		BOOST_CHECK_EQUAL(lineColumn.column, _column);
+		BOOST_CHECK_EQUAL(stream.translateLineColumnToPosition(lineColumn, unit), _position);
+		BOOST_CHECK_EQUAL(CharStream::translateLineColumnToPosition(text, lineColumn, unit), _position);
+	};
+	check(2, 0);
+	check(3, 1);
+	check(5, 2);
+	check(6, 3);
+	check(10, 5);
+	check(11, 6);
+
+	BOOST_CHECK_EQUAL(stream.translateLineColumnToPosition(LineColumn{1, 7}, unit), std::nullopt);
+	BOOST_CHECK_EQUAL(stream.translateLineColumnToPosition(LineColumn{2, 0}, unit), 12);
+	BOOST_CHECK_EQUAL(stream.translateLineColumnToPosition(LineColumn{3, 0}, unit), std::nullopt);
+	// Byte columns are unaffected.
+	BOOST_CHECK_EQUAL(stream.translatePositionToLineColumn(10).column, 8);
+	BOOST_CHECK_EQUAL(stream.translateLineColumnToPosition(LineColumn{1, 9}), 11);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -0,0 +1,123 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests comparing CHC solving its verification targets concurrently and sequentially.
+ */
+
+#include <libsolidity/interface/CompilerStack.h>
+#include <libsolidity/interface/SMTSolverCommand.h>
+#include <libsolidity/interface/UniversalCallback.h>
+
+#include <liblangutil/SourceReferenceFormatter.h>
+
+#include <test/libsolidity/util/Common.h>
+#include <test/libsolidity/util/FakeSolver.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace solidity::langutil;
+
+namespace solidity::frontend::test
+{
+
+#if !defined(_WIN32)
+namespace
+{
+
+/// f is analyzed both in C and in D, so each of its assertions is the node of two verification targets.
+/// CHC skips the second one if the first is found to be unsafe.
+std::string const sourceWithSharedTargetNodes = R"(
+	contract C {
+		function f(uint x) internal pure {
+			assert(x > 0);
+			assert(x > 1);
+		}
+		function g(uint x) public pure {
+			f(x);
+			assert(x < 100);
+		}
+	}
+	contract D is C {
+		function h(uint x) public pure {
+			f(x + 2);
+		}
+	}
+)";
+
+struct CHCResult
+{
+	std::vector<std::string> messages;
+	size_t queries = 0;
+};
+
+/// Runs CHC with a fake Eldarica answering @a _answer to each query on @a _threads threads.
+/// @returns the formatted messages of the compiler and the number of queries the solver received.
+CHCResult runCHC(std::string const& _answer, unsigned _threads)
+{
+	// Every query is stored in a file of its own to count the queries.
+	FakeSolver eldarica("eld", "cat > \"$(mktemp \"$(dirname \"$0\")/query.XXXXXX\")\"\necho " + _answer + "\n");
+
+	SMTSolverCommand solverCommand;
+	CompilerStack compiler(UniversalCallback(nullptr, solverCommand).callback());
+	compiler.setSources({{"", withPreamble(sourceWithSharedTargetNodes)}});
+	ModelCheckerSettings settings;
+	settings.engine = ModelCheckerEngine::CHC();
+	settings.solvers = smtutil::SMTSolverChoice::ELD();
+	settings.threads = _threads;
+	compiler.setModelCheckerSettings(settings);
+	BOOST_REQUIRE(compiler.compile(CompilerStack::State::AnalysisSuccessful));
+
+	CHCResult result;
+	for (auto const& error: compiler.errors())
+		result.messages.push_back(SourceReferenceFormatter::formatErrorInformation(*error, compiler));
+	for (auto const& entry: boost::filesystem::directory_iterator(eldarica.directory()))
+		if (entry.path().filename().string().rfind("query.", 0) == 0)
+			++result.queries;
+	return result;
+}
+
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE(SMTCheckerThreadsTest, *boost::unit_test::label("nooptions"))
+
+#if !defined(_WIN32)
+BOOST_AUTO_TEST_CASE(concurrent_targets_match_sequential_targets)
+{
+	// "unsat" means that the error is reachable, "sat" that it is not.
+	for (std::string const answer: {"sat", "unsat"})
+	{
+		CHCResult const sequential = runCHC(answer, 1);
+		CHCResult const concurrent = runCHC(answer, 4);
+		BOOST_TEST(!sequential.messages.empty());
+		BOOST_TEST(concurrent.messages == sequential.messages, boost::test_tools::per_element());
+		BOOST_TEST(concurrent.queries == sequential.queries);
+	}
+
+	// The targets sharing their node with an unsafe target are skipped.
+	BOOST_TEST(runCHC("unsat", 4).queries < runCHC("sat", 4).queries);
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
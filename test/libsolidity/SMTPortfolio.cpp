@@ -0,0 +1,176 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the way SMTPortfolio combines the answers of its solvers.
+ */
+
+#include <libsmtutil/SMTPortfolio.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+
+using namespace solidity::smtutil;
+
+namespace solidity::frontend::test
+{
+
+namespace
+{
+
+class SolverStub: public BMCSolverInterface
+{
+public:
+	explicit SolverStub(CheckResult _result, std::vector<std::string> _values = {}):
+		m_result(_result), m_values(std::move(_values))
+	{}
+
+	void reset() override {}
+	void push() override {}
+	void pop() override {}
+	void declareVariable(std::string const&, SortPointer const&) override {}
+	void addAssertion(Expression const&) override {}
+
+	std::pair<CheckResult, std::vector<std::string>> check(std::vector<Expression> const&) override
+	{
+		return {m_result, m_values};
+	}
+
+private:
+	CheckResult m_result;
+	std::vector<std::string> m_values;
+};
+
+/// Never answers on its own. Gives up only when interrupted.
+class HangingSolverStub: public SolverStub
+{
+public:
+	HangingSolverStub(): SolverStub(CheckResult::UNKNOWN) {}
+
+	std::pair<CheckResult, std::vector<std::string>> check(std::vector<Expression> const&) override
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_interruptRequested.wait(lock, [&]() { return m_interrupted; });
+		return {CheckResult::UNKNOWN, {}};
+	}
+
+	void interrupt() override
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_interrupted = true;
+		m_interruptRequested.notify_all();
+	}
+
+private:
+	std::mutex m_mutex;
+	std::condition_variable m_interruptRequested;
+	bool m_interrupted = false;
+};
+
+class ThrowingSolverStub: public SolverStub
+{
+public:
+	ThrowingSolverStub(): SolverStub(CheckResult::ERROR) {}
+
+	std::pair<CheckResult, std::vector<std::string>> check(std::vector<Expression> const&) override
+	{
+		throw std::runtime_error("Solver failed.");
+	}
+};
+
+std::pair<CheckResult, std::vector<std::string>> checkPortfolio(
+	std::vector<std::unique_ptr<BMCSolverInterface>> _solvers,
+	bool _raceSolvers
+)
+{
+	SMTPortfolio portfolio(std::move(_solvers), std::nullopt, _raceSolvers);
+	return portfolio.check({});
+}
+
+template<typename... Solvers>
+std::vector<std::unique_ptr<BMCSolverInterface>> makeSolvers(std::unique_ptr<Solvers>... _solvers)
+{
+	std::vector<std::unique_ptr<BMCSolverInterface>> solvers;
+	(solvers.push_back(std::move(_solvers)), ...);
+	return solvers;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(SMTPortfolioTest, *boost::unit_test::label("nooptions"))
+
+BOOST_AUTO_TEST_CASE(waiting_for_all_detects_conflicts)
+{
+	auto [result, values] = checkPortfolio(makeSolvers(
+		std::make_unique<SolverStub>(CheckResult::SATISFIABLE, std::vector<std::string>{"1"}),
+		std::make_unique<SolverStub>(CheckResult::UNSATISFIABLE)
+	), false /* _raceSolvers */);
+	BOOST_CHECK(result == CheckResult::CONFLICTING);
+}
+
+BOOST_AUTO_TEST_CASE(race_returns_first_answer_and_interrupts_other_solvers)
+{
+	auto [result, values] = checkPortfolio(makeSolvers(
+		std::make_unique<HangingSolverStub>(),
+		std::make_unique<SolverStub>(CheckResult::SATISFIABLE, std::vector<std::string>{"42"}),
+		std::make_unique<HangingSolverStub>()
+	), true /* _raceSolvers */);
+	BOOST_CHECK(result == CheckResult::SATISFIABLE);
+	BOOST_TEST(values == std::vector<std::string>{"42"});
+}
+
+BOOST_AUTO_TEST_CASE(race_without_answer)
+{
+	auto [unknownResult, unknownValues] = checkPortfolio(makeSolvers(
+		std::make_unique<SolverStub>(CheckResult::ERROR),
+		std::make_unique<SolverStub>(CheckResult::UNKNOWN)
+	), true /* _raceSolvers */);
+	BOOST_CHECK(unknownResult == CheckResult::UNKNOWN);
+
+	auto [errorResult, errorValues] = checkPortfolio(makeSolvers(
+		std::make_unique<SolverStub>(CheckResult::ERROR),
+		std::make_unique<SolverStub>(CheckResult::ERROR)
+	), true /* _raceSolvers */);
+	BOOST_CHECK(errorResult == CheckResult::ERROR);
+}
+
+BOOST_AUTO_TEST_CASE(race_ignores_failures_of_losing_solvers)
+{
+	auto [result, values] = checkPortfolio(makeSolvers(
+		std::make_unique<ThrowingSolverStub>(),
+		std::make_unique<SolverStub>(CheckResult::UNSATISFIABLE),
+		std::make_unique<ThrowingSolverStub>()
+	), true /* _raceSolvers */);
+	BOOST_CHECK(result == CheckResult::UNSATISFIABLE);
+}
+
+BOOST_AUTO_TEST_CASE(race_rethrows_failure_without_answer)
+{
+	BOOST_CHECK_THROW(checkPortfolio(makeSolvers(
+		std::make_unique<SolverStub>(CheckResult::UNKNOWN),
+		std::make_unique<ThrowingSolverStub>()
+	), true /* _raceSolvers */), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
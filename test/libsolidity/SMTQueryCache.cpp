@@ -0,0 +1,95 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the on-disk cache of SMT solver responses.
+ */
+
+#include <libsolidity/interface/SMTQueryCache.h>
+
+#include <libsolutil/TemporaryDirectory.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+#include <string>
+
+using namespace solidity::util;
+
+namespace solidity::frontend::test
+{
+
+BOOST_AUTO_TEST_SUITE(SMTQueryCacheTest, *boost::unit_test::label("nooptions"))
+
+BOOST_AUTO_TEST_CASE(normalize)
+{
+	BOOST_TEST(SMTQueryCache::normalize("( check-sat )\n") == "(check-sat)");
+	BOOST_TEST(SMTQueryCache::normalize("(assert (> x  0)) ; comment\n\t(check-sat)") == "(assert (> x 0)) (check-sat)");
+	BOOST_TEST(SMTQueryCache::normalize("(echo \"a  ; b\")") == "(echo \"a  ; b\")");
+	BOOST_TEST(SMTQueryCache::normalize("(declare-fun |x  y| () Int)") == "(declare-fun |x  y| () Int)");
+	BOOST_TEST(SMTQueryCache::normalize("(echo \"a \"\" b\")") == "(echo \"a \"\" b\")");
+}
+
+BOOST_AUTO_TEST_CASE(key)
+{
+	std::string const query = "(declare-fun x () Int)\n(assert (> x 0))\n(check-sat)\n";
+	BOOST_TEST(SMTQueryCache::key("z3 -in", query) == SMTQueryCache::key("z3 -in", "; generated\n(declare-fun x () Int) (assert (> x 0)) (check-sat)"));
+	BOOST_TEST(SMTQueryCache::key("z3 -in", query) != SMTQueryCache::key("z3 -in -model", query));
+	BOOST_TEST(SMTQueryCache::key("z3 -in", query) != SMTQueryCache::key("z3 -in", "(declare-fun x () Int)\n(assert (> x 1))\n(check-sat)\n"));
+}
+
+BOOST_AUTO_TEST_CASE(store_and_load)
+{
+	TemporaryDirectory tempDir("smt-query-cache-test");
+	SMTQueryCache cache(tempDir.path() / "cache");
+	h256 const key = SMTQueryCache::key("z3", "(check-sat)");
+
+	BOOST_TEST(!cache.load(key).has_value());
+	cache.store(key, "sat\n(model)");
+	BOOST_CHECK(cache.load(key) == "sat\n(model)");
+
+	// Entries are shared by all instances using the same directory.
+	SMTQueryCache otherCache(tempDir.path() / "cache");
+	BOOST_CHECK(otherCache.load(key) == "sat\n(model)");
+
+	SMTQueryCache::Statistics statistics = cache.statistics();
+	BOOST_TEST(statistics.hits == 1);
+	BOOST_TEST(statistics.misses == 1);
+	BOOST_TEST(statistics.bytesWritten > 11);
+}
+
+BOOST_AUTO_TEST_CASE(truncated_entries_are_ignored)
+{
+	TemporaryDirectory tempDir("smt-query-cache-test");
+	SMTQueryCache cache(tempDir.path());
+	h256 const key = SMTQueryCache::key("z3", "(check-sat)");
+	cache.store(key, "unsat");
+
+	for (auto const& entry: boost::filesystem::directory_iterator(tempDir.path()))
+	{
+		std::fstream file(entry.path().string(), std::ios::in | std::ios::out | std::ios::binary);
+		file.seekp(-1, std::ios::end);
+		file << 'x';
+	}
+
+	BOOST_TEST(!cache.load(key).has_value());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
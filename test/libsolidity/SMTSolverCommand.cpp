@@ -0,0 +1,149 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the command calling SMT solver binaries.
+ */
+
+#include <libsolidity/interface/SMTSolverCommand.h>
+
+#include <test/libsolidity/util/FakeSolver.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+#include <string>
+
+namespace solidity::frontend::test
+{
+
+#if !defined(_WIN32)
+namespace
+{
+
+/// Runs a fake z3, which understands a few commands of its own, one per line:
+/// (get-pid) prints its process ID, (hang) never answers and (exit-now) exits without reading further.
+class FakeSolverFixture
+{
+public:
+	FakeSolverFixture():
+		m_solver(
+			"z3",
+			"while IFS= read -r line || [ -n \"$line\" ]; do\n"
+			"\tcase \"$line\" in\n"
+			"\t\t\"(get-pid)\") echo $$ ;;\n"
+			"\t\t\"(hang)\") exec sleep 60 ;;\n"
+			"\t\t\"(exit-now)\") exit 0 ;;\n"
+			"\t\t'(echo \"solc-end-of-response\")') echo solc-end-of-response ;;\n"
+			"\tesac\n"
+			"done\n"
+		)
+	{}
+
+protected:
+	std::string solve(SMTSolverCommand const& _command, std::string const& _query)
+	{
+		ReadCallback::Result result = _command.solve(ReadCallback::kindString(ReadCallback::Kind::SMTQuery), _query);
+		BOOST_REQUIRE_MESSAGE(result.success, result.responseOrErrorMessage);
+		return result.responseOrErrorMessage;
+	}
+
+private:
+	FakeSolver m_solver;
+};
+
+/// A query the fake solver stops reading after its first line, large enough not to fit into the pipe buffer.
+std::string const queryToExitedSolver = "(exit-now)\n" + std::string(1024 * 1024, ';') + "\n";
+
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE(SMTSolverCommandTest, *boost::unit_test::label("nooptions"))
+
+BOOST_AUTO_TEST_CASE(siblings_have_their_own_configuration)
+{
+	std::string const kind = ReadCallback::kindString(ReadCallback::Kind::SMTQuery);
+	SMTSolverCommand command;
+	std::unique_ptr<SMTSolverCommand> sibling = command.sibling();
+	sibling->setEldarica(std::nullopt, false);
+
+	ReadCallback::Result result = command.solve(kind, "(check-sat)");
+	BOOST_CHECK(!result.success);
+	BOOST_CHECK_EQUAL(result.responseOrErrorMessage, "No solver set.");
+
+	// Whether or not the solver is installed, the sibling uses it.
+	result = sibling->solve(kind, "(check-sat)");
+	BOOST_CHECK_NE(result.responseOrErrorMessage, "No solver set.");
+
+	command.setZ3(std::nullopt, true, false);
+	std::unique_ptr<SMTSolverCommand> siblingOfConfigured = command.sibling();
+	result = siblingOfConfigured->solve(kind, "(check-sat)");
+	BOOST_CHECK_EQUAL(result.responseOrErrorMessage, "No solver set.");
+}
+
+#if !defined(_WIN32)
+BOOST_FIXTURE_TEST_CASE(persistent_solver_processes_are_reused, FakeSolverFixture)
+{
+	SMTSolverCommand command;
+	command.setZ3(std::nullopt, true, false);
+
+	std::string const pidOfNewProcess = solve(command, "(get-pid)");
+	BOOST_CHECK(!pidOfNewProcess.empty());
+	BOOST_CHECK_NE(solve(command, "(get-pid)"), pidOfNewProcess);
+
+	command.setPersistentSolvers(1);
+	std::string const pidOfPersistentProcess = solve(command, "(get-pid)");
+	BOOST_CHECK(!pidOfPersistentProcess.empty());
+	BOOST_CHECK_EQUAL(solve(command, "(get-pid)"), pidOfPersistentProcess);
+
+	// Siblings share the idle processes.
+	std::unique_ptr<SMTSolverCommand> sibling = command.sibling();
+	sibling->setZ3(std::nullopt, true, false);
+	BOOST_CHECK_EQUAL(solve(*sibling, "(get-pid)"), pidOfPersistentProcess);
+}
+
+BOOST_FIXTURE_TEST_CASE(persistent_solver_process_is_killed_after_timeout, FakeSolverFixture)
+{
+	SMTSolverCommand command;
+	command.setZ3(1, true, false);
+	command.setPersistentSolvers(1);
+
+	std::string const pidBeforeTimeout = solve(command, "(get-pid)");
+	BOOST_CHECK_EQUAL(solve(command, "(hang)"), "unknown");
+	std::string const pidAfterTimeout = solve(command, "(get-pid)");
+	BOOST_CHECK(!pidAfterTimeout.empty());
+	BOOST_CHECK_NE(pidAfterTimeout, pidBeforeTimeout);
+}
+
+BOOST_FIXTURE_TEST_CASE(solver_exiting_before_reading_query, FakeSolverFixture)
+{
+	SMTSolverCommand command;
+	command.setZ3(std::nullopt, true, false);
+	BOOST_CHECK_EQUAL(solve(command, queryToExitedSolver), "");
+
+	command.setPersistentSolvers(1);
+	std::string const pidBeforeExit = solve(command, "(get-pid)");
+	BOOST_CHECK_EQUAL(solve(command, queryToExitedSolver), "");
+	std::string const pidAfterExit = solve(command, "(get-pid)");
+	BOOST_CHECK(!pidAfterExit.empty());
+	BOOST_CHECK_NE(pidAfterExit, pidBeforeExit);
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -33,6 +33,7 @@
 
 #include <algorithm>
 #include <set>
+#include <sstream>
 
 using namespace solidity::evmasm;
 using namespace std::string_literals;
@@ -1655,6 +1656,127 @@ BOOST_AUTO_TEST_CASE(stopAfter_ast_output)
 	BOOST_CHECK(result["sources"]["a.sol"]["ast"].is_object());
 }
 
+BOOST_AUTO_TEST_CASE(parallelism_invalid_type)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"sources":
+		{ "": { "content": "pragma solidity >=0.0; contract C { function f() public pure {} }" } },
+		"settings":
+		{
+			"parallelism": "all",
+			"outputSelection":
+			{
+				"*": { "C": ["evm.bytecode"] }
+			}
+		}
+	}
+	)";
+	Json result = compile(input);
+	BOOST_CHECK(containsError(result, "JSONError", "\"settings.parallelism\" must be an unsigned integer."));
+}
+
+BOOST_AUTO_TEST_CASE(parallelism_does_not_affect_output)
+{
+	std::string const sources = R"(
+		"sources": {
+			"A.sol": { "content": "pragma solidity >=0.0; contract A { function f(uint x) public pure returns (uint) { return x * 7 + 1; } }" },
+			"B.sol": { "content": "pragma solidity >=0.0; import \"A.sol\"; contract B { function g() public returns (address) { return address(new A()); } }" },
+			"C.sol": { "content": "pragma solidity >=0.0; import \"B.sol\"; contract C is B { uint[] s; function h(uint i) public view returns (uint) { return s[i]; } }" },
+			"I.sol": { "content": "pragma solidity >=0.0; interface I { function f(uint) external; }" }
+		}
+	)";
+	auto compileWithParallelism = [&](unsigned _parallelism) {
+		return compile(R"(
+		{
+			"language": "Solidity",
+			)" + sources + R"(,
+			"settings": {
+				"viaIR": true,
+				"optimizer": { "enabled": true },
+				"parallelism": )" + std::to_string(_parallelism) + R"(,
+				"outputSelection": {
+					"*": { "*": ["evm.bytecode", "evm.deployedBytecode", "irOptimized", "metadata"] }
+				}
+			}
+		}
+		)");
+	};
+
+	Json serialResult = compileWithParallelism(1);
+	BOOST_REQUIRE(containsAtMostWarnings(serialResult));
+	BOOST_REQUIRE(getContractResult(serialResult, "C.sol", "C")["evm"]["bytecode"]["object"].is_string());
+	for (unsigned parallelism: {0u, 2u, 8u})
+		BOOST_CHECK(compileWithParallelism(parallelism) == serialResult);
+}
+
+BOOST_AUTO_TEST_CASE(collect_evm_object_computes_only_requested_artifacts)
+{
+	LinkerObject object;
+	object.bytecode = {0x60, 0x00};
+	std::string const sourceMap = "0:1:0:-:0";
+	size_t sourceMapCalls = 0;
+	size_t generatedSourcesCalls = 0;
+	auto collect = [&](std::set<std::string> const& _artifacts) {
+		return solidity::frontend::StandardCompiler::collectEVMObject(
+			langutil::EVMVersion{},
+			object,
+			[&]() { ++sourceMapCalls; return &sourceMap; },
+			[&]() { ++generatedSourcesCalls; return Json::array(); },
+			false, // _runtimeObject
+			[&](std::string const& _artifact) { return _artifacts.count(_artifact) > 0; }
+		);
+	};
+
+	BOOST_CHECK_EQUAL(collect({"object"}), Json({{"object", "6000"}}));
+	BOOST_CHECK_EQUAL(sourceMapCalls, 0);
+	BOOST_CHECK_EQUAL(generatedSourcesCalls, 0);
+
+	Json const output = collect({"object", "sourceMap", "generatedSources"});
+	BOOST_CHECK_EQUAL(output["sourceMap"], sourceMap);
+	BOOST_CHECK_EQUAL(output["generatedSources"], Json::array());
+	BOOST_CHECK_EQUAL(sourceMapCalls, 1);
+	BOOST_CHECK_EQUAL(generatedSourcesCalls, 1);
+}
+
+BOOST_AUTO_TEST_CASE(selected_evm_artifacts_do_not_depend_on_other_selections)
+{
+	auto compileWithSelection = [](std::string const& _selection) {
+		return compile(R"(
+		{
+			"language": "Solidity",
+			"sources": {
+				"A.sol": { "content": "pragma solidity >=0.0; contract A { event E(uint); error Err(uint); function f(uint x) public returns (uint) { emit E(x); return x * 7 + 1; } }" }
+			},
+			"settings": {
+				"outputSelection": { "*": { "*": [)" + _selection + R"(] } }
+			}
+		}
+		)");
+	};
+
+	Json const fullResult = compileWithSelection(R"("*")");
+	BOOST_REQUIRE(containsAtMostWarnings(fullResult));
+	Json const fullEVM = getContractResult(fullResult, "A.sol", "A")["evm"];
+	BOOST_REQUIRE(fullEVM["bytecode"]["sourceMap"].is_string());
+	BOOST_REQUIRE(fullEVM["bytecode"]["generatedSources"].is_array());
+
+	Json const methodIdentifiers = compileWithSelection(R"("evm.methodIdentifiers")");
+	BOOST_REQUIRE(containsAtMostWarnings(methodIdentifiers));
+	BOOST_CHECK_EQUAL(
+		getContractResult(methodIdentifiers, "A.sol", "A")["evm"],
+		Json({{"methodIdentifiers", fullEVM["methodIdentifiers"]}})
+	);
+
+	Json const bytecodeObject = compileWithSelection(R"("evm.bytecode.object")");
+	BOOST_REQUIRE(containsAtMostWarnings(bytecodeObject));
+	BOOST_CHECK_EQUAL(
+		getContractResult(bytecodeObject, "A.sol", "A")["evm"],
+		Json({{"bytecode", {{"object", fullEVM["bytecode"]["object"]}}}})
+	);
+}
+
 BOOST_AUTO_TEST_CASE(dependency_tracking_of_abstract_contract)
 {
 	char const* input = R"(
@@ -1782,6 +1904,42 @@ BOOST_AUTO_TEST_CASE(source_location_of_bare_block)
 	BOOST_REQUIRE(sourceMap.find(sourceRef) != std::string::npos);
 }
 
+BOOST_AUTO_TEST_CASE(streamed_output)
+{
+	std::vector<std::string> inputs{
+		// "a:B" comes after "a.sol:A", but the file "a" comes before "a.sol".
+		R"({
+			"language": "Solidity",
+			"sources": {
+				"a.sol": {"content": "contract A { function f() public {} }"},
+				"a": {"content": "import \"a.sol\"; contract B is A { event E(uint); } contract C {}"}
+			},
+			"settings": {"outputSelection": {"*": {"*": ["*"], "": ["ast"]}}}
+		})",
+		R"({
+			"language": "Solidity",
+			"sources": {"a.sol": {"content": "contract A { function f() public { x; } }"}},
+			"settings": {"outputSelection": {"*": {"*": ["abi"], "": ["ast"]}}}
+		})",
+		R"({
+			"language": "Yul",
+			"sources": {"a.yul": {"content": "{ sstore(0, 1) }"}},
+			"settings": {"outputSelection": {"*": {"*": ["*"]}}}
+		})",
+		R"({"language": "Solidity", "sources": {}})",
+		R"({"language": "Solidity", )",
+	};
+
+	for (util::JsonFormat const& format: {util::JsonFormat{util::JsonFormat::Compact}, util::JsonFormat{util::JsonFormat::Pretty, 4}})
+		for (std::string const& input: inputs)
+		{
+			solidity::frontend::StandardCompiler compiler({}, format);
+			std::stringstream streamedOutput;
+			compiler.compile(input, streamedOutput);
+			BOOST_CHECK_EQUAL(streamedOutput.str(), compiler.compile(input));
+		}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -40,6 +40,13 @@ contract User
 //                 ^ @Cursor5
 //                 ^^^^^^^^^^^^^^^ @Cursor5Range
     }
+
+    function externalFunction() external view returns (uint)
+    {
+        return this.externalFunction();
+//                  ^ @Cursor6
+//             ^^^^^^^^^^^^^^^^^^^^^ @Cursor6Range
+    }
 }
 // ----
 // -> textDocument/hover {
@@ -110,3 +117,13 @@ contract User
 //     },
 //     "range": @Cursor5Range
 // }
+// -> textDocument/hover {
+//     "position": @Cursor6
+// }
+// <- {
+//     "contents": {
+//         "kind": "markdown",
+//         "value": "```solidity\nfunction () view external returns (uint256)\n```\n\n"
+//     },
+//     "range": @Cursor6Range
+// }
@@ -0,0 +1,43 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <test/libsolidity/util/FakeSolver.h>
+
+#include <cstdlib>
+#include <fstream>
+
+using namespace solidity::frontend::test;
+
+#if !defined(_WIN32)
+FakeSolver::FakeSolver(std::string const& _name, std::string const& _script):
+	m_tempDir("fake-solver")
+{
+	boost::filesystem::path const solverPath = m_tempDir.path() / _name;
+	std::ofstream(solverPath.string()) << "#!/bin/sh\n" << _script;
+	boost::filesystem::permissions(solverPath, boost::filesystem::owner_all);
+
+	char const* path = getenv("PATH");
+	m_originalPath = path ? path : "";
+	setenv("PATH", (m_tempDir.path().string() + ":" + m_originalPath).c_str(), 1);
+}
+
+FakeSolver::~FakeSolver()
+{
+	setenv("PATH", m_originalPath.c_str(), 1);
+}
+#endif
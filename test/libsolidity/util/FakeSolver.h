@@ -0,0 +1,48 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#pragma once
+
+#include <libsolutil/TemporaryDirectory.h>
+
+#include <boost/filesystem.hpp>
+
+#include <string>
+
+namespace solidity::frontend::test
+{
+
+#if !defined(_WIN32)
+/// Puts an executable shell script called @a _name in front of PATH for the lifetime
+/// of the object, so that it is run instead of the solver binary of that name.
+class FakeSolver
+{
+public:
+	FakeSolver(std::string const& _name, std::string const& _script);
+	~FakeSolver();
+
+	/// @returns the directory containing the script, which the script may also use to store files.
+	boost::filesystem::path const& directory() const { return m_tempDir.path(); }
+
+private:
+	util::TemporaryDirectory m_tempDir;
+	std::string m_originalPath;
+};
+#endif
+
+} // namespace solidity::frontend::test
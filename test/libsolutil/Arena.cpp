@@ -0,0 +1,84 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolutil/Arena.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace solidity::util::test
+{
+
+BOOST_AUTO_TEST_SUITE(ArenaTest, *boost::unit_test::label("nooptions"))
+
+BOOST_AUTO_TEST_CASE(alignment)
+{
+	Arena arena;
+	for (size_t alignment: std::vector<size_t>{1, 2, 4, 8, 16, 64})
+		for (size_t size: std::vector<size_t>{0, 1, 3, 17})
+		{
+			void* memory = arena.allocate(size, alignment);
+			BOOST_CHECK(memory);
+			BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(memory) % alignment, 0);
+		}
+}
+
+BOOST_AUTO_TEST_CASE(large_allocations)
+{
+	Arena arena;
+	auto* small = static_cast<char*>(arena.allocate(10, 1));
+	auto* large = static_cast<char*>(arena.allocate(100000, 8));
+	auto* next = static_cast<char*>(arena.allocate(10, 1));
+	// Memory handed out must not overlap.
+	std::fill(large, large + 100000, 'x');
+	std::fill(small, small + 10, 'a');
+	std::fill(next, next + 10, 'b');
+	BOOST_CHECK(std::all_of(large, large + 100000, [](char _c) { return _c == 'x'; }));
+	BOOST_CHECK_GE(arena.reservedBytes(), 100010);
+}
+
+BOOST_AUTO_TEST_CASE(shared_objects_keep_arena_alive)
+{
+	// Leaks and premature destruction of the arena are reported by the sanitizer builds.
+	CountedArena* arena = CountedArena::create();
+	ArenaAllocator<std::string> allocator(*arena);
+	auto value = std::allocate_shared<std::string>(allocator, "value");
+	arena->release();
+
+	// The remaining object keeps the arena usable.
+	auto other = std::allocate_shared<std::string>(ArenaAllocator<int>(allocator), "other");
+	value.reset();
+	BOOST_CHECK_EQUAL(*other, "other");
+	BOOST_CHECK_GT(allocator.arena().reservedBytes(), 0);
+	other.reset();
+}
+
+BOOST_AUTO_TEST_CASE(allocator_size)
+{
+	// A copy of the allocator is stored in the control block of every node.
+	BOOST_CHECK_EQUAL(sizeof(ArenaAllocator<std::string>), sizeof(void*));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
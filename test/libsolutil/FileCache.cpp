@@ -0,0 +1,80 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolutil/FileCache.h>
+
+#include <libsolutil/Keccak256.h>
+#include <libsolutil/TemporaryDirectory.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+
+namespace solidity::util::test
+{
+
+BOOST_AUTO_TEST_SUITE(FileCacheTest)
+
+BOOST_AUTO_TEST_CASE(entries_are_shared_only_within_one_version)
+{
+	TemporaryDirectory tempDir("file-cache-test");
+	FileCache(tempDir.path(), "1", ".entry").store(keccak256("a"), "content");
+
+	BOOST_CHECK(FileCache(tempDir.path(), "1", ".entry").load(keccak256("a")) == "content");
+	BOOST_TEST(!FileCache(tempDir.path(), "2", ".entry").load(keccak256("a")).has_value());
+	BOOST_TEST(!FileCache(tempDir.path(), "1", ".entry").load(keccak256("b")).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(entries_with_wrong_hash_are_ignored)
+{
+	TemporaryDirectory tempDir("file-cache-test");
+	FileCache cache(tempDir.path(), "1", ".entry");
+	cache.store(keccak256("a"), "content");
+
+	for (auto const& entry: boost::filesystem::directory_iterator(tempDir.path()))
+	{
+		std::fstream file(entry.path().string(), std::ios::in | std::ios::out | std::ios::binary);
+		file.seekp(-1, std::ios::end);
+		file << 'x';
+	}
+
+	BOOST_TEST(!cache.load(keccak256("a")).has_value());
+	BOOST_TEST(cache.statistics().misses == 1);
+}
+
+BOOST_AUTO_TEST_CASE(eviction_only_removes_entries)
+{
+	TemporaryDirectory tempDir("file-cache-test");
+	{
+		std::ofstream unrelated((tempDir.path() / "unrelated.txt").string());
+		unrelated << std::string(1000, 'x');
+	}
+	FileCache cache(tempDir.path(), "1", ".entry");
+	cache.store(keccak256("a"), "content");
+	cache.store(keccak256("b"), "content");
+
+	cache.evict(0);
+	BOOST_TEST(cache.statistics().evictedEntries == 2);
+	BOOST_TEST(boost::filesystem::exists(tempDir.path() / "unrelated.txt"));
+	BOOST_TEST(!cache.load(keccak256("a")).has_value());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
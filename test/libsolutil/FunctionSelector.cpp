@@ -24,6 +24,8 @@
 
 #include <cstdint>
 #include <sstream>
+#include <string>
+#include <vector>
 
 
 namespace solidity::util::test
@@ -47,6 +49,16 @@ BOOST_AUTO_TEST_CASE(conversions)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(batch)
+{
+	std::vector<std::string> signatures{"test()", "transfer(address,uint256)", "balanceOf(address)", "f()", "test()"};
+	std::vector<util::FixedHash<4>> selectors = util::selectorsFromSignaturesH32(signatures);
+	BOOST_REQUIRE_EQUAL(selectors.size(), signatures.size());
+	for (size_t i = 0; i < signatures.size(); ++i)
+		BOOST_CHECK_EQUAL(selectors[i], util::selectorFromSignatureH32(signatures[i]));
+	BOOST_CHECK_EQUAL(selectors[1], util::FixedHash<4>(0xa9059cbb));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -26,6 +26,8 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <sstream>
+
 
 namespace solidity::util::test
 {
@@ -117,6 +119,43 @@ BOOST_AUTO_TEST_CASE(json_compact_print)
 	BOOST_CHECK(R"({"1":1,"2":"2","3":{"3.1":"3.1","3.2":2},"4":"\u0911 \u0912 \u0913 \u0914 \u0915 \u0916","5":"\u0010","6":"\u4e2d"})" == jsonCompactPrint(json));
 }
 
+BOOST_AUTO_TEST_CASE(json_stream_writer)
+{
+	Json json;
+	json["a"]["x"] = 1;
+	json["a"]["y"]["z"] = Json::array({1, "\n"});
+	json["b"] = Json::object();
+	json["c"]["d"]["e"] = "ऑ";
+	json["c"]["f"] = Json::array();
+
+	for (JsonFormat format: {JsonFormat{JsonFormat::Compact}, JsonFormat{JsonFormat::Pretty, 3}})
+	{
+		std::stringstream stream;
+		JsonStreamWriter writer(stream, format);
+		BOOST_CHECK(!writer.started());
+		writer.write({"a", "x"}, 1);
+		writer.write({"a", "y"}, json["a"]["y"]);
+		BOOST_CHECK(writer.started());
+		writer.write({"b"}, Json::object());
+		BOOST_CHECK(!writer.canWrite({"a", "z"}));
+		BOOST_CHECK(!writer.canWrite({"b"}));
+		BOOST_CHECK(!writer.canWrite({}));
+		writer.write({"c", "d", "e"}, "ऑ");
+		BOOST_CHECK(!writer.canWrite({"c", "d"}));
+		BOOST_CHECK(writer.canWrite({"c", "d", "f"}));
+		writer.write({"c", "f"}, Json::array());
+		BOOST_CHECK(writer.canWrite({"d"}));
+		writer.finish();
+		BOOST_CHECK(!writer.canWrite({"d"}));
+		BOOST_CHECK_EQUAL(stream.str(), jsonPrint(json, format));
+	}
+
+	std::stringstream stream;
+	JsonStreamWriter writer(stream, JsonFormat{JsonFormat::Pretty});
+	writer.finish();
+	BOOST_CHECK_EQUAL(stream.str(), "{}");
+}
+
 BOOST_AUTO_TEST_CASE(parse_json_strict)
 {
 	// In this test we check conformance against JSON.parse (https://tc39.es/ecma262/multipage/structured-data.html#sec-json.parse)
@@ -22,6 +22,9 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <string>
+#include <vector>
+
 
 namespace solidity::util::test
 {
@@ -68,6 +71,31 @@ BOOST_AUTO_TEST_CASE(strings)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(batch)
+{
+	// Inputs of various lengths around the rate of 136 bytes, so that lanes
+	// hashed together need one, two or three permutations.
+	std::vector<std::string> inputs;
+	for (size_t length: std::vector<size_t>{0, 1, 4, 31, 32, 33, 135, 136, 137, 271, 272, 273, 300})
+		for (char fill: {'\0', 'a', '\xff'})
+			inputs.emplace_back(length, fill);
+	inputs.emplace_back("transfer(address,uint256)");
+	inputs.emplace_back("balanceOf(address)");
+
+	std::vector<bytesConstRef> inputRefs;
+	for (std::string const& input: inputs)
+		inputRefs.emplace_back(bytesConstRef(input));
+
+	std::vector<h256> expectation;
+	for (std::string const& input: inputs)
+		expectation.push_back(keccak256(input));
+
+	BOOST_TEST(keccak256Batch(inputs) == expectation);
+	for (size_t maxLanes: std::vector<size_t>{1, 2, 3, 4, 5, 8})
+		BOOST_TEST(keccak256Batch(inputRefs, maxLanes) == expectation);
+	BOOST_TEST(keccak256Batch(std::vector<std::string>{}).empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -0,0 +1,81 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolutil/Parallel.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace solidity::util::test
+{
+
+BOOST_AUTO_TEST_SUITE(ParallelTests, *boost::unit_test::label("nooptions"))
+
+BOOST_AUTO_TEST_CASE(resolve_thread_count)
+{
+	BOOST_CHECK_EQUAL(resolveThreadCount(1), 1);
+	BOOST_CHECK_EQUAL(resolveThreadCount(7), 7);
+	BOOST_CHECK_GE(resolveThreadCount(0), 1);
+}
+
+BOOST_AUTO_TEST_CASE(runs_every_task_once)
+{
+	for (size_t threads: std::initializer_list<size_t>{1, 2, 8})
+	{
+		std::vector<std::atomic<size_t>> calls(100);
+		parallelFor(calls.size(), threads, [&](size_t _index) { ++calls[_index]; });
+		for (auto const& count: calls)
+			BOOST_CHECK_EQUAL(count.load(), 1);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(no_tasks)
+{
+	parallelFor(0, 4, [](size_t) { BOOST_REQUIRE(false); });
+}
+
+BOOST_AUTO_TEST_CASE(rethrows_lowest_failure)
+{
+	for (size_t threads: std::initializer_list<size_t>{1, 2, 8})
+	{
+		std::atomic<size_t> lowCalls = 0;
+		try
+		{
+			parallelFor(50, threads, [&](size_t _index) {
+				if (_index < 10)
+					++lowCalls;
+				if (_index == 10 || _index == 30 || _index == 40)
+					throw std::runtime_error(std::to_string(_index));
+			});
+			BOOST_FAIL("Exception expected.");
+		}
+		catch (std::runtime_error const& _error)
+		{
+			BOOST_CHECK_EQUAL(std::string(_error.what()), "10");
+		}
+		BOOST_CHECK_EQUAL(lowCalls.load(), 10);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
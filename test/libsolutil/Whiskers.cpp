@@ -240,6 +240,22 @@ BOOST_AUTO_TEST_CASE(invalid_param_rendered)
 	BOOST_CHECK_EQUAL(m.render(), templ);
 }
 
+BOOST_AUTO_TEST_CASE(same_template_different_values)
+{
+	std::string templ = "<?c><a><!c><b></c><#l><x></l>";
+	std::vector<std::map<std::string, std::string>> list(2);
+	list[0]["x"] = "1";
+	list[1]["x"] = "2";
+	BOOST_CHECK_EQUAL(Whiskers(templ)("a", "A")("b", "B")("c", true)("l", list).render(), "A12");
+	BOOST_CHECK_EQUAL(Whiskers(templ)("a", "X")("b", "Y")("c", false)("l", std::vector<std::map<std::string, std::string>>{}).render(), "Y");
+}
+
+BOOST_AUTO_TEST_CASE(unclosed_list_is_text)
+{
+	std::string templ = "<#a>x<b>";
+	BOOST_CHECK_EQUAL(Whiskers(templ)("b", "B").render(), "<#a>xB");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
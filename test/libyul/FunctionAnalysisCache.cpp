@@ -0,0 +1,145 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the cache of function analyses shared between optimiser steps.
+ */
+
+#include <test/libyul/Common.h>
+
+#include <libyul/optimiser/FunctionAnalysisCache.h>
+#include <libyul/optimiser/Semantics.h>
+#include <libyul/backends/evm/EVMDialect.h>
+#include <libyul/AST.h>
+#include <libyul/ControlFlowSideEffectsCollector.h>
+#include <libyul/Object.h>
+
+#include <liblangutil/ErrorReporter.h>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace solidity::langutil;
+
+namespace solidity::yul::test
+{
+
+class FunctionAnalysisCacheTest
+{
+protected:
+	Block const& parseCode(std::string const& _source)
+	{
+		ErrorList errorList;
+		auto [object, analysisInfo] = yul::test::parse(_source, m_dialect, errorList);
+		BOOST_REQUIRE(object && errorList.empty() && object->hasCode());
+		m_objects.emplace_back(object);
+		return object->code()->root();
+	}
+
+	/// Checks that the cached results agree with a fresh analysis of @a _ast.
+	void checkAgainstFreshAnalysis(Block const& _ast)
+	{
+		m_cache.update(m_dialect, _ast);
+
+		CallGraph callGraph = CallGraphGenerator::callGraph(_ast);
+		BOOST_CHECK(m_cache.callGraph().functionCalls == callGraph.functionCalls);
+		BOOST_CHECK(m_cache.callGraph().functionsWithLoops == callGraph.functionsWithLoops);
+		BOOST_CHECK(m_cache.recursiveFunctions() == callGraph.recursiveFunctions());
+		BOOST_CHECK(m_cache.functionSideEffects() == SideEffectsPropagator::sideEffects(m_dialect, callGraph));
+
+		auto expectedControlFlowSideEffects = ControlFlowSideEffectsCollector{m_dialect, _ast}.functionSideEffectsNamed();
+		auto const& controlFlowSideEffects = m_cache.controlFlowSideEffects();
+		BOOST_REQUIRE_EQUAL(controlFlowSideEffects.size(), expectedControlFlowSideEffects.size());
+		for (auto const& [function, expected]: expectedControlFlowSideEffects)
+		{
+			BOOST_REQUIRE(controlFlowSideEffects.count(function));
+			ControlFlowSideEffects const& actual = controlFlowSideEffects.at(function);
+			BOOST_CHECK_EQUAL(actual.canTerminate, expected.canTerminate);
+			BOOST_CHECK_EQUAL(actual.canRevert, expected.canRevert);
+			BOOST_CHECK_EQUAL(actual.canContinue, expected.canContinue);
+		}
+	}
+
+	// TODO: Add EOF support
+	EVMDialect m_dialect{EVMVersion{}, std::nullopt, true};
+	std::vector<std::shared_ptr<Object>> m_objects;
+	FunctionAnalysisCache m_cache;
+};
+
+BOOST_FIXTURE_TEST_SUITE(YulFunctionAnalysisCache, FunctionAnalysisCacheTest)
+
+BOOST_AUTO_TEST_CASE(unchanged_code)
+{
+	std::string const source = R"({
+		function f() -> r { r := sload(0) }
+		function g() -> r { r := f() }
+		sstore(0, g())
+	})";
+	checkAgainstFreshAnalysis(parseCode(source));
+	checkAgainstFreshAnalysis(parseCode(source));
+}
+
+BOOST_AUTO_TEST_CASE(changed_callee)
+{
+	checkAgainstFreshAnalysis(parseCode(R"({
+		function f() -> r { r := sload(0) }
+		function g() -> r { r := f() }
+		function h() -> r { r := 2 }
+		function k() { for {} 1 {} {} }
+		sstore(0, add(g(), h()))
+	})"));
+	// Only the callee changes, the callers have to be updated nevertheless.
+	checkAgainstFreshAnalysis(parseCode(R"({
+		function f() -> r { r := calldataload(0) }
+		function g() -> r { r := f() }
+		function h() -> r { r := 2 }
+		function k() { revert(0, 0) }
+		sstore(0, add(g(), h()))
+	})"));
+	// Only the body of a function changes, not its calls.
+	checkAgainstFreshAnalysis(parseCode(R"({
+		function f() -> r { r := calldataload(1) }
+		function g() -> r { r := f() }
+		function h() -> r { r := 3 }
+		function k() { revert(0, 0) }
+		sstore(0, add(g(), h()))
+	})"));
+}
+
+BOOST_AUTO_TEST_CASE(changed_recursion)
+{
+	checkAgainstFreshAnalysis(parseCode(R"({
+		function f(x) { if x { g(sub(x, 1)) } }
+		function g(x) { f(x) }
+		function h() { g(1) }
+		h()
+	})"));
+	checkAgainstFreshAnalysis(parseCode(R"({
+		function f(x) { if x { sstore(0, x) } }
+		function g(x) { f(x) }
+		function h() { g(1) }
+		h()
+	})"));
+	checkAgainstFreshAnalysis(parseCode(R"({
+		function g(x) { sstore(0, x) }
+		function h() { g(1) }
+		h()
+	})"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
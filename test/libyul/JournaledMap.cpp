@@ -0,0 +1,213 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Randomized tests of the journaled map used by the data flow analyzer.
+ */
+
+#include <libyul/optimiser/JournaledMap.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <map>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace solidity::yul::test
+{
+
+namespace
+{
+
+/**
+ * Applies the same random operations to a JournaledMap and to a reference map.
+ * The reference joins with the state at the time of a snapshot by comparing with a full copy of it.
+ */
+template<typename Map>
+class JournaledMapTester
+{
+public:
+	explicit JournaledMapTester(unsigned _seed): m_random(_seed) {}
+
+	/// Performs @a _steps random operations, comparing the maps after each of them.
+	/// Snapshots are taken and joined in nested branches, mirroring the control flow
+	/// the data flow analyzer walks.
+	void run(size_t _steps, size_t _depth = 0)
+	{
+		for (size_t step = 0; step < _steps; ++step)
+		{
+			switch (randomNumber(10))
+			{
+			case 0:
+			case 1:
+			case 2:
+			{
+				unsigned key = randomNumber(numKeys);
+				unsigned value = randomNumber(numValues);
+				m_map.set(key, value);
+				m_reference[key] = value;
+				break;
+			}
+			case 3:
+			{
+				unsigned key = randomNumber(numKeys);
+				m_map.erase(key);
+				m_reference.erase(key);
+				break;
+			}
+			case 4:
+			{
+				unsigned value = randomNumber(numValues);
+				m_map.eraseIf([&](auto const& _entry) { return _entry.second == value; });
+				for (auto it = m_reference.begin(); it != m_reference.end();)
+					if (it->second == value)
+						it = m_reference.erase(it);
+					else
+						++it;
+				break;
+			}
+			case 5:
+				if (randomNumber(4) == 0)
+				{
+					m_map.clear();
+					m_reference.clear();
+				}
+				break;
+			case 6:
+			case 7:
+			case 8:
+				if (_depth < maxDepth)
+					branch(_steps / 2, _depth + 1);
+				break;
+			case 9:
+				if (_depth < maxDepth)
+					rollback(_steps / 2, _depth + 1);
+				break;
+			}
+			check();
+		}
+	}
+
+private:
+	static unsigned constexpr numKeys = 16;
+	/// Few values, so that branches often assign the value a key had before.
+	static unsigned constexpr numValues = 3;
+	static size_t constexpr maxDepth = 5;
+
+	unsigned randomNumber(unsigned _limit)
+	{
+		return std::uniform_int_distribution<unsigned>(0, _limit - 1)(m_random);
+	}
+
+	/// Takes a snapshot, changes the map and joins with the state at the time of the snapshot.
+	void branch(size_t _steps, size_t _depth)
+	{
+		size_t snapshot = m_map.snapshot();
+		m_snapshots.push_back(m_reference);
+
+		run(_steps, _depth);
+
+		m_map.joinWith(snapshot);
+		Map const& older = m_snapshots.back();
+		for (auto it = m_reference.begin(); it != m_reference.end();)
+			if (auto olderIt = older.find(it->first); olderIt == older.end() || olderIt->second != it->second)
+				it = m_reference.erase(it);
+			else
+				++it;
+		m_snapshots.pop_back();
+	}
+
+	/// Replaces the map by an empty one while snapshots are active and restores it afterwards,
+	/// like the data flow analyzer does when it enters a function definition.
+	void rollback(size_t _steps, size_t _depth)
+	{
+		JournaledMap<Map> savedMap = std::exchange(m_map, {});
+		Map savedReference = std::exchange(m_reference, {});
+		std::vector<Map> savedSnapshots = std::exchange(m_snapshots, {});
+
+		run(_steps, _depth);
+
+		m_map = std::move(savedMap);
+		m_reference = std::move(savedReference);
+		m_snapshots = std::move(savedSnapshots);
+	}
+
+	void check() const
+	{
+		for (unsigned key = 0; key < numKeys; ++key)
+		{
+			unsigned const* value = m_map.find(key);
+			auto it = m_reference.find(key);
+			BOOST_REQUIRE_EQUAL(value != nullptr, it != m_reference.end());
+			if (value)
+				BOOST_REQUIRE_EQUAL(*value, it->second);
+		}
+	}
+
+	std::mt19937 m_random;
+	JournaledMap<Map> m_map;
+	Map m_reference;
+	/// Copies of the reference at the time of each active snapshot, innermost last.
+	std::vector<Map> m_snapshots;
+};
+
+}
+
+BOOST_AUTO_TEST_SUITE(YulJournaledMap)
+
+BOOST_AUTO_TEST_CASE(unordered_map_matches_reference)
+{
+	for (unsigned seed = 0; seed < 100; ++seed)
+	{
+		BOOST_TEST_MESSAGE("seed " << seed);
+		JournaledMapTester<std::unordered_map<unsigned, unsigned>>(seed).run(30);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(ordered_map_matches_reference)
+{
+	for (unsigned seed = 0; seed < 100; ++seed)
+	{
+		BOOST_TEST_MESSAGE("seed " << seed);
+		JournaledMapTester<std::map<unsigned, unsigned>>(seed).run(30);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(join_after_rollback_inside_snapshot)
+{
+	JournaledMap<std::unordered_map<unsigned, unsigned>> map;
+	map.set(1, 1);
+	map.set(2, 2);
+	size_t snapshot = map.snapshot();
+	map.set(1, 3);
+	{
+		auto saved = std::exchange(map, {});
+		map.set(2, 4);
+		map = std::move(saved);
+	}
+	map.set(3, 3);
+	map.joinWith(snapshot);
+	BOOST_CHECK(map.find(1) == nullptr);
+	BOOST_REQUIRE(map.find(2));
+	BOOST_CHECK_EQUAL(*map.find(2), 2);
+	BOOST_CHECK(map.find(3) == nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -0,0 +1,208 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for PersistentObjectCache and its use by ObjectOptimizer.
+ */
+
+#include <libyul/PersistentObjectCache.h>
+#include <libyul/ObjectOptimizer.h>
+#include <libyul/YulStack.h>
+
+#include <libsolidity/interface/OptimiserSettings.h>
+
+#include <liblangutil/DebugInfoSelection.h>
+#include <liblangutil/EVMVersion.h>
+
+#include <libsolutil/Keccak256.h>
+#include <libsolutil/TemporaryDirectory.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+#include <memory>
+#include <string>
+
+using namespace solidity::util;
+
+namespace solidity::yul::test
+{
+
+namespace
+{
+
+size_t countEntries(boost::filesystem::path const& _directory)
+{
+	size_t count = 0;
+	for (auto const& entry: boost::filesystem::directory_iterator(_directory))
+		if (entry.path().extension() == ".yul")
+			++count;
+	return count;
+}
+
+std::string optimizeWithCache(
+	std::string const& _source,
+	std::shared_ptr<PersistentObjectCache> _cache,
+	std::optional<uint8_t> _eofVersion = std::nullopt
+)
+{
+	auto objectOptimizer = std::make_shared<ObjectOptimizer>();
+	objectOptimizer->setPersistentCache(std::move(_cache));
+
+	YulStack stack(
+		_eofVersion ? langutil::EVMVersion::prague() : langutil::EVMVersion{},
+		_eofVersion,
+		YulStack::Language::StrictAssembly,
+		frontend::OptimiserSettings::full(),
+		langutil::DebugInfoSelection::All(),
+		nullptr /* _soliditySourceProvider */,
+		objectOptimizer
+	);
+	BOOST_REQUIRE(stack.parseAndAnalyze("source.yul", _source));
+	stack.optimize();
+	return stack.print();
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(PersistentObjectCacheTest, *boost::unit_test::label("nooptions"))
+
+BOOST_AUTO_TEST_CASE(store_and_load)
+{
+	TemporaryDirectory tempDir("persistent-object-cache-test");
+	PersistentObjectCache cache(tempDir.path() / "cache", 1024 * 1024, "version");
+
+	BOOST_TEST(!cache.load(keccak256("a")).has_value());
+	cache.store(keccak256("a"), "{ }");
+	BOOST_CHECK(cache.load(keccak256("a")) == "{ }");
+	BOOST_TEST(!cache.load(keccak256("b")).has_value());
+
+	PersistentObjectCache::Statistics statistics = cache.statistics();
+	BOOST_TEST(statistics.hits == 1);
+	BOOST_TEST(statistics.misses == 2);
+	BOOST_TEST(statistics.bytesRead == 3);
+	BOOST_TEST(statistics.bytesWritten > 3);
+}
+
+BOOST_AUTO_TEST_CASE(entries_are_shared_only_within_one_compiler_version)
+{
+	TemporaryDirectory tempDir("persistent-object-cache-test");
+	PersistentObjectCache(tempDir.path(), 1024 * 1024, "version 1").store(keccak256("a"), "{ }");
+
+	BOOST_CHECK(PersistentObjectCache(tempDir.path(), 1024 * 1024, "version 1").load(keccak256("a")) == "{ }");
+	BOOST_TEST(!PersistentObjectCache(tempDir.path(), 1024 * 1024, "version 2").load(keccak256("a")).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(corrupted_entries_are_ignored)
+{
+	TemporaryDirectory tempDir("persistent-object-cache-test");
+	PersistentObjectCache cache(tempDir.path(), 1024 * 1024, "version");
+	cache.store(keccak256("a"), "{ let x := 1 }");
+
+	BOOST_REQUIRE(countEntries(tempDir.path()) == 1);
+	for (auto const& entry: boost::filesystem::directory_iterator(tempDir.path()))
+	{
+		std::ofstream file(entry.path().string(), std::ios::app);
+		file << "garbage";
+	}
+
+	BOOST_TEST(!cache.load(keccak256("a")).has_value());
+	BOOST_TEST(cache.statistics().misses == 1);
+}
+
+BOOST_AUTO_TEST_CASE(eviction_respects_size_limit)
+{
+	TemporaryDirectory tempDir("persistent-object-cache-test");
+	std::string const content(100, 'x');
+	PersistentObjectCache cache(tempDir.path(), 350, "version");
+	for (std::string key: {"a", "b", "c", "d", "e"})
+		cache.store(keccak256(key), content);
+	BOOST_TEST(countEntries(tempDir.path()) == 5);
+
+	cache.evict();
+	// Each entry carries a header in addition to the content.
+	BOOST_TEST(countEntries(tempDir.path()) == 2);
+	BOOST_TEST(cache.statistics().evictedEntries == 3);
+
+	cache.evict();
+	BOOST_TEST(cache.statistics().evictedEntries == 3);
+}
+
+BOOST_AUTO_TEST_CASE(optimized_objects_are_reused_across_optimizers)
+{
+	std::string const source = R"(
+		/// @use-src 0:"a.sol"
+		object "C" {
+			code {
+				/// @src 0:10:20
+				let x := add(calldataload(0), 1)
+				sstore(0, x)
+			}
+		}
+	)";
+
+	TemporaryDirectory tempDir("persistent-object-cache-test");
+	auto cache = std::make_shared<PersistentObjectCache>(tempDir.path(), 1024 * 1024, "version");
+
+	std::string const uncached = optimizeWithCache(source, nullptr);
+	BOOST_TEST(optimizeWithCache(source, cache) == uncached);
+	BOOST_TEST(cache->statistics().hits == 0);
+	BOOST_TEST(countEntries(tempDir.path()) == 1);
+
+	BOOST_TEST(optimizeWithCache(source, cache) == uncached);
+	BOOST_TEST(cache->statistics().hits == 1);
+}
+
+BOOST_AUTO_TEST_CASE(legacy_and_eof_objects_are_stored_separately)
+{
+	std::string const source = R"(
+		/// @use-src 0:"a.sol"
+		object "C" {
+			code {
+				/// @src 0:10:20
+				sstore(0, add(calldataload(0), 1))
+			}
+		}
+	)";
+
+	TemporaryDirectory tempDir("persistent-object-cache-test");
+	auto cache = std::make_shared<PersistentObjectCache>(tempDir.path(), 1024 * 1024, "version");
+
+	optimizeWithCache(source, cache, std::nullopt);
+	optimizeWithCache(source, cache, 1);
+	BOOST_TEST(cache->statistics().hits == 0);
+	BOOST_TEST(countEntries(tempDir.path()) == 2);
+
+	optimizeWithCache(source, cache, std::nullopt);
+	optimizeWithCache(source, cache, 1);
+	BOOST_TEST(cache->statistics().hits == 2);
+}
+
+BOOST_AUTO_TEST_CASE(objects_without_source_names_are_not_persisted)
+{
+	TemporaryDirectory tempDir("persistent-object-cache-test");
+	auto cache = std::make_shared<PersistentObjectCache>(tempDir.path(), 1024 * 1024, "version");
+
+	optimizeWithCache("{ sstore(0, calldataload(0)) }", cache);
+	BOOST_TEST(countEntries(tempDir.path()) == 0);
+	BOOST_TEST(cache->statistics().misses == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -0,0 +1,381 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the matching of Yul expressions against the simplification rules.
+ */
+
+#include <test/libyul/Common.h>
+
+#include <libyul/optimiser/ASTWalker.h>
+#include <libyul/optimiser/DataFlowAnalyzer.h>
+#include <libyul/optimiser/SimplificationRules.h>
+#include <libyul/optimiser/SSAValueTracker.h>
+#include <libyul/backends/evm/EVMDialect.h>
+#include <libyul/AsmPrinter.h>
+#include <libyul/AST.h>
+#include <libyul/Object.h>
+
+#include <libevmasm/RuleList.h>
+
+#include <liblangutil/Exceptions.h>
+
+#include <libsolutil/CommonData.h>
+#include <libsolutil/StringUtils.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <random>
+
+using namespace solidity::evmasm;
+using namespace solidity::langutil;
+using namespace solidity::util;
+
+namespace solidity::yul::test
+{
+
+/// The simplification rules in the order of the rule list, matched one after another without
+/// the rule tree, as SimplificationRules::findFirstMatch did before the tree was introduced.
+class LinearRuleList
+{
+public:
+	explicit LinearRuleList(EVMVersion _evmVersion)
+	{
+		yul::Pattern A(PatternKind::Constant);
+		yul::Pattern B(PatternKind::Constant);
+		yul::Pattern C(PatternKind::Constant);
+		yul::Pattern W;
+		yul::Pattern X;
+		yul::Pattern Y;
+		yul::Pattern Z;
+		A.setMatchGroup(1, m_matchGroups);
+		B.setMatchGroup(2, m_matchGroups);
+		C.setMatchGroup(3, m_matchGroups);
+		W.setMatchGroup(4, m_matchGroups);
+		X.setMatchGroup(5, m_matchGroups);
+		Y.setMatchGroup(6, m_matchGroups);
+		Z.setMatchGroup(7, m_matchGroups);
+		m_rules = simplificationRuleList(_evmVersion, A, B, C, W, X, Y, Z);
+	}
+
+	/// @returns the indices of all rules matching @a _expr, in rule order.
+	std::vector<size_t> matchingRules(
+		Expression const& _expr,
+		Dialect const& _dialect,
+		std::function<AssignedValue const*(YulName)> const& _ssaValues
+	)
+	{
+		std::vector<size_t> result;
+		if (!SimplificationRules::instructionAndArguments(_dialect, _expr))
+			return result;
+		for (size_t index = 0; index < m_rules.size(); ++index)
+			if (matches(index, _expr, _dialect, _ssaValues))
+				result.push_back(index);
+		return result;
+	}
+
+	/// Matches @a _expr against the rule at @a _index, leaving the match groups set on success.
+	bool matches(
+		size_t _index,
+		Expression const& _expr,
+		Dialect const& _dialect,
+		std::function<AssignedValue const*(YulName)> const& _ssaValues
+	)
+	{
+		m_matchGroups.clear();
+		SimplificationRules::Rule const& rule = m_rules.at(_index);
+		return rule.pattern.matches(_expr, _dialect, _ssaValues) && (!rule.feasible || rule.feasible());
+	}
+
+	SimplificationRules::Rule const& rule(size_t _index) const { return m_rules.at(_index); }
+
+private:
+	std::map<unsigned, Expression const*> m_matchGroups;
+	std::vector<SimplificationRules::Rule> m_rules;
+};
+
+namespace
+{
+
+/// Collects all expressions of an AST in the order they are visited.
+class ExpressionCollector: public ASTWalker
+{
+public:
+	using ASTWalker::visit;
+	void visit(Expression const& _expression) override
+	{
+		expressions.push_back(&_expression);
+		ASTWalker::visit(_expression);
+	}
+
+	std::vector<Expression const*> expressions;
+};
+
+std::string describePattern(yul::Pattern const& _pattern, EVMVersion _evmVersion)
+{
+	PatternSymbol symbol = _pattern.symbol();
+	std::string result;
+	switch (symbol.kind)
+	{
+	case PatternSymbol::Kind::Any:
+		result = "_";
+		break;
+	case PatternSymbol::Kind::Constant:
+		result = symbol.value ? formatNumber(*symbol.value) : "#";
+		break;
+	case PatternSymbol::Kind::Operation:
+		result = toLower(instructionInfo(symbol.instruction, _evmVersion).name);
+		result += "(" + joinHumanReadable(
+			applyMap(_pattern.arguments(), [&](yul::Pattern const& _argument) { return describePattern(_argument, _evmVersion); }),
+			", "
+		) + ")";
+		break;
+	}
+	if (_pattern.matchGroup())
+		result += "@" + std::to_string(_pattern.matchGroup());
+	return result;
+}
+
+/// @returns a description of the rule and of its replacement for the expression it just matched.
+std::string describeMatch(SimplificationRules::Rule const& _rule, EVMVersion _evmVersion)
+{
+	Expression replacement = _rule.action().toExpression(nullptr, _evmVersion);
+	return describePattern(_rule.pattern, _evmVersion) + " -> " + std::visit(AsmPrinter{}, replacement);
+}
+
+/// Generates Yul code in the form the expression simplifier usually sees: every operation is
+/// assigned to its own variable and its arguments are variables or literals, with the occasional
+/// nested call. Arguments are drawn from a small pool, so that repeated arguments and
+/// constants on either side of commutative operations are common.
+std::string randomProgram(std::mt19937& _random, EVMVersion _evmVersion)
+{
+	std::vector<std::pair<std::string, size_t>> operations{
+		{"add", 2}, {"sub", 2}, {"mul", 2}, {"div", 2}, {"sdiv", 2}, {"mod", 2}, {"smod", 2}, {"exp", 2},
+		{"not", 1}, {"lt", 2}, {"gt", 2}, {"slt", 2}, {"sgt", 2}, {"eq", 2}, {"iszero", 1},
+		{"and", 2}, {"or", 2}, {"xor", 2}, {"byte", 2}, {"addmod", 3}, {"mulmod", 3}, {"signextend", 2},
+		{"address", 0}, {"caller", 0}, {"origin", 0}, {"balance", 1}
+	};
+	if (_evmVersion.hasBitwiseShifting())
+		operations += std::vector<std::pair<std::string, size_t>>{{"shl", 2}, {"shr", 2}, {"sar", 2}};
+	std::vector<std::string> const literals{
+		"0", "1", "2", "7", "31", "32", "255", "256",
+		"0xffffffffffffffffffffffffffffffffffffffff",
+		"0x8000000000000000000000000000000000000000000000000000000000000000",
+		"0xffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff"
+	};
+
+	auto pick = [&](size_t _size) { return std::uniform_int_distribution<size_t>(0, _size - 1)(_random); };
+	std::vector<std::string> variables{"x", "y"};
+	std::function<std::string(size_t)> expression = [&](size_t _depth) {
+		auto const& [name, arity] = operations[pick(operations.size())];
+		std::vector<std::string> arguments;
+		for (size_t i = 0; i < arity; ++i)
+		{
+			size_t kind = pick(8);
+			if (kind < 4)
+				// Prefer recent variables, so that nested patterns get a chance to match.
+				arguments.push_back(variables[variables.size() - 1 - pick(std::min<size_t>(variables.size(), 4))]);
+			else if (kind < 7)
+				arguments.push_back(literals[pick(literals.size())]);
+			else if (_depth == 0)
+				arguments.push_back(expression(_depth + 1));
+			else
+				arguments.push_back(variables[pick(variables.size())]);
+		}
+		return name + "(" + joinHumanReadable(arguments, ", ") + ")";
+	};
+
+	std::string source = "{ let x := calldataload(0) let y := calldataload(32)\n";
+	for (size_t i = 0; i < 40; ++i)
+	{
+		std::string variable = "v" + std::to_string(i);
+		source += "let " + variable + " := " + expression(0) + "\n";
+		variables.push_back(std::move(variable));
+	}
+	source += "sstore(0, " + variables.back() + ") }";
+	return source;
+}
+
+}
+
+class SimplificationRulesTest
+{
+protected:
+	/// Checks for every expression in @a _source that findFirstMatch returns the first rule that
+	/// matches in rule order.
+	void checkFirstMatch(std::string const& _source, EVMVersion _evmVersion)
+	{
+		EVMDialect const& dialect = EVMDialect::strictAssemblyForEVMObjects(_evmVersion, std::nullopt);
+		ErrorList errors;
+		auto [object, analysisInfo] = yul::test::parse(_source, dialect, errors);
+		BOOST_REQUIRE_MESSAGE(object && errors.empty() && object->hasCode(), "Invalid source: " + _source);
+		Block const& root = object->code()->root();
+
+		SSAValueTracker ssaValueTracker;
+		ssaValueTracker(root);
+		std::map<YulName, AssignedValue> values;
+		for (auto const& [name, expression]: ssaValueTracker.values())
+			values[name].value = expression;
+		std::function<AssignedValue const*(YulName)> ssaValues = [&](YulName _name) {
+			return valueOrNullptr(values, _name);
+		};
+
+		ExpressionCollector collector;
+		collector(root);
+
+		LinearRuleList& linearRules = linearRuleList(_evmVersion);
+		for (Expression const* expression: collector.expressions)
+		{
+			std::vector<size_t> expected = linearRules.matchingRules(*expression, dialect, ssaValues);
+			SimplificationRules::Rule const* rule = SimplificationRules::findFirstMatch(*expression, dialect, ssaValues);
+			std::string printed = std::visit(AsmPrinter{}, *expression);
+			if (expected.empty())
+			{
+				BOOST_CHECK_MESSAGE(!rule, "Unexpected match for " + printed);
+				continue;
+			}
+			BOOST_REQUIRE_MESSAGE(rule, "No match for " + printed);
+			std::string actual = describeMatch(*rule, _evmVersion);
+			BOOST_REQUIRE(linearRules.matches(expected.front(), *expression, dialect, ssaValues));
+			BOOST_CHECK_EQUAL(actual, describeMatch(linearRules.rule(expected.front()), _evmVersion));
+
+			++m_matchedExpressions;
+			if (expected.size() > 1)
+				++m_expressionsWithSeveralMatches;
+		}
+	}
+
+	LinearRuleList& linearRuleList(EVMVersion _evmVersion)
+	{
+		auto& rules = m_linearRules[_evmVersion];
+		if (!rules)
+			rules = std::make_unique<LinearRuleList>(_evmVersion);
+		return *rules;
+	}
+
+	size_t m_matchedExpressions = 0;
+	size_t m_expressionsWithSeveralMatches = 0;
+
+private:
+	std::map<EVMVersion, std::unique_ptr<LinearRuleList>> m_linearRules;
+};
+
+BOOST_FIXTURE_TEST_SUITE(YulSimplificationRules, SimplificationRulesTest)
+
+BOOST_AUTO_TEST_CASE(rule_order)
+{
+	// Each of these matches several rules, the first of which has to be returned.
+	checkFirstMatch(R"({
+		let x := calldataload(0)
+		let a := and(x, x)
+		let b := or(x, x)
+		let c := xor(x, x)
+		let d := sub(x, x)
+		let e := eq(x, x)
+		let f := and(0, x)
+		let g := mul(x, 0)
+		let h := div(0, 0)
+		let i := iszero(iszero(iszero(x)))
+		sstore(0, add(add(a, b), add(c, d)))
+	})", EVMVersion{});
+	BOOST_CHECK(m_expressionsWithSeveralMatches > 0);
+}
+
+BOOST_AUTO_TEST_CASE(commutative_patterns)
+{
+	checkFirstMatch(R"({
+		let x := calldataload(0)
+		let a := add(x, 0)
+		let b := add(0, x)
+		let c := mul(x, 1)
+		let d := mul(1, x)
+		let e := and(x, 0xffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff)
+		let f := and(0xffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff, x)
+		let s := add(x, 3)
+		let t := add(3, x)
+		let g := add(s, 4)
+		let h := add(4, s)
+		let i := add(t, 4)
+		let j := add(4, t)
+		let m := and(x, 0xff)
+		let n := and(0xff, x)
+		let k := and(m, 0xf0)
+		let l := and(0xf0, n)
+		sstore(0, add(add(add(a, b), add(c, d)), add(e, f)))
+		sstore(1, add(add(add(g, h), add(i, j)), add(k, l)))
+	})", EVMVersion{});
+	// Each of a to l matches a rule, irrespective of the side the constants are on.
+	BOOST_CHECK(m_matchedExpressions >= 12);
+}
+
+BOOST_AUTO_TEST_CASE(wildcard_reuse)
+{
+	// Patterns like sub(X, X) or and(X, not(X)) only match if both occurrences of X are the same.
+	checkFirstMatch(R"({
+		let x := calldataload(0)
+		let y := calldataload(32)
+		let nx := not(x)
+		let a := sub(x, x)
+		let b := sub(x, y)
+		let c := and(x, nx)
+		let d := and(y, nx)
+		let e := or(nx, x)
+		let f := or(nx, y)
+		let xy := xor(x, y)
+		let xx := xor(x, x)
+		let g := xor(xy, y)
+		let h := xor(xy, x)
+		let i := xor(y, xy)
+		let j := xor(y, xx)
+		sstore(0, add(add(add(a, b), add(c, d)), add(add(e, f), add(g, h))))
+		sstore(1, add(i, j))
+	})", EVMVersion{});
+}
+
+BOOST_AUTO_TEST_CASE(ssa_values)
+{
+	// Variables are replaced by their values, except when matching a wildcard.
+	checkFirstMatch(R"({
+		let x := calldataload(0)
+		let zero := 0
+		let one := 1
+		let a := address()
+		let notX := not(x)
+		let b := add(x, zero)
+		let c := mul(one, x)
+		let d := balance(a)
+		let e := not(notX)
+		let f := and(x, notX)
+		sstore(0, add(add(b, c), add(d, add(e, f))))
+	})", EVMVersion::istanbul());
+}
+
+BOOST_AUTO_TEST_CASE(random_expressions)
+{
+	for (EVMVersion evmVersion: {EVMVersion::homestead(), EVMVersion::istanbul(), EVMVersion{}})
+		for (unsigned seed = 0; seed < 40; ++seed)
+		{
+			std::mt19937 random(seed);
+			checkFirstMatch(randomProgram(random, evmVersion), evmVersion);
+		}
+	BOOST_CHECK(m_matchedExpressions > 1000);
+	BOOST_CHECK(m_expressionsWithSeveralMatches > 100);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
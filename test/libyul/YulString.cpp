@@ -0,0 +1,134 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for YulString and YulStringRepository.
+ */
+
+#include <libyul/YulStack.h>
+#include <libyul/YulString.h>
+
+#include <libsolutil/Parallel.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+#include <vector>
+
+namespace solidity::yul::test
+{
+
+BOOST_AUTO_TEST_SUITE(YulStringTest, *boost::unit_test::label("nooptions"))
+
+BOOST_AUTO_TEST_CASE(equal_strings_share_id)
+{
+	YulString a("abc");
+	YulString b(std::string("ab") + "c");
+	YulString c("abd");
+	BOOST_CHECK(a == b);
+	BOOST_CHECK(a != c);
+	BOOST_CHECK_EQUAL(a.str(), "abc");
+	BOOST_CHECK_EQUAL(c.str(), "abd");
+	BOOST_CHECK(YulString().empty());
+	BOOST_CHECK(YulString("") == YulString());
+}
+
+BOOST_AUTO_TEST_CASE(many_strings)
+{
+	// Enough strings to need several chunks of storage.
+	std::vector<YulString> names;
+	for (size_t i = 0; i < 20000; ++i)
+		names.emplace_back("name_" + std::to_string(i));
+	for (size_t i = 0; i < names.size(); ++i)
+	{
+		BOOST_REQUIRE_EQUAL(names[i].str(), "name_" + std::to_string(i));
+		BOOST_REQUIRE(names[i] == YulString("name_" + std::to_string(i)));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_interning)
+{
+	size_t constexpr stringCount = 5000;
+	size_t constexpr threadCount = 8;
+	std::vector<std::vector<YulString>> results(threadCount);
+	std::vector<std::vector<std::string>> strings(threadCount);
+	// Note that Boost.Test assertions must not be used on the worker threads.
+	util::parallelFor(threadCount, threadCount, [&](size_t _thread) {
+		for (size_t i = 0; i < stringCount; ++i)
+		{
+			// Every thread interns the same strings, but in a different order.
+			size_t index = (i * (2 * _thread + 1)) % stringCount;
+			results[_thread].emplace_back("concurrent_" + std::to_string(index));
+			strings[_thread].emplace_back(results[_thread].back().str());
+		}
+	});
+
+	for (size_t thread = 0; thread < threadCount; ++thread)
+		for (size_t i = 0; i < stringCount; ++i)
+		{
+			std::string expected = "concurrent_" + std::to_string((i * (2 * thread + 1)) % stringCount);
+			BOOST_REQUIRE_EQUAL(strings[thread][i], expected);
+			BOOST_REQUIRE(results[thread][i] == YulString(expected));
+		}
+}
+
+BOOST_AUTO_TEST_CASE(reset_is_deferred_while_compilation_is_active)
+{
+	{
+		YulStringRepository::CompilationScope scope;
+		YulString a("only_in_this_compilation");
+		YulStringRepository::reset();
+		// The reset must not invalidate strings of the running compilation.
+		BOOST_CHECK_EQUAL(a.str(), "only_in_this_compilation");
+		BOOST_CHECK(a == YulString("only_in_this_compilation"));
+		BOOST_CHECK_GT(YulStringRepository::instance().size(), 1);
+	}
+	// The pending reset is performed once the last compilation is done.
+	BOOST_CHECK_EQUAL(YulStringRepository::instance().size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(reset_when_done)
+{
+	{
+		YulStringRepository::CompilationScope outer{true /* _resetWhenDone */};
+		{
+			YulStringRepository::CompilationScope inner{true /* _resetWhenDone */};
+			YulString a("nested");
+		}
+		BOOST_CHECK_GT(YulStringRepository::instance().size(), 1);
+	}
+	BOOST_CHECK_EQUAL(YulStringRepository::instance().size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(yul_stack_defers_reset)
+{
+	{
+		YulStack stack;
+		YulString a("only_in_this_stack");
+		{
+			// Another compilation in the same process finishes while the stack is still in use.
+			YulStringRepository::CompilationScope scope{true /* _resetWhenDone */};
+		}
+		BOOST_CHECK_EQUAL(a.str(), "only_in_this_stack");
+		BOOST_CHECK(a == YulString("only_in_this_stack"));
+	}
+	BOOST_CHECK_EQUAL(YulStringRepository::instance().size(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
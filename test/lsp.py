@@ -1721,6 +1721,52 @@ class SolidityLSPTestSuite: # {{{
         self.expect_diagnostic(diagnostics[0], code=6321, marker=markers["@unusedReturnVariable"])
         self.expect_diagnostic(diagnostics[1], code=2072, marker=markers["@unusedContractVariable"])
 
+    def test_textDocument_didChange_burst_is_analysed_once(self, solc: JsonRpcProcess) -> None:
+        self.setup_lsp(solc)
+        TEST_NAME = 'publish_diagnostics_1'
+        published_diagnostics = self.open_file_and_wait_for_diagnostics(solc, TEST_NAME, "goto")
+        self.expect_equal(len(published_diagnostics), 1, "One published_diagnostics message")
+        self.expect_equal(len(published_diagnostics[0]['diagnostics']), 3, "3 diagnostic messages")
+        markers = self.get_test_tags(TEST_NAME, "goto")
+        uri = self.get_test_file_uri(TEST_NAME, "goto")
+
+        # Two changes sent back to back are analysed together, so only a single
+        # round of diagnostics is published for them.
+        for marker, amount in (("@unusedVariable", 1), ("@unusedContractVariable", 3)):
+            solc.send_message(
+                'textDocument/didChange',
+                {
+                    'textDocument': {
+                        'uri': uri
+                    },
+                    'contentChanges': [
+                        {
+                            'range': extendEnd(markers[marker], amount),
+                            'text': ""
+                        }
+                    ]
+                }
+            )
+        published_diagnostics = self.wait_for_diagnostics(solc)
+        self.expect_equal(len(published_diagnostics), 1)
+        report = published_diagnostics[0]
+        self.expect_equal(report['uri'], uri, "Correct file URI")
+        diagnostics = report['diagnostics']
+        self.expect_equal(len(diagnostics), 1)
+        self.expect_diagnostic(diagnostics[0], code=6321, marker=markers["@unusedReturnVariable"])
+
+        # The next message must be the response to this request, not another diagnostics round.
+        response = solc.call_method(
+            'textDocument/definition',
+            {
+                'textDocument': {
+                    'uri': uri,
+                },
+                'position': markers["@unusedReturnVariable"]["start"]
+            }
+        )
+        self.expect_equal('method' in response, False, "No further diagnostics published")
+
     def test_textDocument_didChange_delete_line_and_close(self, solc: JsonRpcProcess) -> None:
         # Reuse this test to prepare and ensure it is as expected
         self.test_textDocument_didOpen_with_relative_import(solc)
@@ -120,12 +120,14 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 			"--evm-version=spuriousDragon",
 			"--via-ir",
 			"--experimental-via-ir",
+			"--jobs=4",
 			"--revert-strings=strip",
 			"--debug-info=location",
 			"--pretty-json",
 			"--json-indent=7",
 			"--no-color",
 			"--error-codes",
+			"--verbose",
 			"--libraries="
 				"dir1/file1.sol:L=0x1234567890123456789012345678901234567890,"
 				"dir2/file2.sol:L=0x1111122222333334444455555666667777788888",
@@ -143,17 +145,23 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 			"--optimize-yul",
 			"--optimize-runs=1000",
 			"--yul-optimizations=agf",
+			"--optimizer-cache-dir=/tmp/cache",
+			"--optimizer-cache-size=16",
 			"--model-checker-bmc-loop-iterations=2",
+			"--model-checker-cache=/tmp/smt-cache",
 			"--model-checker-contracts=contract1.yul:A,contract2.yul:B",
 			"--model-checker-div-mod-no-slacks",
 			"--model-checker-engine=bmc",
 			"--model-checker-ext-calls=trusted",
 			"--model-checker-invariants=contract,reentrancy",
+			"--model-checker-race-solvers",
 			"--model-checker-show-proved-safe",
 			"--model-checker-show-unproved",
 			"--model-checker-show-unsupported",
+			"--model-checker-solver-processes=2",
 			"--model-checker-solvers=z3,smtlib2",
 			"--model-checker-targets=underflow,divByZero",
+			"--model-checker-threads=4",
 			"--model-checker-timeout=5"
 		};
 
@@ -181,6 +189,7 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 		expectedOptions.output.overwriteFiles = true;
 		expectedOptions.output.evmVersion = EVMVersion::spuriousDragon();
 		expectedOptions.output.viaIR = true;
+		expectedOptions.output.jobs = 4;
 		expectedOptions.output.revertStrings = RevertStrings::Strip;
 		expectedOptions.output.debugInfoSelection = DebugInfoSelection::fromString("location");
 		expectedOptions.formatting.json = JsonFormat{JsonFormat::Pretty, 7};
@@ -190,6 +199,7 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 		};
 		expectedOptions.formatting.coloredOutput = false;
 		expectedOptions.formatting.withErrorIds = true;
+		expectedOptions.formatting.verbose = true;
 		expectedOptions.compiler.outputs = {
 			true, true, true, true, true,
 			true, true, true, true, true,
@@ -209,8 +219,11 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 		expectedOptions.optimizer.optimizeYul = true;
 		expectedOptions.optimizer.expectedExecutionsPerDeployment = 1000;
 		expectedOptions.optimizer.yulSteps = "agf";
+		expectedOptions.optimizer.cacheDir = "/tmp/cache";
+		expectedOptions.optimizer.cacheSizeLimit = 16 * 1024 * 1024;
 
 		expectedOptions.modelChecker.initialize = true;
+		expectedOptions.modelChecker.cacheDir = "/tmp/smt-cache";
 		expectedOptions.modelChecker.settings = {
 			2,
 			{{{"contract1.yul", {"A"}}, {"contract2.yul", {"B"}}}},
@@ -219,11 +232,14 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 			{ModelCheckerExtCalls::Mode::TRUSTED},
 			{{InvariantType::Contract, InvariantType::Reentrancy}},
 			false, // --model-checker-print-query
+			true, // --model-checker-race-solvers
 			true,
 			true,
 			true,
+			2, // --model-checker-solver-processes
 			{false, false, true, true},
 			{{VerificationTargetType::Underflow, VerificationTargetType::DivByZero}},
+			4, // --model-checker-threads
 			5,
 		};
 
@@ -267,6 +283,30 @@ BOOST_AUTO_TEST_CASE(via_ir_options)
 		BOOST_TEST(parseCommandLine({"solc", viaIrOption, "contract.sol"}).output.viaIR);
 }
 
+BOOST_AUTO_TEST_CASE(jobs_option)
+{
+	BOOST_TEST(parseCommandLine({"solc", "contract.sol"}).output.jobs == 1);
+	BOOST_TEST(parseCommandLine({"solc", "--jobs=0", "contract.sol"}).output.jobs == 0);
+	BOOST_TEST(parseCommandLine({"solc", "--via-ir", "--jobs", "8", "contract.sol"}).output.jobs == 8);
+}
+
+BOOST_AUTO_TEST_CASE(optimizer_cache_options)
+{
+	CommandLineOptions defaultOptions = parseCommandLine({"solc", "contract.sol"});
+	BOOST_TEST(!defaultOptions.optimizer.cacheDir.has_value());
+	BOOST_TEST(defaultOptions.optimizer.cacheSizeLimit == 1024 * 1024 * 1024);
+
+	CommandLineOptions assemblyOptions = parseCommandLine({"solc", "--strict-assembly", "--optimizer-cache-dir", "cache", "input.yul"});
+	BOOST_CHECK(assemblyOptions.optimizer.cacheDir == boost::filesystem::path("cache"));
+
+	std::string expectedMessage = "Option --optimizer-cache-size can only be used together with --optimizer-cache-dir.";
+	auto hasCorrectMessage = [&](CommandLineValidationError const& _exception) { return _exception.what() == expectedMessage; };
+	BOOST_CHECK_EXCEPTION(parseCommandLine({"solc", "--optimizer-cache-size=1", "contract.sol"}), CommandLineValidationError, hasCorrectMessage);
+
+	expectedMessage = "Empty values are not allowed in --optimizer-cache-dir.";
+	BOOST_CHECK_EXCEPTION(parseCommandLine({"solc", "--optimizer-cache-dir", "", "contract.sol"}), CommandLineValidationError, hasCorrectMessage);
+}
+
 BOOST_AUTO_TEST_CASE(assembly_mode_options)
 {
 	static std::vector<std::tuple<std::vector<std::string>, YulStack::Machine, YulStack::Language>> const allowedCombinations = {
@@ -391,6 +431,8 @@ BOOST_AUTO_TEST_CASE(standard_json_mode_options)
 			"dir2/file2.sol:L=0x1111122222333334444455555666667777788888",
 		"--gas",                           // Accepted but has no effect in Standard JSON mode
 		"--combined-json=abi,bin",         // Accepted but has no effect in Standard JSON mode
+		"--model-checker-cache=/tmp/smt-cache",
+		"--stream-output",
 	};
 
 	CommandLineOptions expectedOptions;
@@ -411,6 +453,8 @@ BOOST_AUTO_TEST_CASE(standard_json_mode_options)
 	expectedOptions.compiler.combinedJsonRequests = CombinedJsonRequests{};
 	expectedOptions.compiler.combinedJsonRequests->abi = true;
 	expectedOptions.compiler.combinedJsonRequests->binary = true;
+	expectedOptions.modelChecker.cacheDir = "/tmp/smt-cache";
+	expectedOptions.output.streamStandardJson = true;
 
 	CommandLineOptions parsedOptions = parseCommandLine(commandLine);
 
@@ -423,6 +467,9 @@ BOOST_AUTO_TEST_CASE(invalid_options_input_modes_combinations)
 		// TODO: This should eventually contain all options.
 		{"--experimental-via-ir", {"--assemble", "--strict-assembly", "--standard-json", "--link"}},
 		{"--via-ir", {"--assemble", "--strict-assembly", "--standard-json", "--link"}},
+		{"--jobs=2", {"--assemble", "--strict-assembly", "--standard-json", "--link"}},
+		{"--optimizer-cache-dir=/tmp/cache", {"--standard-json", "--link"}},
+		{"--optimizer-cache-size=16", {"--standard-json", "--link"}},
 		{"--metadata-literal", {"--assemble", "--strict-assembly", "--standard-json", "--link"}},
 		{"--metadata-hash=swarm", {"--assemble", "--strict-assembly", "--standard-json", "--link"}},
 		{"--model-checker-show-proved-safe", {"--assemble", "--strict-assembly", "--standard-json", "--link"}},
@@ -431,10 +478,15 @@ BOOST_AUTO_TEST_CASE(invalid_options_input_modes_combinations)
 		{"--model-checker-div-mod-no-slacks", {"--assemble", "--strict-assembly", "--standard-json", "--link"}},
 		{"--model-checker-engine=bmc", {"--assemble", "--strict-assembly", "--standard-json", "--link"}},
 		{"--model-checker-invariants=contract,reentrancy", {"--assemble", "--strict-assembly", "--standard-json", "--link"}},
+		{"--model-checker-race-solvers", {"--assemble", "--strict-assembly", "--standard-json", "--link"}},
+		{"--model-checker-cache=/tmp/smt-cache", {"--assemble", "--strict-assembly", "--link"}},
+		{"--model-checker-solver-processes=2", {"--assemble", "--strict-assembly", "--standard-json", "--link"}},
 		{"--model-checker-solvers=z3,smtlib2", {"--assemble", "--strict-assembly", "--standard-json", "--link"}},
 		{"--model-checker-timeout=5", {"--assemble", "--strict-assembly", "--standard-json", "--link"}},
 		{"--model-checker-contracts=contract1.yul:A,contract2.yul:B", {"--assemble", "--strict-assembly", "--standard-json", "--link"}},
-		{"--model-checker-targets=underflow,divByZero", {"--assemble", "--strict-assembly", "--standard-json", "--link"}}
+		{"--model-checker-targets=underflow,divByZero", {"--assemble", "--strict-assembly", "--standard-json", "--link"}},
+		{"--model-checker-threads=4", {"--assemble", "--strict-assembly", "--standard-json", "--link"}},
+		{"--stream-output", {"--assemble", "--strict-assembly", "--link"}}
 	};
 
 	for (auto const& [optionName, inputModes]: invalidOptionInputModeCombinations)
@@ -112,11 +112,14 @@ void FuzzerUtil::testCompiler(
 			frontend::ModelCheckerExtCalls{},
 			frontend::ModelCheckerInvariants::All(),
 			/*printQuery=*/false,
+			/*raceSolvers=*/false,
 			/*showProvedSafe=*/false,
 			/*showUnproved=*/false,
 			/*showUnsupported=*/false,
+			/*solverProcesses=*/0,
 			smtutil::SMTSolverChoice::All(),
 			frontend::ModelCheckerTargets::Default(),
+			/*threads=*/1,
 			/*timeout=*/1
 		});
 	}
@@ -0,0 +1,123 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Micro-benchmark comparing scalar and batched Keccak-256 on inputs of a given length.
+ */
+
+#include <libsolutil/Keccak256.h>
+
+#include <boost/program_options.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace solidity;
+using namespace solidity::util;
+
+namespace po = boost::program_options;
+
+namespace
+{
+
+template<typename Function>
+double measureNanosecondsPerHash(size_t _hashes, size_t _repetitions, Function&& _function)
+{
+	auto start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < _repetitions; ++i)
+		_function();
+	auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+	return static_cast<double>(duration.count()) / static_cast<double>(_hashes * _repetitions);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	po::options_description options(
+		R"(keccakBenchmark, micro-benchmark for Keccak-256.
+Usage: keccakBenchmark [Options]
+Hashes a number of distinct inputs of the given length one by one and in batches
+and reports the time per hash.
+
+Allowed options)",
+		po::options_description::m_default_line_length,
+		po::options_description::m_default_line_length - 23);
+	options.add_options()
+		("help", "Show this help screen.")
+		("inputs", po::value<size_t>()->default_value(10000), "Number of distinct inputs.")
+		("length", po::value<size_t>()->default_value(32), "Length of each input in bytes.")
+		("repetitions", po::value<size_t>()->default_value(100), "Number of times all inputs are hashed.");
+
+	po::variables_map arguments;
+	try
+	{
+		po::store(po::parse_command_line(argc, argv, options), arguments);
+	}
+	catch (po::error const& _exception)
+	{
+		std::cerr << _exception.what() << std::endl;
+		return 1;
+	}
+
+	if (arguments.count("help"))
+	{
+		std::cout << options;
+		return 0;
+	}
+
+	size_t const inputCount = arguments["inputs"].as<size_t>();
+	size_t const length = arguments["length"].as<size_t>();
+	size_t const repetitions = arguments["repetitions"].as<size_t>();
+	if (inputCount == 0 || repetitions == 0)
+	{
+		std::cerr << "Number of inputs and repetitions must be positive." << std::endl;
+		return 1;
+	}
+
+	std::vector<bytes> inputs(inputCount, bytes(length));
+	for (size_t i = 0; i < inputCount; ++i)
+		for (size_t j = 0; j < length; ++j)
+			inputs[i][j] = static_cast<uint8_t>(i * 31 + j);
+	std::vector<bytesConstRef> inputRefs;
+	for (bytes const& input: inputs)
+		inputRefs.emplace_back(&input);
+
+	// Accumulate a checksum so that the work cannot be optimized away.
+	uint8_t checksum = 0;
+	double scalar = measureNanosecondsPerHash(inputCount, repetitions, [&]() {
+		for (bytesConstRef input: inputRefs)
+			checksum ^= keccak256(input)[0];
+	});
+	std::cout << "Lanes available: " << keccak256BatchLanes() << std::endl;
+	std::cout << "keccak256: " << scalar << " ns per hash" << std::endl;
+	for (size_t lanes = 4; lanes <= keccak256BatchLanes(); lanes *= 2)
+	{
+		double batched = measureNanosecondsPerHash(inputCount, repetitions, [&]() {
+			for (h256 const& hash: keccak256Batch(inputRefs, lanes))
+				checksum ^= hash[0];
+		});
+		std::cout <<
+			"keccak256Batch (" << lanes << " lanes): " << batched << " ns per hash, " <<
+			"speedup " << scalar / batched << std::endl;
+	}
+	std::cout << "Checksum: " << static_cast<unsigned>(checksum) << std::endl;
+
+	return 0;
+}
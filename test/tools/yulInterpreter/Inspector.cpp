@@ -52,8 +52,8 @@ void InspectedInterpreter::run(
 	bool _disableMemoryTrace
 )
 {
-	Scope scope;
-	InspectedInterpreter{_inspector, _state, _dialect, scope, _disableExternalCalls, _disableMemoryTrace}(_ast);
+	FrameLayout layout(_ast);
+	InspectedInterpreter{_inspector, _state, _dialect, layout, _disableExternalCalls, _disableMemoryTrace}(_ast);
 }
 
 Inspector::NodeAction Inspector::queryUser(langutil::DebugData const& _data, std::map<YulString, u256> const& _variables)
@@ -139,16 +139,16 @@ std::string Inspector::currentSource(langutil::DebugData const& _data) const
 	);
 }
 
-u256 InspectedInterpreter::evaluate(Expression const& _expression)
+u256 InspectedInterpreter::evaluate(Expression const& _expression, size_t _id)
 {
-	InspectedExpressionEvaluator ev(m_inspector, m_state, m_dialect, *m_scope, m_variables, m_disableExternalCalls, m_disableMemoryTrace);
-	ev.visit(_expression);
+	InspectedExpressionEvaluator ev(m_inspector, m_state, m_dialect, m_layout, *this, m_disableExternalCalls, m_disableMemoryTrace);
+	ev.visit(_expression, _id);
 	return ev.value();
 }
 
-std::vector<u256> InspectedInterpreter::evaluateMulti(Expression const& _expression)
+std::vector<u256> InspectedInterpreter::evaluateMulti(Expression const& _expression, size_t _id)
 {
-	InspectedExpressionEvaluator ev(m_inspector, m_state, m_dialect, *m_scope, m_variables, m_disableExternalCalls, m_disableMemoryTrace);
-	ev.visit(_expression);
+	InspectedExpressionEvaluator ev(m_inspector, m_state, m_dialect, m_layout, *this, m_disableExternalCalls, m_disableMemoryTrace);
+	ev.visit(_expression, _id);
 	return ev.values();
 }
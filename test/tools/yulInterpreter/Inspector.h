@@ -113,12 +113,11 @@ public:
 		std::shared_ptr<Inspector> _inspector,
 		InterpreterState& _state,
 		Dialect const& _dialect,
-		Scope& _scope,
+		FrameLayout const& _layout,
 		bool _disableExternalCalls,
-		bool _disableMemoryTracing,
-		std::map<YulName, u256> _variables = {}
+		bool _disableMemoryTracing
 	):
-		Interpreter(_state, _dialect, _scope, _disableExternalCalls, _disableMemoryTracing, _variables),
+		Interpreter(_state, _dialect, _layout, _disableExternalCalls, _disableMemoryTracing),
 		m_inspector(_inspector)
 	{
 	}
@@ -135,16 +134,16 @@ public:
 	void operator()(Block const& _node) override { helper(_node); }
 protected:
 	/// Asserts that the expression evaluates to exactly one value and returns it.
-	u256 evaluate(Expression const& _expression) override;
+	u256 evaluate(Expression const& _expression, size_t _id) override;
 	/// Evaluates the expression and returns its value.
-	std::vector<u256> evaluateMulti(Expression const& _expression) override;
+	std::vector<u256> evaluateMulti(Expression const& _expression, size_t _id) override;
 private:
 	std::shared_ptr<Inspector> m_inspector;
 
 	template <typename ConcreteNode>
 	void helper(ConcreteNode const& _node)
 	{
-		m_inspector->interactiveVisit(*_node.debugData, m_variables, [&]() {
+		m_inspector->interactiveVisit(*_node.debugData, m_frames.variablesInScope(), [&]() {
 			Interpreter::operator()(_node);
 		});
 	}
@@ -159,19 +158,19 @@ public:
 		std::shared_ptr<Inspector> _inspector,
 		InterpreterState& _state,
 		Dialect const& _dialect,
-		Scope& _scope,
-		std::map<YulName, u256> const& _variables,
+		FrameLayout const& _layout,
+		Interpreter& _interpreter,
 		bool _disableExternalCalls,
 		bool _disableMemoryTrace
 	):
-		ExpressionEvaluator(_state, _dialect, _scope, _variables, _disableExternalCalls, _disableMemoryTrace),
+		ExpressionEvaluator(_state, _dialect, _layout, _interpreter, _disableExternalCalls, _disableMemoryTrace),
 		m_inspector(_inspector)
 	{}
 
 	template <typename ConcreteNode>
 	void helper(ConcreteNode const& _node)
 	{
-		m_inspector->interactiveVisit(*_node.debugData, m_variables, [&]() {
+		m_inspector->interactiveVisit(*_node.debugData, m_interpreter.frames().variablesInScope(), [&]() {
 			ExpressionEvaluator::operator()(_node);
 		});
 	}
@@ -180,19 +179,7 @@ public:
 	void operator()(Identifier const& _node) override { helper(_node); }
 	void operator()(FunctionCall const& _node) override { helper(_node); }
 protected:
-	std::unique_ptr<Interpreter> makeInterpreterCopy(std::map<YulName, u256> _variables = {}) const override
-	{
-		return std::make_unique<InspectedInterpreter>(
-			m_inspector,
-			m_state,
-			m_dialect,
-			m_scope,
-			m_disableExternalCalls,
-			m_disableMemoryTrace,
-			std::move(_variables)
-		);
-	}
-	std::unique_ptr<Interpreter> makeInterpreterNew(InterpreterState& _state, Scope& _scope) const override
+	std::unique_ptr<Interpreter> makeInterpreterNew(InterpreterState& _state) const override
 	{
 		return std::make_unique<InspectedInterpreter>(
 			std::make_unique<Inspector>(
@@ -201,7 +188,7 @@ protected:
 			),
 			_state,
 			m_dialect,
-			_scope,
+			m_layout,
 			m_disableExternalCalls,
 			m_disableMemoryTrace
 		);
@@ -43,6 +43,190 @@ using namespace solidity::yul::test;
 
 using solidity::util::h256;
 
+class FrameLayout::Builder: public ASTWalker
+{
+public:
+	explicit Builder(FrameLayout& _layout): m_layout(_layout) {}
+
+	using ASTWalker::operator();
+
+	void operator()(Literal const& _literal) override { number(_literal); }
+
+	void operator()(Identifier const& _identifier) override
+	{
+		size_t id = enterNode();
+		auto variable = std::find(m_variables.rbegin(), m_variables.rend(), _identifier.name);
+		yulAssert(variable != m_variables.rend(), "Variable not found.");
+		m_layout.m_slots[id] = static_cast<size_t>(m_variables.rend() - variable) - 1;
+		leaveNode(id);
+	}
+
+	void operator()(FunctionCall const& _functionCall) override
+	{
+		size_t id = enterNode();
+		ASTWalker::operator()(_functionCall);
+		for (auto const& functions: m_functions | ranges::views::reverse)
+			if (FunctionDefinition const* function = util::valueOrDefault(functions, _functionCall.functionName.name))
+			{
+				m_calls.emplace_back(id, function);
+				break;
+			}
+		leaveNode(id);
+	}
+
+	void operator()(ExpressionStatement const& _statement) override { number(_statement); }
+	void operator()(Assignment const& _assignment) override { number(_assignment); }
+
+	void operator()(VariableDeclaration const& _declaration) override
+	{
+		size_t id = enterNode();
+		ASTWalker::operator()(_declaration);
+		m_layout.m_slots[id] = m_variables.size();
+		for (auto const& variable: _declaration.variables)
+			declare(variable.name);
+		leaveNode(id);
+	}
+
+	void operator()(If const& _if) override { number(_if); }
+	void operator()(Switch const& _switch) override { number(_switch); }
+
+	void operator()(FunctionDefinition const& _function) override
+	{
+		size_t id = enterNode();
+		m_functionIDs[&_function] = id;
+		m_layout.m_functionDefinitions[id] = &_function;
+		// Functions cannot access variables of enclosing scopes and get a frame of their own.
+		std::vector<YulName> outerVariables = std::move(m_variables);
+		size_t outerFrameSize = std::exchange(m_frameSize, 0);
+		m_variables.clear();
+		for (auto const& parameter: _function.parameters)
+			declare(parameter.name);
+		for (auto const& returnVariable: _function.returnVariables)
+			declare(returnVariable.name);
+		(*this)(_function.body);
+		m_layout.m_frameSizes[id] = m_frameSize;
+		m_variables = std::move(outerVariables);
+		m_frameSize = outerFrameSize;
+		leaveNode(id);
+	}
+
+	void operator()(ForLoop const& _forLoop) override
+	{
+		size_t id = enterNode();
+		// The scope of the pre block extends over the whole loop.
+		size_t numOuterVariables = enterBlock(_forLoop.pre);
+		size_t preID = enterNode();
+		walkVector(_forLoop.pre.statements);
+		leaveNode(preID);
+		visit(*_forLoop.condition);
+		(*this)(_forLoop.body);
+		(*this)(_forLoop.post);
+		leaveBlock(numOuterVariables);
+		leaveNode(id);
+	}
+
+	void operator()(Break const& _break) override { number(_break); }
+	void operator()(Continue const& _continue) override { number(_continue); }
+	void operator()(Leave const& _leave) override { number(_leave); }
+
+	void operator()(Block const& _block) override
+	{
+		size_t id = enterNode();
+		size_t numOuterVariables = enterBlock(_block);
+		walkVector(_block.statements);
+		leaveBlock(numOuterVariables);
+		leaveNode(id);
+	}
+
+	/// Resolves the calls to the IDs of the called functions, which are only known once all nodes are numbered.
+	void resolveCalls()
+	{
+		for (auto const& [callID, function]: m_calls)
+			m_layout.m_calledFunctions[callID] = m_functionIDs.at(function);
+	}
+
+	size_t frameSize() const { return m_frameSize; }
+
+private:
+	/// Numbers a node without any information besides its children.
+	template <typename Node>
+	void number(Node const& _node)
+	{
+		size_t id = enterNode();
+		ASTWalker::operator()(_node);
+		leaveNode(id);
+	}
+
+	/// @returns the ID of a new node, whose children are numbered next.
+	size_t enterNode()
+	{
+		size_t id = m_layout.m_subtreeEnds.size();
+		m_layout.m_subtreeEnds.emplace_back();
+		m_layout.m_slots.emplace_back();
+		m_layout.m_calledFunctions.emplace_back();
+		m_layout.m_functionDefinitions.emplace_back();
+		m_layout.m_frameSizes.emplace_back();
+		return id;
+	}
+
+	void leaveNode(size_t _id)
+	{
+		m_layout.m_subtreeEnds[_id] = m_layout.m_subtreeEnds.size();
+	}
+
+	/// Registers the functions of @a _block, which are visible in the whole block.
+	/// @returns the number of variables in scope before the block.
+	size_t enterBlock(Block const& _block)
+	{
+		std::map<YulName, FunctionDefinition const*>& functions = m_functions.emplace_back();
+		for (auto const& statement: _block.statements)
+			if (auto const* function = std::get_if<FunctionDefinition>(&statement))
+				functions[function->name] = function;
+		return m_variables.size();
+	}
+
+	void leaveBlock(size_t _numOuterVariables)
+	{
+		m_variables.resize(_numOuterVariables);
+		m_functions.pop_back();
+	}
+
+	void declare(YulName _name)
+	{
+		m_variables.emplace_back(_name);
+		m_frameSize = std::max(m_frameSize, m_variables.size());
+	}
+
+	FrameLayout& m_layout;
+	/// Names of the variables in scope, indexed by their slot.
+	std::vector<YulName> m_variables;
+	/// Number of slots needed by the current frame so far.
+	size_t m_frameSize = 0;
+	/// Functions visible in each of the enclosing blocks.
+	std::vector<std::map<YulName, FunctionDefinition const*>> m_functions;
+	/// IDs of the function definitions.
+	std::map<FunctionDefinition const*, size_t> m_functionIDs;
+	/// IDs of the calls of user-defined functions together with the called functions.
+	std::vector<std::pair<size_t, FunctionDefinition const*>> m_calls;
+};
+
+FrameLayout::FrameLayout(Block const& _root):
+	m_root(_root)
+{
+	Builder builder(*this);
+	builder(_root);
+	builder.resolveCalls();
+	m_rootFrameSize = builder.frameSize();
+}
+
+std::map<YulName, u256> Frames::variablesInScope() const
+{
+	std::map<YulName, u256> variables;
+	for (size_t slot = base; slot < base + numInScope; ++slot)
+		variables[names[slot]] = values[slot];
+	return variables;
+}
+
 void InterpreterState::dumpStorage(std::ostream& _out) const
 {
 	for (auto const& [slot, value]: storage)
@@ -65,12 +249,13 @@ void InterpreterState::dumpTraceAndState(std::ostream& _out, bool _disableMemory
 	if (!_disableMemoryTrace)
 	{
 		_out << "Memory dump:\n";
-		std::map<u256, u256> words;
-		for (auto const& [offset, value]: memory)
-			words[(offset / 0x20) * 0x20] |= u256(uint32_t(value)) << (256 - 8 - 8 * static_cast<size_t>(offset % 0x20));
-		for (auto const& [offset, value]: words)
-			if (value != 0)
-				_out << "  " << std::uppercase << std::hex << std::setw(4) << offset << ": " << h256(value).hex() << std::endl;
+		for (auto const& [pageOffset, page]: memory.pages())
+			for (size_t position = 0; position < page.size(); position += 0x20)
+			{
+				h256 word(bytesConstRef(page.data() + position, 0x20));
+				if (word != h256{})
+					_out << "  " << std::uppercase << std::hex << std::setw(4) << u256(pageOffset + position) << ": " << word.hex() << std::endl;
+			}
 	}
 	_out << "Storage dump:" << std::endl;
 	dumpStorage(_out);
@@ -115,63 +300,86 @@ void Interpreter::run(
 	bool _disableMemoryTrace
 )
 {
-	Scope scope;
-	Interpreter{_state, _dialect, scope, _disableExternalCalls, _disableMemoryTrace}(_ast);
+	FrameLayout layout(_ast);
+	Interpreter{_state, _dialect, layout, _disableExternalCalls, _disableMemoryTrace}(_ast);
+}
+
+void Interpreter::visit(Statement const& _statement, size_t _id)
+{
+	m_nodeID = _id;
+	visit(_statement);
+}
+
+void Interpreter::visit(Block const& _block, size_t _id)
+{
+	m_nodeID = _id;
+	(*this)(_block);
 }
 
 void Interpreter::operator()(ExpressionStatement const& _expressionStatement)
 {
-	evaluateMulti(_expressionStatement.expression);
+	evaluateMulti(_expressionStatement.expression, FrameLayout::firstChild(m_nodeID));
 }
 
 void Interpreter::operator()(Assignment const& _assignment)
 {
 	solAssert(_assignment.value, "");
-	std::vector<u256> values = evaluateMulti(*_assignment.value);
+	size_t const firstVariableID = FrameLayout::firstChild(m_nodeID);
+	size_t valueID = firstVariableID;
+	for (size_t i = 0; i < _assignment.variableNames.size(); ++i)
+		valueID = m_layout.nextSibling(valueID);
+	std::vector<u256> values = evaluateMulti(*_assignment.value, valueID);
 	solAssert(values.size() == _assignment.variableNames.size(), "");
+	size_t variableID = firstVariableID;
 	for (size_t i = 0; i < values.size(); ++i)
 	{
-		YulName varName = _assignment.variableNames.at(i).name;
-		solAssert(m_variables.count(varName), "");
-		m_variables[varName] = values.at(i);
+		m_frames.value(m_layout.slot(variableID)) = values.at(i);
+		variableID = m_layout.nextSibling(variableID);
 	}
 }
 
 void Interpreter::operator()(VariableDeclaration const& _declaration)
 {
+	size_t const slot = m_layout.slot(m_nodeID);
 	std::vector<u256> values(_declaration.variables.size(), 0);
 	if (_declaration.value)
-		values = evaluateMulti(*_declaration.value);
+		values = evaluateMulti(*_declaration.value, FrameLayout::firstChild(m_nodeID));
 
 	solAssert(values.size() == _declaration.variables.size(), "");
 	for (size_t i = 0; i < values.size(); ++i)
 	{
-		YulName varName = _declaration.variables.at(i).name;
-		solAssert(!m_variables.count(varName), "");
-		m_variables[varName] = values.at(i);
-		m_scope->names.emplace(varName, nullptr);
+		m_frames.value(slot + i) = values.at(i);
+		m_frames.names[m_frames.base + slot + i] = _declaration.variables.at(i).name;
 	}
+	m_frames.numInScope = slot + values.size();
 }
 
 void Interpreter::operator()(If const& _if)
 {
 	solAssert(_if.condition, "");
-	if (evaluate(*_if.condition) != 0)
-		(*this)(_if.body);
+	size_t const conditionID = FrameLayout::firstChild(m_nodeID);
+	if (evaluate(*_if.condition, conditionID) != 0)
+		visit(_if.body, m_layout.nextSibling(conditionID));
 }
 
 void Interpreter::operator()(Switch const& _switch)
 {
 	solAssert(_switch.expression, "");
-	u256 val = evaluate(*_switch.expression);
+	size_t const expressionID = FrameLayout::firstChild(m_nodeID);
+	u256 val = evaluate(*_switch.expression, expressionID);
 	solAssert(!_switch.cases.empty(), "");
+	size_t caseID = m_layout.nextSibling(expressionID);
 	for (auto const& c: _switch.cases)
+	{
+		size_t const bodyID = c.value ? m_layout.nextSibling(caseID) : caseID;
 		// Default case has to be last.
-		if (!c.value || evaluate(*c.value) == val)
+		if (!c.value || evaluate(*c.value, caseID) == val)
 		{
-			(*this)(c.body);
+			visit(c.body, bodyID);
 			break;
 		}
+		caseID = m_layout.nextSibling(bodyID);
+	}
 }
 
 void Interpreter::operator()(FunctionDefinition const&)
@@ -182,16 +390,23 @@ void Interpreter::operator()(ForLoop const& _forLoop)
 {
 	solAssert(_forLoop.condition, "");
 
-	enterScope(_forLoop.pre);
-	ScopeGuard g([this]{ leaveScope(); });
+	size_t const preID = FrameLayout::firstChild(m_nodeID);
+	size_t const conditionID = m_layout.nextSibling(preID);
+	size_t const bodyID = m_layout.nextSibling(conditionID);
+	size_t const postID = m_layout.nextSibling(bodyID);
+
+	size_t numOuterVariables = m_frames.numInScope;
+	ScopeGuard g([&]{ m_frames.numInScope = numOuterVariables; });
 
+	size_t statementID = FrameLayout::firstChild(preID);
 	for (auto const& statement: _forLoop.pre.statements)
 	{
-		visit(statement);
+		visit(statement, statementID);
 		if (m_state.controlFlowState == ControlFlowState::Leave)
 			return;
+		statementID = m_layout.nextSibling(statementID);
 	}
-	while (evaluate(*_forLoop.condition) != 0)
+	while (evaluate(*_forLoop.condition, conditionID) != 0)
 	{
 		// Increment step for each loop iteration for loops with
 		// an empty body and post blocks to prevent a deadlock.
@@ -199,12 +414,12 @@ void Interpreter::operator()(ForLoop const& _forLoop)
 			incrementStep();
 
 		m_state.controlFlowState = ControlFlowState::Default;
-		(*this)(_forLoop.body);
+		visit(_forLoop.body, bodyID);
 		if (m_state.controlFlowState == ControlFlowState::Break || m_state.controlFlowState == ControlFlowState::Leave)
 			break;
 
 		m_state.controlFlowState = ControlFlowState::Default;
-		(*this)(_forLoop.post);
+		visit(_forLoop.post, postID);
 		if (m_state.controlFlowState == ControlFlowState::Leave)
 			break;
 	}
@@ -229,58 +444,70 @@ void Interpreter::operator()(Leave const&)
 
 void Interpreter::operator()(Block const& _block)
 {
-	enterScope(_block);
-	// Register functions.
-	for (auto const& statement: _block.statements)
-		if (std::holds_alternative<FunctionDefinition>(statement))
-		{
-			FunctionDefinition const& funDef = std::get<FunctionDefinition>(statement);
-			m_scope->names.emplace(funDef.name, &funDef);
-		}
+	size_t numOuterVariables = m_frames.numInScope;
 
+	size_t statementID = FrameLayout::firstChild(m_nodeID);
 	for (auto const& statement: _block.statements)
 	{
 		incrementStep();
-		visit(statement);
+		visit(statement, statementID);
 		if (m_state.controlFlowState != ControlFlowState::Default)
 			break;
+		statementID = m_layout.nextSibling(statementID);
 	}
 
-	leaveScope();
+	m_frames.numInScope = numOuterVariables;
 }
 
-u256 Interpreter::evaluate(Expression const& _expression)
+void Interpreter::callFunction(size_t _functionID, std::vector<u256>& _values)
 {
-	ExpressionEvaluator ev(m_state, m_dialect, *m_scope, m_variables, m_disableExternalCalls, m_disableMemoryTrace);
-	ev.visit(_expression);
-	return ev.value();
-}
+	FunctionDefinition const& fun = m_layout.functionDefinition(_functionID);
+	yulAssert(_values.size() == fun.parameters.size(), "");
+
+	size_t const outerBase = m_frames.base;
+	size_t const outerNumInScope = m_frames.numInScope;
+	// The new frame starts at the end of the frame of the caller, which is the innermost frame so far.
+	// Resizing zero-initialises the return and local variables.
+	size_t const base = m_frames.values.size();
+	m_frames.values.resize(base + m_layout.frameSize(_functionID), 0);
+	m_frames.names.resize(m_frames.values.size());
+	m_frames.base = base;
+
+	// Parameters occupy the first slots of the frame, followed by the return variables.
+	for (size_t i = 0; i < fun.parameters.size(); ++i)
+	{
+		m_frames.value(i) = _values[i];
+		m_frames.names[base + i] = fun.parameters[i].name;
+	}
+	for (size_t i = 0; i < fun.returnVariables.size(); ++i)
+		m_frames.names[base + fun.parameters.size() + i] = fun.returnVariables[i].name;
+	m_frames.numInScope = fun.parameters.size() + fun.returnVariables.size();
 
-std::vector<u256> Interpreter::evaluateMulti(Expression const& _expression)
-{
-	ExpressionEvaluator ev(m_state, m_dialect, *m_scope, m_variables, m_disableExternalCalls, m_disableMemoryTrace);
-	ev.visit(_expression);
-	return ev.values();
+	m_state.controlFlowState = ControlFlowState::Default;
+	visit(fun.body, FrameLayout::firstChild(_functionID));
+	m_state.controlFlowState = ControlFlowState::Default;
+
+	auto const returnValues = m_frames.values.begin() + static_cast<ptrdiff_t>(base + fun.parameters.size());
+	_values.assign(returnValues, returnValues + static_cast<ptrdiff_t>(fun.returnVariables.size()));
+
+	m_frames.values.resize(base);
+	m_frames.names.resize(base);
+	m_frames.base = outerBase;
+	m_frames.numInScope = outerNumInScope;
 }
 
-void Interpreter::enterScope(Block const& _block)
+u256 Interpreter::evaluate(Expression const& _expression, size_t _id)
 {
-	if (!m_scope->subScopes.count(&_block))
-		m_scope->subScopes[&_block] = std::make_unique<Scope>(Scope{
-			{},
-			{},
-			m_scope
-		});
-	m_scope = m_scope->subScopes[&_block].get();
+	ExpressionEvaluator ev(m_state, m_dialect, m_layout, *this, m_disableExternalCalls, m_disableMemoryTrace);
+	ev.visit(_expression, _id);
+	return ev.value();
 }
 
-void Interpreter::leaveScope()
+std::vector<u256> Interpreter::evaluateMulti(Expression const& _expression, size_t _id)
 {
-	for (auto const& [var, funDeclaration]: m_scope->names)
-		if (!funDeclaration)
-			m_variables.erase(var);
-	m_scope = m_scope->parent;
-	yulAssert(m_scope, "");
+	ExpressionEvaluator ev(m_state, m_dialect, m_layout, *this, m_disableExternalCalls, m_disableMemoryTrace);
+	ev.visit(_expression, _id);
+	return ev.values();
 }
 
 void Interpreter::incrementStep()
@@ -293,26 +520,32 @@ void Interpreter::incrementStep()
 	}
 }
 
+void ExpressionEvaluator::visit(Expression const& _expression, size_t _id)
+{
+	m_nodeID = _id;
+	visit(_expression);
+}
+
 void ExpressionEvaluator::operator()(Literal const& _literal)
 {
 	incrementStep();
 	setValue(_literal.value.value());
 }
 
-void ExpressionEvaluator::operator()(Identifier const& _identifier)
+void ExpressionEvaluator::operator()(Identifier const&)
 {
-	solAssert(m_variables.count(_identifier.name), "");
 	incrementStep();
-	setValue(m_variables.at(_identifier.name));
+	setValue(m_interpreter.frames().value(m_layout.slot(m_nodeID)));
 }
 
 void ExpressionEvaluator::operator()(FunctionCall const& _funCall)
 {
+	size_t const id = m_nodeID;
 	std::vector<std::optional<LiteralKind>> const* literalArguments = nullptr;
 	if (BuiltinFunction const* builtin = m_dialect.builtin(_funCall.functionName.name))
 		if (!builtin->literalArguments.empty())
 			literalArguments = &builtin->literalArguments;
-	evaluateArgs(_funCall.arguments, literalArguments);
+	evaluateArgs(_funCall.arguments, literalArguments, FrameLayout::firstChild(id));
 
 	if (EVMDialect const* dialect = dynamic_cast<EVMDialect const*>(&m_dialect))
 	{
@@ -334,29 +567,7 @@ void ExpressionEvaluator::operator()(FunctionCall const& _funCall)
 		}
 	}
 
-	Scope* scope = &m_scope;
-	for (; scope; scope = scope->parent)
-		if (scope->names.count(_funCall.functionName.name))
-			break;
-	yulAssert(scope, "");
-
-	FunctionDefinition const* fun = scope->names.at(_funCall.functionName.name);
-	yulAssert(fun, "Function not found.");
-	yulAssert(m_values.size() == fun->parameters.size(), "");
-	std::map<YulName, u256> variables;
-	for (size_t i = 0; i < fun->parameters.size(); ++i)
-		variables[fun->parameters.at(i).name] = m_values.at(i);
-	for (size_t i = 0; i < fun->returnVariables.size(); ++i)
-		variables[fun->returnVariables.at(i).name] = 0;
-
-	m_state.controlFlowState = ControlFlowState::Default;
-	std::unique_ptr<Interpreter> interpreter = makeInterpreterCopy(std::move(variables));
-	(*interpreter)(fun->body);
-	m_state.controlFlowState = ControlFlowState::Default;
-
-	m_values.clear();
-	for (auto const& retVar: fun->returnVariables)
-		m_values.emplace_back(interpreter->valueOfVariable(retVar.name));
+	m_interpreter.callFunction(m_layout.calledFunction(id), m_values);
 }
 
 u256 ExpressionEvaluator::value() const
@@ -373,17 +584,19 @@ void ExpressionEvaluator::setValue(u256 _value)
 
 void ExpressionEvaluator::evaluateArgs(
 	std::vector<Expression> const& _expr,
-	std::vector<std::optional<LiteralKind>> const* _literalArguments
+	std::vector<std::optional<LiteralKind>> const* _literalArguments,
+	size_t _firstID
 )
 {
 	incrementStep();
 	std::vector<u256> values;
 	size_t i = 0;
+	size_t id = _firstID;
 	/// Function arguments are evaluated in reverse.
 	for (auto const& expr: _expr | ranges::views::reverse)
 	{
 		if (!_literalArguments || !_literalArguments->at(_expr.size() - i - 1))
-			visit(expr);
+			visit(expr, id);
 		else
 		{
 			if (std::get<Literal>(expr).value.unlimited())
@@ -397,6 +610,7 @@ void ExpressionEvaluator::evaluateArgs(
 
 		values.push_back(value());
 		++i;
+		id = m_layout.nextSibling(id);
 	}
 	m_values = std::move(values);
 	std::reverse(m_values.begin(), m_values.end());
@@ -449,7 +663,6 @@ void ExpressionEvaluator::runExternalCall(evmasm::Instruction _instruction)
 	if (values()[1] != util::h160::Arith(m_state.address))
 		return;
 
-	Scope tmpScope;
 	InterpreterState tmpState;
 	tmpState.calldata = m_state.readMemory(memInOffset, memInSize);
 	tmpState.callvalue = callvalue;
@@ -458,32 +671,11 @@ void ExpressionEvaluator::runExternalCall(evmasm::Instruction _instruction)
 	yulAssert(tmpState.numInstance < 1024, "Detected more than 1024 recursive calls, aborting...");
 
 	// Create new interpreter for the called contract
-	std::unique_ptr<Interpreter> newInterpreter = makeInterpreterNew(tmpState, tmpScope);
-
-	Scope* abstractRootScope = &m_scope;
-	Scope* fileScope = nullptr;
-	Block const* ast = nullptr;
-
-	// Find file scope
-	while (abstractRootScope->parent)
-	{
-		fileScope = abstractRootScope;
-		abstractRootScope = abstractRootScope->parent;
-	}
-
-	// Get AST for file scope
-	for (auto&& [block, scope]: abstractRootScope->subScopes)
-		if (scope.get() == fileScope)
-		{
-			ast = block;
-			break;
-		}
-
-	yulAssert(ast);
+	std::unique_ptr<Interpreter> newInterpreter = makeInterpreterNew(tmpState);
 
 	try
 	{
-		(*newInterpreter)(*ast);
+		(*newInterpreter)(m_layout.root());
 	}
 	catch (ExplicitlyTerminatedWithReturn const&)
 	{
@@ -21,6 +21,8 @@
 
 #pragma once
 
+#include <test/tools/yulInterpreter/Memory.h>
+
 #include <libyul/ASTForward.h>
 #include <libyul/optimiser/ASTWalker.h>
 
@@ -32,6 +34,7 @@
 #include <libsolutil/Exceptions.h>
 
 #include <map>
+#include <vector>
 
 namespace solidity::yul
 {
@@ -77,8 +80,8 @@ struct InterpreterState
 {
 	bytes calldata;
 	bytes returndata;
-	std::map<u256, uint8_t> memory;
-	/// This is different than memory.size() because we ignore gas.
+	Memory memory;
+	/// This is different than the size of the allocated memory because we ignore gas.
 	u256 msize;
 	std::map<util::h256, util::h256> storage;
 	std::map<util::h256, util::h256> transientStorage;
@@ -129,25 +132,89 @@ struct InterpreterState
 	/// Prints non-zero transient storage to @param _out.
 	void dumpTransientStorage(std::ostream& _out) const;
 
-	bytes readMemory(u256 const& _offset, u256 const& _size)
+	bytes readMemory(u256 const& _offset, u256 const& _size) const
 	{
 		yulAssert(_size <= 0xffff, "Too large read.");
-		bytes data(size_t(_size), uint8_t(0));
-		for (size_t i = 0; i < data.size(); ++i)
-			data[i] = memory[_offset + i];
-		return data;
+		return memory.read(_offset, size_t(_size));
 	}
 };
 
 /**
- * Scope structure built and maintained during execution.
+ * Numbering of the AST nodes and assignment of variables to frame slots, computed once before
+ * execution so that the interpreter does not have to look up names or nodes at runtime.
+ *
+ * The nodes are numbered in the order in which the ASTWalker visits them, starting with 0 for
+ * the outermost block. All information about the nodes is stored in vectors indexed by their IDs.
+ * The children of a node follow it directly, so the interpreter derives the IDs of the children
+ * from the ID of the node it executes.
+ *
+ * Every function and the outermost block get a frame. The parameters of a function occupy
+ * its first slots, followed by its return variables. Variables declared in a block get the
+ * next free slots, which are released again at the end of the block. Thus, the variables
+ * that are in scope always occupy a prefix of the frame.
+ *
+ * Calls of user-defined functions are resolved to their definitions.
  */
-struct Scope
+class FrameLayout
 {
-	/// Used for variables and functions. Value is nullptr for variables.
-	std::map<YulName, FunctionDefinition const*> names;
-	std::map<Block const*, std::unique_ptr<Scope>> subScopes;
-	Scope* parent = nullptr;
+public:
+	explicit FrameLayout(Block const& _root);
+
+	Block const& root() const { return m_root; }
+	/// @returns the number of slots needed by the variables of the outermost block.
+	size_t rootFrameSize() const { return m_rootFrameSize; }
+
+	/// @returns the ID of the first child of the node with ID @a _id.
+	static size_t firstChild(size_t _id) { return _id + 1; }
+	/// @returns the ID of the next sibling of the node with ID @a _id, i.e. of the first node after its descendants.
+	size_t nextSibling(size_t _id) const { return m_subtreeEnds[_id]; }
+
+	/// @returns the slot of the variable referenced by the identifier with ID @a _id, or the slot of the
+	/// first variable declared by the variable declaration with ID @a _id. The other variables follow
+	/// in consecutive slots.
+	size_t slot(size_t _id) const { return m_slots[_id]; }
+	/// @returns the ID of the definition of the user-defined function called by the function call with ID @a _id.
+	size_t calledFunction(size_t _id) const { return m_calledFunctions[_id]; }
+	/// @returns the function definition with ID @a _id.
+	FunctionDefinition const& functionDefinition(size_t _id) const { return *m_functionDefinitions[_id]; }
+	/// @returns the number of slots needed by the parameters, return variables and local variables
+	/// of the function definition with ID @a _id.
+	size_t frameSize(size_t _id) const { return m_frameSizes[_id]; }
+
+private:
+	class Builder;
+
+	Block const& m_root;
+	size_t m_rootFrameSize = 0;
+	std::vector<size_t> m_subtreeEnds;
+	std::vector<size_t> m_slots;
+	std::vector<size_t> m_calledFunctions;
+	std::vector<FunctionDefinition const*> m_functionDefinitions;
+	std::vector<size_t> m_frameSizes;
+};
+
+/**
+ * Variables of the outermost block and of the active function calls. The frame of each call
+ * follows the frame of its caller in the same storage, which keeps its capacity when calls return.
+ * The slots assigned by the FrameLayout are relative to the start of the innermost frame.
+ */
+struct Frames
+{
+	explicit Frames(size_t _rootFrameSize): values(_rootFrameSize, 0), names(_rootFrameSize) {}
+
+	/// @returns the names and values of the variables of the innermost frame that are currently in scope.
+	std::map<YulName, u256> variablesInScope() const;
+
+	u256& value(size_t _slot) { return values[base + _slot]; }
+	u256 const& value(size_t _slot) const { return values[base + _slot]; }
+
+	std::vector<u256> values;
+	/// Names of the variables, only used for inspection.
+	std::vector<YulName> names;
+	/// Index of the first slot of the innermost frame.
+	size_t base = 0;
+	/// Number of leading slots of the innermost frame that belong to variables currently in scope.
+	size_t numInScope = 0;
 };
 
 /**
@@ -171,20 +238,25 @@ public:
 	Interpreter(
 		InterpreterState& _state,
 		Dialect const& _dialect,
-		Scope& _scope,
+		FrameLayout const& _layout,
 		bool _disableExternalCalls,
-		bool _disableMemoryTracing,
-		std::map<YulName, u256> _variables = {}
+		bool _disableMemoryTracing
 	):
 		m_dialect(_dialect),
 		m_state(_state),
-		m_variables(std::move(_variables)),
-		m_scope(&_scope),
+		m_layout(_layout),
+		m_frames(_layout.rootFrameSize()),
 		m_disableExternalCalls(_disableExternalCalls),
 		m_disableMemoryTrace(_disableMemoryTracing)
 	{
 	}
 
+	using ASTWalker::visit;
+	/// Visits @a _statement, which has the ID @a _id in the FrameLayout.
+	void visit(Statement const& _statement, size_t _id);
+	/// Visits @a _block, which has the ID @a _id in the FrameLayout.
+	void visit(Block const& _block, size_t _id);
+
 	void operator()(ExpressionStatement const& _statement) override;
 	void operator()(Assignment const& _assignment) override;
 	void operator()(VariableDeclaration const& _varDecl) override;
@@ -200,16 +272,17 @@ public:
 	bytes returnData() const { return m_state.returndata; }
 	std::vector<std::string> const& trace() const { return m_state.trace; }
 
-	u256 valueOfVariable(YulName _name) const { return m_variables.at(_name); }
+	Frames const& frames() const { return m_frames; }
 
-protected:
-	/// Asserts that the expression evaluates to exactly one value and returns it.
-	virtual u256 evaluate(Expression const& _expression);
-	/// Evaluates the expression and returns its value.
-	virtual std::vector<u256> evaluateMulti(Expression const& _expression);
+	/// Executes the user-defined function with ID @a _functionID in the FrameLayout in a new frame.
+	/// @a _values are the arguments and are replaced by the return values.
+	void callFunction(size_t _functionID, std::vector<u256>& _values);
 
-	void enterScope(Block const& _block);
-	void leaveScope();
+protected:
+	/// Asserts that the expression with ID @a _id evaluates to exactly one value and returns it.
+	virtual u256 evaluate(Expression const& _expression, size_t _id);
+	/// Evaluates the expression with ID @a _id and returns its value.
+	virtual std::vector<u256> evaluateMulti(Expression const& _expression, size_t _id);
 
 	/// Increment interpreter step count, throwing exception if step limit
 	/// is reached.
@@ -217,9 +290,11 @@ protected:
 
 	Dialect const& m_dialect;
 	InterpreterState& m_state;
+	FrameLayout const& m_layout;
 	/// Values of variables.
-	std::map<YulName, u256> m_variables;
-	Scope* m_scope;
+	Frames m_frames;
+	/// ID of the node visited next. Set before visiting a node and read first thing by the visit.
+	size_t m_nodeID = 0;
 	/// If not set, external calls (e.g. using `call()`) to the same contract
 	/// are evaluated in a new parser instance.
 	bool m_disableExternalCalls;
@@ -235,19 +310,23 @@ public:
 	ExpressionEvaluator(
 		InterpreterState& _state,
 		Dialect const& _dialect,
-		Scope& _scope,
-		std::map<YulName, u256> const& _variables,
+		FrameLayout const& _layout,
+		Interpreter& _interpreter,
 		bool _disableExternalCalls,
 		bool _disableMemoryTrace
 	):
 		m_state(_state),
 		m_dialect(_dialect),
-		m_variables(_variables),
-		m_scope(_scope),
+		m_layout(_layout),
+		m_interpreter(_interpreter),
 		m_disableExternalCalls(_disableExternalCalls),
 		m_disableMemoryTrace(_disableMemoryTrace)
 	{}
 
+	using ASTWalker::visit;
+	/// Visits @a _expression, which has the ID @a _id in the FrameLayout.
+	void visit(Expression const& _expression, size_t _id);
+
 	void operator()(Literal const&) override;
 	void operator()(Identifier const&) override;
 	void operator()(FunctionCall const& _funCall) override;
@@ -259,23 +338,12 @@ public:
 
 protected:
 	void runExternalCall(evmasm::Instruction _instruction);
-	virtual std::unique_ptr<Interpreter> makeInterpreterCopy(std::map<YulName, u256> _variables = {}) const
-	{
-		return std::make_unique<Interpreter>(
-			m_state,
-			m_dialect,
-			m_scope,
-			m_disableExternalCalls,
-			m_disableMemoryTrace,
-			std::move(_variables)
-		);
-	}
-	virtual std::unique_ptr<Interpreter> makeInterpreterNew(InterpreterState& _state, Scope& _scope) const
+	virtual std::unique_ptr<Interpreter> makeInterpreterNew(InterpreterState& _state) const
 	{
 		return std::make_unique<Interpreter>(
 			_state,
 			m_dialect,
-			_scope,
+			m_layout,
 			m_disableExternalCalls,
 			m_disableMemoryTrace
 		);
@@ -284,10 +352,12 @@ protected:
 	void setValue(u256 _value);
 
 	/// Evaluates the given expression from right to left and
-	/// stores it in m_value.
+	/// stores it in m_value. @a _firstID is the ID of the last expression,
+	/// which is visited first.
 	void evaluateArgs(
 		std::vector<Expression> const& _expr,
-		std::vector<std::optional<LiteralKind>> const* _literalArguments
+		std::vector<std::optional<LiteralKind>> const* _literalArguments,
+		size_t _firstID
 	);
 
 	/// Increment evaluation count, throwing exception if the
@@ -297,9 +367,11 @@ protected:
 
 	InterpreterState& m_state;
 	Dialect const& m_dialect;
-	/// Values of variables.
-	std::map<YulName, u256> const& m_variables;
-	Scope& m_scope;
+	FrameLayout const& m_layout;
+	/// Interpreter holding the values of the variables and executing the user-defined functions.
+	Interpreter& m_interpreter;
+	/// ID of the node visited next.
+	size_t m_nodeID = 0;
 	/// Current value of the expression
 	std::vector<u256> m_values;
 	/// Current expression nesting level
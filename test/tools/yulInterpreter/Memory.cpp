@@ -0,0 +1,67 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Sparse model of EVM memory used by the Yul interpreter.
+ */
+
+#include <test/tools/yulInterpreter/Memory.h>
+
+#include <algorithm>
+
+using namespace solidity;
+using namespace solidity::yul::test;
+
+void Memory::set(u256 const& _offset, uint8_t _value)
+{
+	write(_offset, bytesConstRef(&_value, 1));
+}
+
+bytes Memory::read(u256 const& _offset, size_t _size) const
+{
+	bytes data(_size, 0);
+	u256 offset = _offset;
+	for (size_t done = 0; done < _size;)
+	{
+		size_t position = positionInPage(offset);
+		size_t chunk = std::min(_size - done, pageSize - position);
+		auto page = m_pages.find(offset - position);
+		if (page != m_pages.end())
+			std::copy_n(page->second.begin() + static_cast<ptrdiff_t>(position), chunk, data.begin() + static_cast<ptrdiff_t>(done));
+		done += chunk;
+		offset += chunk;
+	}
+	return data;
+}
+
+void Memory::write(u256 const& _offset, bytesConstRef _data)
+{
+	u256 offset = _offset;
+	for (size_t done = 0; done < _data.size();)
+	{
+		size_t position = positionInPage(offset);
+		size_t chunk = std::min(_data.size() - done, pageSize - position);
+		bytesConstRef source = _data.cropped(done, chunk);
+		auto page = m_pages.find(offset - position);
+		if (page == m_pages.end() && std::any_of(source.begin(), source.end(), [](uint8_t _byte) { return _byte != 0; }))
+			page = m_pages.emplace(offset - position, bytes(pageSize, 0)).first;
+		if (page != m_pages.end())
+			std::copy(source.begin(), source.end(), page->second.begin() + static_cast<ptrdiff_t>(position));
+		done += chunk;
+		offset += chunk;
+	}
+}
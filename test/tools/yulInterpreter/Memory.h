@@ -0,0 +1,66 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Sparse model of EVM memory used by the Yul interpreter.
+ */
+
+#pragma once
+
+#include <libsolutil/CommonData.h>
+#include <libsolutil/Numeric.h>
+
+#include <map>
+
+namespace solidity::yul::test
+{
+
+/**
+ * Memory of the interpreted contract. The address space of 2**256 bytes is split into
+ * pages of fixed size that are only allocated once a non-zero byte is written to them.
+ * Contiguous ranges are read and written page by page, so bulk operations cost one
+ * lookup per page instead of one per byte.
+ *
+ * Offsets wrap around at 2**256, i.e. a range that starts close to the end of the
+ * address space continues at offset zero.
+ */
+class Memory
+{
+public:
+	static constexpr size_t pageSize = 0x1000;
+
+	/// Sets the byte at @a _offset to @a _value.
+	void set(u256 const& _offset, uint8_t _value);
+
+	/// @returns @a _size bytes of memory starting at @a _offset. Memory that has never
+	/// been written to reads as zero.
+	bytes read(u256 const& _offset, size_t _size) const;
+	/// Stores @a _data in memory starting at @a _offset.
+	void write(u256 const& _offset, bytesConstRef _data);
+
+	/// @returns all allocated pages, indexed by the offset of their first byte.
+	/// Every page is exactly pageSize bytes long.
+	std::map<u256, bytes> const& pages() const { return m_pages; }
+
+private:
+	/// @returns the position of @a _offset inside its page.
+	static size_t positionInPage(u256 const& _offset) { return static_cast<size_t>(_offset & (pageSize - 1)); }
+
+	std::map<u256, bytes> m_pages;
+};
+
+}
@@ -0,0 +1,230 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Benchmark for the Yul simplification rule matcher.
+ * Parses all Yul sources in the given files or directories (e.g. test/libyul/yulOptimizerTests)
+ * and measures the time spent in SimplificationRules::findFirstMatch for all their expressions.
+ */
+
+#include <libyul/optimiser/ASTWalker.h>
+#include <libyul/optimiser/DataFlowAnalyzer.h>
+#include <libyul/optimiser/Disambiguator.h>
+#include <libyul/optimiser/SimplificationRules.h>
+#include <libyul/optimiser/SSAValueTracker.h>
+
+#include <libyul/AST.h>
+#include <libyul/AsmAnalysisInfo.h>
+#include <libyul/YulStack.h>
+#include <libyul/backends/evm/EVMDialect.h>
+
+#include <liblangutil/DebugInfoSelection.h>
+#include <liblangutil/EVMVersion.h>
+
+#include <libsolutil/CommonIO.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::langutil;
+using namespace solidity::yul;
+
+namespace po = boost::program_options;
+namespace fs = boost::filesystem;
+
+namespace
+{
+
+/// Collects pointers to all expressions in a block, children before parents.
+class ExpressionCollector: public ASTWalker
+{
+public:
+	using ASTWalker::operator();
+	void visit(Expression const& _expression) override
+	{
+		ASTWalker::visit(_expression);
+		expressions.push_back(&_expression);
+	}
+
+	std::vector<Expression const*> expressions;
+};
+
+/// Parsed and disambiguated source together with the SSA values of its variables.
+struct BenchmarkSource
+{
+	std::unique_ptr<Block> code;
+	std::map<YulName, AssignedValue> ssaValues;
+	std::vector<Expression const*> expressions;
+};
+
+std::optional<BenchmarkSource> parse(std::string const& _source, Dialect const& _dialect)
+{
+	YulStack stack(
+		langutil::EVMVersion(),
+		std::nullopt,
+		YulStack::Language::StrictAssembly,
+		solidity::frontend::OptimiserSettings::none(),
+		DebugInfoSelection::Default()
+	);
+	if (!stack.parseAndAnalyze("--INPUT--", _source) || !stack.parserResult()->analysisInfo)
+		return std::nullopt;
+
+	BenchmarkSource result;
+	result.code = std::make_unique<Block>(std::get<Block>(
+		Disambiguator(_dialect, *stack.parserResult()->analysisInfo)(stack.parserResult()->code()->root())
+	));
+
+	SSAValueTracker ssaValues;
+	ssaValues(*result.code);
+	for (auto const& [name, expression]: ssaValues.values())
+		result.ssaValues[name] = AssignedValue{expression, 0};
+
+	ExpressionCollector collector;
+	collector(*result.code);
+	result.expressions = std::move(collector.expressions);
+	return result;
+}
+
+/// Reads a test file, stripping the expectations section that follows the source.
+std::string readSource(fs::path const& _path)
+{
+	std::string source = readFileAsString(_path);
+	if (size_t end = source.find("\n// ----"); end != std::string::npos)
+		source.resize(end + 1);
+	return source;
+}
+
+std::vector<fs::path> collectFiles(std::vector<std::string> const& _paths)
+{
+	std::vector<fs::path> files;
+	for (std::string const& path: _paths)
+		if (fs::is_directory(path))
+		{
+			for (fs::directory_entry const& entry: fs::recursive_directory_iterator(path))
+				if (fs::is_regular_file(entry.path()) && entry.path().extension() == ".yul")
+					files.push_back(entry.path());
+		}
+		else
+			files.emplace_back(path);
+	std::sort(files.begin(), files.end());
+	return files;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	po::options_description options(
+		R"(yulSimplificationBenchmark, benchmark of the Yul simplification rule matcher.
+Usage: yulSimplificationBenchmark [Options] <files or directories>...
+Parses all given Yul sources (directories are searched recursively for *.yul files)
+and reports the time spent matching all their expressions against the simplification rules.
+
+Allowed options)",
+		po::options_description::m_default_line_length,
+		po::options_description::m_default_line_length - 23);
+	options.add_options()
+		("help", "Show this help screen.")
+		("repetitions", po::value<size_t>()->default_value(100), "Number of times each expression is matched.")
+		("input-file", po::value<std::vector<std::string>>(), "input file or directory");
+	po::positional_options_description filesPositions;
+	filesPositions.add("input-file", -1);
+
+	po::variables_map arguments;
+	try
+	{
+		po::command_line_parser cmdLineParser(argc, argv);
+		cmdLineParser.options(options).positional(filesPositions);
+		po::store(cmdLineParser.run(), arguments);
+	}
+	catch (po::error const& _exception)
+	{
+		std::cerr << _exception.what() << std::endl;
+		return 1;
+	}
+
+	if (arguments.count("help") || !arguments.count("input-file"))
+	{
+		std::cout << options;
+		return 0;
+	}
+
+	Dialect const& dialect = EVMDialect::strictAssemblyForEVMObjects(langutil::EVMVersion{}, std::nullopt);
+
+	std::vector<BenchmarkSource> sources;
+	size_t expressionCount = 0;
+	size_t skippedFiles = 0;
+	for (fs::path const& path: collectFiles(arguments["input-file"].as<std::vector<std::string>>()))
+	{
+		std::optional<BenchmarkSource> source;
+		try
+		{
+			source = parse(readSource(path), dialect);
+		}
+		catch (...)
+		{
+		}
+		if (!source)
+		{
+			++skippedFiles;
+			continue;
+		}
+		expressionCount += source->expressions.size();
+		sources.emplace_back(std::move(*source));
+	}
+
+	size_t const repetitions = arguments["repetitions"].as<size_t>();
+	size_t matchCount = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < repetitions; ++i)
+		for (BenchmarkSource const& source: sources)
+		{
+			auto ssaValues = [&](YulName _name) -> AssignedValue const* {
+				auto it = source.ssaValues.find(_name);
+				return it == source.ssaValues.end() ? nullptr : &it->second;
+			};
+			for (Expression const* expression: source.expressions)
+				if (SimplificationRules::findFirstMatch(*expression, dialect, ssaValues))
+					++matchCount;
+		}
+	auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+	std::cout << "Files: " << sources.size() << " (" << skippedFiles << " skipped)" << std::endl;
+	std::cout << "Expressions: " << expressionCount << std::endl;
+	std::cout << "Matches per repetition: " << (repetitions > 0 ? matchCount / repetitions : 0) << std::endl;
+	std::cout << "Repetitions: " << repetitions << std::endl;
+	std::cout << "Total matching time: " << duration.count() / 1000 << " ms" << std::endl;
+	if (repetitions > 0 && expressionCount > 0)
+		std::cout <<
+			"Time per expression: " <<
+			static_cast<double>(duration.count()) * 1000.0 / static_cast<double>(repetitions * expressionCount) <<
+			" ns" <<
+			std::endl;
+
+	return 0;
+}
@@ -276,6 +276,35 @@ BOOST_FIXTURE_TEST_CASE(FitnessMetricMinimum_evaluate_should_compute_minimum_of_
 	BOOST_TEST(metric.metrics() == m_simpleMetrics);
 }
 
+BOOST_FIXTURE_TEST_CASE(evaluateAll_should_not_depend_on_thread_count, FitnessMetricCombinationFixture)
+{
+	std::vector<Chromosome> chromosomes = {
+		m_chromosome,
+		Chromosome(""),
+		Chromosome(std::vector<std::string>{UnusedPruner::name}),
+		Chromosome(std::vector<std::string>{EquivalentFunctionCombiner::name, UnusedPruner::name}),
+		m_chromosome,
+	};
+	std::vector<std::shared_ptr<FitnessMetric>> metrics = {
+		std::make_shared<ProgramSize>(std::nullopt, m_programCache, m_weights, 1),
+		std::make_shared<RelativeProgramSize>(std::nullopt, m_programCache, 3, m_weights, 2),
+		std::make_shared<ProgramSize>(m_program, nullptr, m_weights, 3),
+	};
+
+	std::vector<size_t> expectedFitness;
+	for (auto const& chromosome: chromosomes)
+		expectedFitness.push_back(FitnessMetricSum(metrics).evaluate(chromosome));
+
+	for (size_t threads: std::vector<size_t>{1, 2, 4})
+	{
+		m_programCache->clear();
+		FitnessMetricSum metric(metrics);
+		metric.setThreadCount(threads);
+
+		BOOST_TEST(metric.evaluateAll(chromosomes) == expectedFitness);
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
@@ -88,6 +88,7 @@ protected:
 		/* metricAggregator = */ MetricAggregatorChoice::Average,
 		/* relativeMetricScale = */ 5,
 		/* chromosomeRepetitions = */ 1,
+		/* threads = */ 1,
 	};
 	CodeWeights const m_weights{};
 };
@@ -218,6 +219,15 @@ BOOST_FIXTURE_TEST_CASE(build_should_respect_chromosome_repetitions_option, Fitn
 	BOOST_TEST(programSizeMetric->repetitionCount() == m_options.chromosomeRepetitions);
 }
 
+BOOST_FIXTURE_TEST_CASE(build_should_respect_threads_option, FitnessMetricFactoryFixture)
+{
+	m_options.threads = 4;
+	std::unique_ptr<FitnessMetric> metric = FitnessMetricFactory::build(m_options, {m_programs[0]}, {nullptr}, m_weights);
+	BOOST_REQUIRE(metric != nullptr);
+
+	BOOST_TEST(metric->threadCount() == 4);
+}
+
 BOOST_FIXTURE_TEST_CASE(build_should_set_relative_metric_scale, FitnessMetricFactoryFixture)
 {
 	m_options.metric = MetricChoice::RelativeCodeSize;
@@ -386,7 +396,7 @@ BOOST_AUTO_TEST_SUITE(ProgramCacheFactoryTest)
 
 BOOST_FIXTURE_TEST_CASE(build_should_create_cache_for_each_input_program_if_cache_enabled, FixtureWithPrograms)
 {
-	ProgramCacheFactory::Options options{/* programCacheEnabled = */ true};
+	ProgramCacheFactory::Options options{/* programCacheEnabled = */ true, /* maxCacheMemory = */ std::nullopt};
 	std::vector<std::shared_ptr<ProgramCache>> caches = ProgramCacheFactory::build(options, m_programs);
 	assert(m_programs.size() >= 2 && "There must be at least 2 programs for this test to be meaningful");
 
@@ -398,9 +408,24 @@ BOOST_FIXTURE_TEST_CASE(build_should_create_cache_for_each_input_program_if_cach
 	}
 }
 
+BOOST_FIXTURE_TEST_CASE(build_should_split_memory_limit_between_caches, FixtureWithPrograms)
+{
+	ProgramCacheFactory::Options options{/* programCacheEnabled = */ true, /* maxCacheMemory = */ 1000};
+	std::vector<std::shared_ptr<ProgramCache>> caches = ProgramCacheFactory::build(options, m_programs);
+	assert(m_programs.size() >= 2 && "There must be at least 2 programs for this test to be meaningful");
+
+	BOOST_TEST(caches.size() == m_programs.size());
+	for (size_t i = 0; i < m_programs.size(); ++i)
+	{
+		BOOST_REQUIRE(caches[i] != nullptr);
+		BOOST_REQUIRE(caches[i]->maxMemoryUsage().has_value());
+		BOOST_TEST(caches[i]->maxMemoryUsage().value() == 1000 / m_programs.size());
+	}
+}
+
 BOOST_FIXTURE_TEST_CASE(build_should_return_nullptr_for_each_input_program_if_cache_disabled, FixtureWithPrograms)
 {
-	ProgramCacheFactory::Options options{/* programCacheEnabled = */ false};
+	ProgramCacheFactory::Options options{/* programCacheEnabled = */ false, /* maxCacheMemory = */ std::nullopt};
 	std::vector<std::shared_ptr<ProgramCache>> caches = ProgramCacheFactory::build(options, m_programs);
 	assert(m_programs.size() >= 2 && "There must be at least 2 programs for this test to be meaningful");
 
@@ -409,6 +434,12 @@ BOOST_FIXTURE_TEST_CASE(build_should_return_nullptr_for_each_input_program_if_ca
 		BOOST_TEST(caches[i] == nullptr);
 }
 
+BOOST_FIXTURE_TEST_CASE(build_should_reject_memory_limit_if_cache_disabled, FixtureWithPrograms)
+{
+	ProgramCacheFactory::Options options{/* programCacheEnabled = */ false, /* maxCacheMemory = */ 1000};
+	BOOST_CHECK_THROW(ProgramCacheFactory::build(options, m_programs), BadInput);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE(ProgramFactoryTest)
 
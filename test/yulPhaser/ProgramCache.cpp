@@ -59,8 +59,8 @@ protected:
 	static std::set<std::string> cachedKeys(ProgramCache const& _programCache)
 	{
 		 std::set<std::string> keys;
-		for (auto pair = _programCache.entries().begin(); pair != _programCache.entries().end(); ++pair)
-			keys.insert(pair->first);
+		for (auto const& [key, entry]: _programCache.entries())
+			keys.insert(key);
 
 		return keys;
 	}
@@ -75,9 +75,9 @@ BOOST_AUTO_TEST_SUITE(ProgramCacheTest)
 
 BOOST_AUTO_TEST_CASE(CacheStats_operator_plus_should_add_stats_together)
 {
-	CacheStats statsA{11, 12, 13, {{1, 14}, {2, 15}}};
-	CacheStats statsB{21, 22, 23, {{2, 24}, {3, 25}}};
-	CacheStats statsC{32, 34, 36, {{1, 14}, {2, 39}, {3, 25}}};
+	CacheStats statsA{11, 12, 13, 14, {{1, 15}, {2, 16}}};
+	CacheStats statsB{21, 22, 23, 24, {{2, 25}, {3, 26}}};
+	CacheStats statsC{32, 34, 36, 38, {{1, 15}, {2, 41}, {3, 26}}};
 
 	BOOST_CHECK(statsA + statsB == statsC);
 }
@@ -223,12 +223,12 @@ BOOST_FIXTURE_TEST_CASE(gatherStats_should_return_cache_statistics, ProgramCache
 	m_programCache.optimiseProgram("L");
 	m_programCache.optimiseProgram("Iu");
 	BOOST_REQUIRE((cachedKeys(m_programCache) == std::set<std::string>{"L", "I", "Iu"}));
-	CacheStats expectedStats1{0, 3, sizeL + sizeI + sizeIu, {{0, 3}}};
+	CacheStats expectedStats1{0, 3, 0, sizeL + sizeI + sizeIu, {{0, 3}}};
 	BOOST_CHECK(m_programCache.gatherStats() == expectedStats1);
 
 	m_programCache.optimiseProgram("IuO");
 	BOOST_REQUIRE((cachedKeys(m_programCache) == std::set<std::string>{"L", "I", "Iu", "IuO"}));
-	CacheStats expectedStats2{2, 4, sizeL + sizeI + sizeIu + sizeIuO, {{0, 4}}};
+	CacheStats expectedStats2{2, 4, 0, sizeL + sizeI + sizeIu + sizeIuO, {{0, 4}}};
 	BOOST_CHECK(m_programCache.gatherStats() == expectedStats2);
 
 	m_programCache.startRound(1);
@@ -237,20 +237,91 @@ BOOST_FIXTURE_TEST_CASE(gatherStats_should_return_cache_statistics, ProgramCache
 
 	m_programCache.optimiseProgram("IuO");
 	BOOST_REQUIRE((cachedKeys(m_programCache) == std::set<std::string>{"L", "I", "Iu", "IuO"}));
-	CacheStats expectedStats3{5, 4, sizeL + sizeI + sizeIu + sizeIuO, {{0, 1}, {1, 3}}};
+	CacheStats expectedStats3{5, 4, 0, sizeL + sizeI + sizeIu + sizeIuO, {{0, 1}, {1, 3}}};
 	BOOST_CHECK(m_programCache.gatherStats() == expectedStats3);
 
 	m_programCache.startRound(2);
 	BOOST_REQUIRE((cachedKeys(m_programCache) == std::set<std::string>{"I", "Iu", "IuO"}));
-	CacheStats expectedStats4{5, 4, sizeI + sizeIu + sizeIuO, {{1, 3}}};
+	CacheStats expectedStats4{5, 4, 0, sizeI + sizeIu + sizeIuO, {{1, 3}}};
 	BOOST_CHECK(m_programCache.gatherStats() == expectedStats4);
 
 	m_programCache.optimiseProgram("LT");
 	BOOST_REQUIRE((cachedKeys(m_programCache) == std::set<std::string>{"L", "LT", "I", "Iu", "IuO"}));
-	CacheStats expectedStats5{5, 6, sizeL + sizeLT + sizeI + sizeIu + sizeIuO, {{1, 3}, {2, 2}}};
+	CacheStats expectedStats5{5, 6, 0, sizeL + sizeLT + sizeI + sizeIu + sizeIuO, {{1, 3}, {2, 2}}};
 	BOOST_CHECK(m_programCache.gatherStats() == expectedStats5);
 }
 
+BOOST_FIXTURE_TEST_CASE(optimiseProgram_should_not_keep_any_entries_if_memory_limit_is_zero, ProgramCacheFixture)
+{
+	ProgramCache cache(m_program, 0);
+
+	Program cachedProgram = cache.optimiseProgram("IuO");
+
+	BOOST_TEST(toString(cachedProgram) == toString(optimisedProgram(m_program, "IuO")));
+	BOOST_TEST(cache.size() == 0);
+	BOOST_TEST(cache.memoryUsage() == 0);
+
+	CacheStats stats = cache.gatherStats();
+	BOOST_TEST(stats.hits == 0);
+	BOOST_TEST(stats.misses == 3);
+	BOOST_TEST(stats.evictions == 3);
+}
+
+BOOST_FIXTURE_TEST_CASE(optimiseProgram_should_evict_entries_to_stay_within_memory_limit, ProgramCacheFixture)
+{
+	m_programCache.optimiseProgram("IuO");
+	m_programCache.optimiseProgram("L");
+	BOOST_REQUIRE(m_programCache.size() == 4);
+	BOOST_REQUIRE(m_programCache.gatherStats().evictions == 0);
+	size_t unlimitedMemoryUsage = m_programCache.memoryUsage();
+
+	ProgramCache cache(m_program, unlimitedMemoryUsage - 1);
+	cache.optimiseProgram("IuO");
+	cache.optimiseProgram("L");
+
+	BOOST_TEST(cache.size() < 4);
+	BOOST_TEST(cache.memoryUsage() <= unlimitedMemoryUsage - 1);
+	BOOST_TEST(cache.gatherStats().evictions == 4 - cache.size());
+
+	// Whatever got evicted, the result must be the same.
+	Program cachedProgram = cache.optimiseProgram("IuOL");
+	BOOST_TEST(toString(cachedProgram) == toString(optimisedProgram(m_program, "IuOL")));
+	BOOST_TEST(cache.memoryUsage() <= unlimitedMemoryUsage - 1);
+}
+
+BOOST_FIXTURE_TEST_CASE(optimiseProgram_should_reuse_longest_prefix_even_if_shorter_ones_were_evicted, ProgramCacheFixture)
+{
+	m_programCache.optimiseProgram("I");
+	size_t memoryUsageI = m_programCache.memoryUsage();
+
+	// "I" is the cheapest entry to recompute so it is the first to go if "Iu" does not fit.
+	ProgramCache cache(m_program, memoryUsageI);
+	cache.optimiseProgram("Iu");
+	BOOST_REQUIRE((cachedKeys(cache) == std::set<std::string>{"Iu"}));
+
+	Program cachedProgram = cache.optimiseProgram("IuO");
+
+	BOOST_TEST(toString(cachedProgram) == toString(optimisedProgram(m_program, "IuO")));
+	CacheStats stats = cache.gatherStats();
+	BOOST_TEST(stats.hits == 1);
+	BOOST_TEST(stats.misses == 3);
+}
+
+BOOST_FIXTURE_TEST_CASE(find_should_return_program_that_outlives_its_entry, ProgramCacheFixture)
+{
+	m_programCache.optimiseProgram("I");
+	size_t memoryUsageI = m_programCache.memoryUsage();
+
+	ProgramCache cache(m_program, memoryUsageI);
+	cache.optimiseProgram("I");
+	std::shared_ptr<Program const> program = cache.find("I");
+	BOOST_REQUIRE(program);
+
+	cache.optimiseProgram("Iu");
+	BOOST_REQUIRE(!cache.contains("I"));
+	BOOST_TEST(toString(*program) == toString(optimisedProgram(m_program, "I")));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
 
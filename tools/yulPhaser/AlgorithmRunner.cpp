@@ -115,6 +115,7 @@ void AlgorithmRunner::printCacheStats() const
 			m_outputStream << "Round " << round << ": " << count << " entries" << std::endl;
 		m_outputStream << "Total hits: " << totalStats.hits << std::endl;
 		m_outputStream << "Total misses: " << totalStats.misses << std::endl;
+		m_outputStream << "Total evictions: " << totalStats.evictions << std::endl;
 		m_outputStream << "Size of cached code: " << totalStats.totalCodeSize << std::endl;
 	}
 
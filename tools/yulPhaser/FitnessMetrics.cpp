@@ -19,6 +19,7 @@
 #include <tools/yulPhaser/FitnessMetrics.h>
 
 #include <libsolutil/CommonIO.h>
+#include <libsolutil/Parallel.h>
 
 #include <cmath>
 
@@ -26,6 +27,16 @@ using namespace solidity::util;
 using namespace solidity::yul;
 using namespace solidity::phaser;
 
+std::vector<size_t> FitnessMetric::evaluateAll(std::vector<Chromosome> const& _chromosomes)
+{
+	std::vector<size_t> values(_chromosomes.size());
+	parallelFor(_chromosomes.size(), m_threadCount, [&](size_t _index) {
+		values[_index] = evaluate(_chromosomes[_index]);
+	});
+
+	return values;
+}
+
 Program const& ProgramBasedMetric::program() const
 {
 	if (m_programCache == nullptr)
@@ -74,46 +85,73 @@ size_t RelativeProgramSize::evaluate(Chromosome const& _chromosome)
 	));
 }
 
-size_t FitnessMetricAverage::evaluate(Chromosome const& _chromosome)
+size_t FitnessMetricCombination::evaluate(Chromosome const& _chromosome)
+{
+	std::vector<size_t> values;
+	for (auto const& metric: m_metrics)
+		values.push_back(metric->evaluate(_chromosome));
+
+	return combine(values);
+}
+
+std::vector<size_t> FitnessMetricCombination::evaluateAll(std::vector<Chromosome> const& _chromosomes)
+{
+	size_t const metricCount = m_metrics.size();
+	std::vector<size_t> nestedValues(_chromosomes.size() * metricCount);
+	parallelFor(nestedValues.size(), threadCount(), [&](size_t _index) {
+		nestedValues[_index] = m_metrics[_index % metricCount]->evaluate(_chromosomes[_index / metricCount]);
+	});
+
+	std::vector<size_t> values;
+	for (size_t i = 0; i < _chromosomes.size(); ++i)
+		values.push_back(combine(std::vector<size_t>(
+			nestedValues.begin() + static_cast<ptrdiff_t>(i * metricCount),
+			nestedValues.begin() + static_cast<ptrdiff_t>((i + 1) * metricCount)
+		)));
+
+	return values;
+}
+
+size_t FitnessMetricAverage::combine(std::vector<size_t> const& _values) const
 {
-	assert(m_metrics.size() > 0);
+	assert(_values.size() > 0);
 
-	size_t total = m_metrics[0]->evaluate(_chromosome);
-	for (size_t i = 1; i < m_metrics.size(); ++i)
-		total += m_metrics[i]->evaluate(_chromosome);
+	size_t total = _values[0];
+	for (size_t i = 1; i < _values.size(); ++i)
+		total += _values[i];
 
-	return total / m_metrics.size();
+	return total / _values.size();
 }
 
-size_t FitnessMetricSum::evaluate(Chromosome const& _chromosome)
+size_t FitnessMetricSum::combine(std::vector<size_t> const& _values) const
 {
-	assert(m_metrics.size() > 0);
+	assert(_values.size() > 0);
 
-	size_t total = m_metrics[0]->evaluate(_chromosome);
-	for (size_t i = 1; i < m_metrics.size(); ++i)
-		total += m_metrics[i]->evaluate(_chromosome);
+	size_t total = _values[0];
+	for (size_t i = 1; i < _values.size(); ++i)
+		total += _values[i];
 
 	return total;
 }
 
-size_t FitnessMetricMaximum::evaluate(Chromosome const& _chromosome)
+size_t FitnessMetricMaximum::combine(std::vector<size_t> const& _values) const
 {
-	assert(m_metrics.size() > 0);
+	assert(_values.size() > 0);
 
-	size_t maximum = m_metrics[0]->evaluate(_chromosome);
-	for (size_t i = 1; i < m_metrics.size(); ++i)
-		maximum = std::max(maximum, m_metrics[i]->evaluate(_chromosome));
+	size_t maximum = _values[0];
+	for (size_t i = 1; i < _values.size(); ++i)
+		maximum = std::max(maximum, _values[i]);
 
 	return maximum;
 }
 
-size_t FitnessMetricMinimum::evaluate(Chromosome const& _chromosome)
+size_t FitnessMetricMinimum::combine(std::vector<size_t> const& _values) const
 {
-	assert(m_metrics.size() > 0);
+	assert(_values.size() > 0);
 
-	size_t minimum = m_metrics[0]->evaluate(_chromosome);
-	for (size_t i = 1; i < m_metrics.size(); ++i)
-		minimum = std::min(minimum, m_metrics[i]->evaluate(_chromosome));
+	size_t minimum = _values[0];
+	for (size_t i = 1; i < _values.size(); ++i)
+		minimum = std::min(minimum, _values[i]);
 
 	return minimum;
 }
@@ -29,6 +29,7 @@
 
 #include <cstddef>
 #include <optional>
+#include <vector>
 
 namespace solidity::phaser
 {
@@ -39,6 +40,9 @@ namespace solidity::phaser
  * The main feature is the @a evaluate() method that can tell how good a given chromosome is.
  * The lower the value, the better the fitness is. The result should be deterministic and depend
  * only on the chromosome and metric's state (which is constant).
+ *
+ * @a evaluateAll() evaluates multiple chromosomes on up to @a threadCount() threads. Metrics must
+ * therefore allow @a evaluate() to be called concurrently.
  */
 class FitnessMetric
 {
@@ -49,6 +53,16 @@ public:
 	virtual ~FitnessMetric() = default;
 
 	virtual size_t evaluate(Chromosome const& _chromosome) = 0;
+
+	/// @returns the fitness of each of @a _chromosomes. The values are the same as the ones
+	/// returned by @a evaluate() and do not depend on the number of threads.
+	virtual std::vector<size_t> evaluateAll(std::vector<Chromosome> const& _chromosomes);
+
+	size_t threadCount() const { return m_threadCount; }
+	void setThreadCount(size_t _threadCount) { m_threadCount = _threadCount; }
+
+private:
+	size_t m_threadCount = 1;
 };
 
 /**
@@ -135,6 +149,9 @@ private:
 /**
  * Abstract base class for fitness metrics that compute their value based on values of multiple
  * other, nested metrics.
+ *
+ * When evaluating multiple chromosomes, each pair of a chromosome and a nested metric is
+ * a separate task so that all threads can be kept busy even if there are few chromosomes.
  */
 class FitnessMetricCombination: public FitnessMetric
 {
@@ -144,7 +161,14 @@ public:
 
 	std::vector<std::shared_ptr<FitnessMetric>> const& metrics() const { return m_metrics; }
 
+	size_t evaluate(Chromosome const& _chromosome) override;
+	std::vector<size_t> evaluateAll(std::vector<Chromosome> const& _chromosomes) override;
+
 protected:
+	/// @returns the combined value of the values of the nested metrics, given in the same order
+	/// as the metrics.
+	virtual size_t combine(std::vector<size_t> const& _values) const = 0;
+
 	std::vector<std::shared_ptr<FitnessMetric>> m_metrics;
 };
 
@@ -155,7 +179,9 @@ class FitnessMetricAverage: public FitnessMetricCombination
 {
 public:
 	using FitnessMetricCombination::FitnessMetricCombination;
-	size_t evaluate(Chromosome const& _chromosome) override;
+
+protected:
+	size_t combine(std::vector<size_t> const& _values) const override;
 };
 
 /**
@@ -165,7 +191,9 @@ class FitnessMetricSum: public FitnessMetricCombination
 {
 public:
 	using FitnessMetricCombination::FitnessMetricCombination;
-	size_t evaluate(Chromosome const& _chromosome) override;
+
+protected:
+	size_t combine(std::vector<size_t> const& _values) const override;
 };
 
 /**
@@ -175,7 +203,9 @@ class FitnessMetricMaximum: public FitnessMetricCombination
 {
 public:
 	using FitnessMetricCombination::FitnessMetricCombination;
-	size_t evaluate(Chromosome const& _chromosome) override;
+
+protected:
+	size_t combine(std::vector<size_t> const& _values) const override;
 };
 
 /**
@@ -185,7 +215,9 @@ class FitnessMetricMinimum: public FitnessMetricCombination
 {
 public:
 	using FitnessMetricCombination::FitnessMetricCombination;
-	size_t evaluate(Chromosome const& _chromosome) override;
+
+protected:
+	size_t combine(std::vector<size_t> const& _values) const override;
 };
 
 }
@@ -34,6 +34,7 @@
 #include <libsolutil/Assertions.h>
 #include <libsolutil/CommonData.h>
 #include <libsolutil/CommonIO.h>
+#include <libsolutil/Parallel.h>
 
 #include <iostream>
 
@@ -218,6 +219,7 @@ FitnessMetricFactory::Options FitnessMetricFactory::Options::fromCommandLine(po:
 		_arguments["metric-aggregator"].as<MetricAggregatorChoice>(),
 		_arguments["relative-metric-scale"].as<size_t>(),
 		_arguments["chromosome-repetitions"].as<size_t>(),
+		util::resolveThreadCount(_arguments["threads"].as<size_t>()),
 	};
 }
 
@@ -262,22 +264,27 @@ std::unique_ptr<FitnessMetric> FitnessMetricFactory::build(
 			assertThrow(false, solidity::util::Exception, "Invalid MetricChoice value.");
 	}
 
+	std::unique_ptr<FitnessMetric> aggregatedMetric;
 	switch (_options.metricAggregator)
 	{
 		case MetricAggregatorChoice::Average:
-			return std::make_unique<FitnessMetricAverage>(std::move(metrics));
+			aggregatedMetric = std::make_unique<FitnessMetricAverage>(std::move(metrics));
+			break;
 		case MetricAggregatorChoice::Sum:
-			return std::make_unique<FitnessMetricSum>(std::move(metrics));
+			aggregatedMetric = std::make_unique<FitnessMetricSum>(std::move(metrics));
+			break;
 		case MetricAggregatorChoice::Maximum:
-			return std::make_unique<FitnessMetricMaximum>(std::move(metrics));
+			aggregatedMetric = std::make_unique<FitnessMetricMaximum>(std::move(metrics));
+			break;
 		case MetricAggregatorChoice::Minimum:
-			return std::make_unique<FitnessMetricMinimum>(std::move(metrics));
+			aggregatedMetric = std::make_unique<FitnessMetricMinimum>(std::move(metrics));
+			break;
 		default:
 			assertThrow(false, solidity::util::Exception, "Invalid MetricAggregatorChoice value.");
 	}
 
-	// FIXME: Workaround for spurious GCC 12.1 warning (https://gcc.gnu.org/bugzilla/show_bug.cgi?id=105794)
-	util::unreachable();
+	aggregatedMetric->setThreadCount(_options.threads);
+	return aggregatedMetric;
 }
 
 PopulationFactory::Options PopulationFactory::Options::fromCommandLine(po::variables_map const& _arguments)
@@ -360,6 +367,9 @@ ProgramCacheFactory::Options ProgramCacheFactory::Options::fromCommandLine(po::v
 {
 	return {
 		_arguments["program-cache"].as<bool>(),
+		_arguments.count("max-cache-memory") > 0 ?
+			static_cast<std::optional<size_t>>(_arguments["max-cache-memory"].as<size_t>() * 1024 * 1024) :
+			std::nullopt,
 	};
 }
 
@@ -368,9 +378,20 @@ std::vector<std::shared_ptr<ProgramCache>> ProgramCacheFactory::build(
 	std::vector<Program> _programs
 )
 {
+	assertThrow(
+		_options.programCacheEnabled || !_options.maxCacheMemory.has_value(),
+		BadInput,
+		"--max-cache-memory requires --program-cache."
+	);
+
+	// The limit applies to all the caches together so each one gets an equal share.
+	std::optional<size_t> maxMemoryPerCache;
+	if (_options.maxCacheMemory.has_value() && !_programs.empty())
+		maxMemoryPerCache = _options.maxCacheMemory.value() / _programs.size();
+
 	std::vector<std::shared_ptr<ProgramCache>> programCaches;
 	for (Program& program: _programs)
-		programCaches.push_back(_options.programCacheEnabled ? std::make_shared<ProgramCache>(std::move(program)) : nullptr);
+		programCaches.push_back(_options.programCacheEnabled ? std::make_shared<ProgramCache>(std::move(program), maxMemoryPerCache) : nullptr);
 
 	return programCaches;
 }
@@ -681,6 +702,13 @@ Phaser::CommandLineDescription Phaser::buildCommandLineDescription()
 			po::value<size_t>()->value_name("<COUNT>")->default_value(1),
 			"Number of times to repeat the sequence optimisation steps represented by a chromosome."
 		)
+		(
+			"threads",
+			po::value<size_t>()->value_name("<COUNT>")->default_value(1),
+			"Number of threads used to evaluate the fitness of chromosomes. "
+			"0 means one thread per available hardware thread. "
+			"The results for a given seed do not depend on this value."
+		)
 	;
 	keywordDescription.add(metricsDescription);
 
@@ -713,8 +741,15 @@ Phaser::CommandLineDescription Phaser::buildCommandLineDescription()
 			po::bool_switch(),
 			"Enables caching of intermediate programs corresponding to chromosome prefixes.\n"
 			"This speeds up fitness evaluation by a lot but eats tons of memory if the chromosomes are long. "
-			"Disabled by default since there's currently no way to set an upper limit on memory usage but "
-			"highly recommended if your computer has enough RAM."
+			"Disabled by default but highly recommended if your computer has enough RAM. "
+			"Use --max-cache-memory to put an upper limit on memory usage."
+		)
+		(
+			"max-cache-memory",
+			po::value<size_t>()->value_name("<MEGABYTES>"),
+			"Approximate limit on the amount of memory used by the program cache, shared equally between "
+			"all input programs. When the limit is reached, programs that were not used recently are evicted, "
+			"preferring ones that are large and cheap to recompute. Requires --program-cache. (default=no limit)"
 		)
 	;
 	keywordDescription.add(cacheDescription);
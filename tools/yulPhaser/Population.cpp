@@ -95,26 +95,23 @@ Population Population::select(Selection const& _selection) const
 
 Population Population::mutate(Selection const& _selection, std::function<Mutation> _mutation) const
 {
-	std::vector<Individual> mutatedIndividuals;
+	std::vector<Chromosome> mutatedChromosomes;
 	for (size_t i: _selection.materialise(m_individuals.size()))
-		mutatedIndividuals.emplace_back(_mutation(m_individuals[i].chromosome), *m_fitnessMetric);
+		mutatedChromosomes.push_back(_mutation(m_individuals[i].chromosome));
 
-	return Population(m_fitnessMetric, mutatedIndividuals);
+	return Population(m_fitnessMetric, std::move(mutatedChromosomes));
 }
 
 Population Population::crossover(PairSelection const& _selection, std::function<Crossover> _crossover) const
 {
-	std::vector<Individual> crossedIndividuals;
+	std::vector<Chromosome> crossedChromosomes;
 	for (auto const& [i, j]: _selection.materialise(m_individuals.size()))
-	{
-		auto childChromosome = _crossover(
+		crossedChromosomes.push_back(_crossover(
 			m_individuals[i].chromosome,
 			m_individuals[j].chromosome
-		);
-		crossedIndividuals.emplace_back(std::move(childChromosome), *m_fitnessMetric);
-	}
+		));
 
-	return Population(m_fitnessMetric, crossedIndividuals);
+	return Population(m_fitnessMetric, std::move(crossedChromosomes));
 }
 
 std::tuple<Population, Population> Population::symmetricCrossoverWithRemainder(
@@ -124,15 +121,15 @@ std::tuple<Population, Population> Population::symmetricCrossoverWithRemainder(
 {
 	std::vector<int> indexSelected(m_individuals.size(), false);
 
-	std::vector<Individual> crossedIndividuals;
+	std::vector<Chromosome> crossedChromosomes;
 	for (auto const& [i, j]: _selection.materialise(m_individuals.size()))
 	{
 		auto children = _symmetricCrossover(
 			m_individuals[i].chromosome,
 			m_individuals[j].chromosome
 		);
-		crossedIndividuals.emplace_back(std::move(std::get<0>(children)), *m_fitnessMetric);
-		crossedIndividuals.emplace_back(std::move(std::get<1>(children)), *m_fitnessMetric);
+		crossedChromosomes.push_back(std::move(std::get<0>(children)));
+		crossedChromosomes.push_back(std::move(std::get<1>(children)));
 		indexSelected[i] = true;
 		indexSelected[j] = true;
 	}
@@ -143,7 +140,7 @@ std::tuple<Population, Population> Population::symmetricCrossoverWithRemainder(
 			remainder.emplace_back(m_individuals[i]);
 
 	return {
-		Population(m_fitnessMetric, crossedIndividuals),
+		Population(m_fitnessMetric, std::move(crossedChromosomes)),
 		Population(m_fitnessMetric, remainder),
 	};
 }
@@ -190,9 +187,13 @@ std::vector<Individual> Population::chromosomesToIndividuals(
 	std::vector<Chromosome> _chromosomes
 )
 {
+	// Chromosomes are generated first and only then evaluated together so that the evaluation can
+	// be spread over multiple threads without affecting the order of calls to the RNG.
+	std::vector<size_t> fitness = _fitnessMetric.evaluateAll(_chromosomes);
+
 	std::vector<Individual> individuals;
-	for (auto& chromosome: _chromosomes)
-		individuals.emplace_back(std::move(chromosome), _fitnessMetric);
+	for (size_t i = 0; i < _chromosomes.size(); ++i)
+		individuals.emplace_back(std::move(_chromosomes[i]), fitness[i]);
 
 	return individuals;
 }
@@ -18,17 +18,170 @@
 
 #include <tools/yulPhaser/ProgramCache.h>
 
+#include <libyul/optimiser/ASTWalker.h>
 #include <libyul/optimiser/Metrics.h>
 
 #include <libyul/optimiser/Suite.h>
+#include <libyul/AST.h>
+
+#include <algorithm>
+#include <unordered_set>
 
 using namespace solidity::yul;
 using namespace solidity::phaser;
 
+namespace
+{
+
+/**
+ * Adds up the heap memory allocated for an AST and the name dispenser of its program:
+ * the buffers of all vectors, boxed child expressions and literals, debug data and literal
+ * strings, and a set node for every declared name. Debug data and literal strings may be
+ * shared between nodes and between copies of the AST and are counted once per AST.
+ *
+ * Every allocation is counted with a fixed overhead for the bookkeeping of the allocator,
+ * which also serves as a safety margin for fragmentation. The strings of names are not
+ * counted since they are interned by YulStringRepository and shared by all programs.
+ */
+class HeapUsageEstimator: public ASTWalker
+{
+public:
+	using ASTWalker::operator();
+
+	size_t usage() const { return m_usage; }
+
+	void operator()(Literal const& _literal) override
+	{
+		addDebugData(_literal.debugData);
+		if (LiteralValue::RepresentationHint const& hint = _literal.value.hint())
+			addShared(hint.get(), sizeof(std::string) + hint->capacity());
+	}
+	void operator()(Identifier const& _identifier) override
+	{
+		addDebugData(_identifier.debugData);
+	}
+	void operator()(FunctionCall const& _funCall) override
+	{
+		addDebugData(_funCall.debugData);
+		(*this)(_funCall.functionName);
+		addBuffer(_funCall.arguments);
+		ASTWalker::operator()(_funCall);
+	}
+	void operator()(ExpressionStatement const& _statement) override
+	{
+		addDebugData(_statement.debugData);
+		ASTWalker::operator()(_statement);
+	}
+	void operator()(Assignment const& _assignment) override
+	{
+		addDebugData(_assignment.debugData);
+		addBuffer(_assignment.variableNames);
+		addBoxed(_assignment.value);
+		ASTWalker::operator()(_assignment);
+	}
+	void operator()(VariableDeclaration const& _varDecl) override
+	{
+		addDebugData(_varDecl.debugData);
+		addNames(_varDecl.variables);
+		addBoxed(_varDecl.value);
+		ASTWalker::operator()(_varDecl);
+	}
+	void operator()(If const& _if) override
+	{
+		addDebugData(_if.debugData);
+		addBoxed(_if.condition);
+		ASTWalker::operator()(_if);
+	}
+	void operator()(Switch const& _switch) override
+	{
+		addDebugData(_switch.debugData);
+		addBoxed(_switch.expression);
+		addBuffer(_switch.cases);
+		for (Case const& _case: _switch.cases)
+		{
+			addDebugData(_case.debugData);
+			addBoxed(_case.value);
+		}
+		ASTWalker::operator()(_switch);
+	}
+	void operator()(FunctionDefinition const& _function) override
+	{
+		addDebugData(_function.debugData);
+		m_usage += nameNodeSize;
+		addNames(_function.parameters);
+		addNames(_function.returnVariables);
+		ASTWalker::operator()(_function);
+	}
+	void operator()(ForLoop const& _for) override
+	{
+		addDebugData(_for.debugData);
+		addBoxed(_for.condition);
+		ASTWalker::operator()(_for);
+	}
+	void operator()(Break const& _break) override { addDebugData(_break.debugData); }
+	void operator()(Continue const& _continue) override { addDebugData(_continue.debugData); }
+	void operator()(Leave const& _leave) override { addDebugData(_leave.debugData); }
+	void operator()(Block const& _block) override
+	{
+		addDebugData(_block.debugData);
+		addBuffer(_block.statements);
+		ASTWalker::operator()(_block);
+	}
+
+	/// Bookkeeping overhead of the allocator added to every allocation.
+	static size_t constexpr allocationOverhead = 16;
+	/// Size of the control block that std::make_shared places next to the object.
+	static size_t constexpr sharedControlBlockSize = 16;
+	/// Size of a node of a red-black tree without the value: three pointers and the colour.
+	static size_t constexpr treeNodeOverhead = 4 * sizeof(void*) + allocationOverhead;
+
+private:
+	/// Size of a node of the set of used names kept by the name dispenser.
+	static size_t constexpr nameNodeSize = treeNodeOverhead + sizeof(YulName);
+
+	template<typename T>
+	void addBuffer(std::vector<T> const& _vector)
+	{
+		if (_vector.capacity() > 0)
+			m_usage += _vector.capacity() * sizeof(T) + allocationOverhead;
+	}
+	template<typename T>
+	void addBoxed(std::unique_ptr<T> const& _pointer)
+	{
+		if (_pointer)
+			m_usage += sizeof(T) + allocationOverhead;
+	}
+	void addNames(NameWithDebugDataList const& _names)
+	{
+		addBuffer(_names);
+		for (NameWithDebugData const& name: _names)
+		{
+			addDebugData(name.debugData);
+			m_usage += nameNodeSize;
+		}
+	}
+	void addDebugData(solidity::langutil::DebugData::ConstPtr const& _debugData)
+	{
+		if (_debugData)
+			addShared(_debugData.get(), sizeof(solidity::langutil::DebugData));
+	}
+	void addShared(void const* _object, size_t _size)
+	{
+		if (m_sharedObjects.insert(_object).second)
+			m_usage += _size + sharedControlBlockSize + allocationOverhead;
+	}
+
+	size_t m_usage = 0;
+	std::unordered_set<void const*> m_sharedObjects;
+};
+
+}
+
 CacheStats& CacheStats::operator+=(CacheStats const& _other)
 {
 	hits += _other.hits;
 	misses += _other.misses;
+	evictions += _other.evictions;
 	totalCodeSize += _other.totalCodeSize;
 
 	for (auto& [round, count]: _other.roundEntryCounts)
@@ -45,6 +198,7 @@ bool CacheStats::operator==(CacheStats const& _other) const
 	return
 		hits == _other.hits &&
 		misses == _other.misses &&
+		evictions == _other.evictions &&
 		totalCodeSize == _other.totalCodeSize &&
 		roundEntryCounts == _other.roundEntryCounts;
 }
@@ -59,31 +213,43 @@ Program ProgramCache::optimiseProgram(
 		targetOptimisations += _abbreviatedOptimisationSteps;
 
 	std::size_t prefixSize = 0;
-	for (std::size_t i = 1; i <= targetOptimisations.size(); ++i)
+	std::shared_ptr<Program const> prefixProgram;
 	{
-		auto const& pair = m_entries.find(targetOptimisations.substr(0, i));
-		if (pair != m_entries.end())
+		std::lock_guard<std::mutex> lock(m_mutex);
+		for (std::size_t i = 1; i <= targetOptimisations.size(); ++i)
 		{
-			pair->second.roundNumber = m_currentRound;
-			++prefixSize;
-			++m_hits;
+			auto pair = m_entries.find(targetOptimisations.substr(0, i));
+			if (pair != m_entries.end())
+			{
+				pair->second.roundNumber = m_currentRound;
+				touch(pair);
+				prefixProgram = pair->second.program;
+				prefixSize = i;
+				++m_hits;
+			}
 		}
-		else
-			break;
 	}
 
-	Program intermediateProgram = (
-		prefixSize == 0 ?
-		m_program :
-		m_entries.at(targetOptimisations.substr(0, prefixSize)).program
-	);
+	// Copying and optimising the program is the expensive part and must not block other threads.
+	// The entry may get evicted in the meantime but the program stays alive as long as we hold it.
+	Program intermediateProgram = (prefixProgram == nullptr ? m_program : *prefixProgram);
 
 	for (std::size_t i = prefixSize + 1; i <= targetOptimisations.size(); ++i)
 	{
 		std::string stepName = OptimiserSuite::stepAbbreviationToNameMap().at(targetOptimisations[i - 1]);
 		intermediateProgram.optimise({stepName});
 
-		m_entries.insert({targetOptimisations.substr(0, i), {intermediateProgram, m_currentRound}});
+		std::string key = targetOptimisations.substr(0, i);
+		CacheEntry entry(intermediateProgram, m_currentRound, estimateMemoryUsage(key, intermediateProgram));
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto [pair, inserted] = m_entries.insert({std::move(key), std::move(entry)});
+		if (inserted)
+		{
+			m_memoryUsage += pair->second.memoryUsage;
+			touch(pair);
+			enforceMemoryLimit();
+		}
 		++m_misses;
 	}
 
@@ -100,7 +266,7 @@ void ProgramCache::startRound(std::size_t _roundNumber)
 		assert(pair->second.roundNumber < m_currentRound);
 
 		if (pair->second.roundNumber < m_currentRound - 1)
-			m_entries.erase(pair++);
+			erase(pair++);
 		else
 			++pair;
 	}
@@ -109,33 +275,110 @@ void ProgramCache::startRound(std::size_t _roundNumber)
 void ProgramCache::clear()
 {
 	m_entries.clear();
+	m_evictionQueue.clear();
+	m_memoryUsage = 0;
+	m_inflation = 0.0;
 	m_currentRound = 0;
 }
 
-Program const* ProgramCache::find(std::string const& _abbreviatedOptimisationSteps) const
+std::size_t ProgramCache::size() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_entries.size();
+}
+
+std::size_t ProgramCache::memoryUsage() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_memoryUsage;
+}
+
+std::shared_ptr<Program const> ProgramCache::find(std::string const& _abbreviatedOptimisationSteps) const
 {
+	std::lock_guard<std::mutex> lock(m_mutex);
 	auto const& pair = m_entries.find(_abbreviatedOptimisationSteps);
 	if (pair == m_entries.end())
 		return nullptr;
 
-	return &(pair->second.program);
+	return pair->second.program;
+}
+
+std::map<std::string, CacheEntry> ProgramCache::entries() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_entries;
 }
 
 CacheStats ProgramCache::gatherStats() const
 {
+	std::lock_guard<std::mutex> lock(m_mutex);
 	return {
 		/* hits = */ m_hits,
 		/* misses = */ m_misses,
+		/* evictions = */ m_evictions,
 		/* totalCodeSize = */ calculateTotalCachedCodeSize(),
 		/* roundEntryCounts = */ countRoundEntries(),
 	};
 }
 
+std::size_t ProgramCache::estimateMemoryUsage(std::string const& _key, Program const& _program)
+{
+	HeapUsageEstimator estimator;
+	estimator(_program.ast());
+
+	// The entry and its key live in a node of m_entries, the key again in a node of m_evictionQueue.
+	std::size_t const entryNodes =
+		sizeof(std::pair<std::string const, CacheEntry>) +
+		sizeof(std::pair<double, std::string>) +
+		2 * (HeapUsageEstimator::treeNodeOverhead + _key.size());
+	// CacheEntry owns the program through std::make_shared, the program owns the AST through std::unique_ptr.
+	std::size_t constexpr programSize =
+		sizeof(Program) + HeapUsageEstimator::sharedControlBlockSize + HeapUsageEstimator::allocationOverhead +
+		sizeof(AST) + HeapUsageEstimator::allocationOverhead;
+
+	return entryNodes + programSize + estimator.usage();
+}
+
+void ProgramCache::touch(EntryIterator _entry)
+{
+	CacheEntry& entry = _entry->second;
+	assert(entry.memoryUsage > 0);
+
+	m_evictionQueue.erase({entry.priority, _entry->first});
+	entry.priority = m_inflation + static_cast<double>(_entry->first.size()) / static_cast<double>(entry.memoryUsage);
+	m_evictionQueue.insert({entry.priority, _entry->first});
+}
+
+void ProgramCache::erase(EntryIterator _entry)
+{
+	assert(m_memoryUsage >= _entry->second.memoryUsage);
+
+	m_memoryUsage -= _entry->second.memoryUsage;
+	m_evictionQueue.erase({_entry->second.priority, _entry->first});
+	m_entries.erase(_entry);
+}
+
+void ProgramCache::enforceMemoryLimit()
+{
+	if (!m_maxMemoryUsage.has_value())
+		return;
+
+	while (m_memoryUsage > m_maxMemoryUsage.value() && !m_evictionQueue.empty())
+	{
+		auto entry = m_entries.find(m_evictionQueue.begin()->second);
+		assert(entry != m_entries.end());
+
+		m_inflation = entry->second.priority;
+		erase(entry);
+		++m_evictions;
+	}
+}
+
 std::size_t ProgramCache::calculateTotalCachedCodeSize() const
 {
 	std::size_t size = 0;
 	for (auto const& pair: m_entries)
-		size += pair.second.program.codeSize(CacheStats::StorageWeights);
+		size += pair.second.program->codeSize(CacheStats::StorageWeights);
 
 	return size;
 }
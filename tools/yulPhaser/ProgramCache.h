@@ -24,7 +24,12 @@
 
 #include <cstddef>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
 #include <string>
+#include <utility>
 
 namespace solidity::phaser
 {
@@ -35,12 +40,18 @@ namespace solidity::phaser
  */
 struct CacheEntry
 {
-	Program program;
+	/// Shared so that a thread can keep using a program after its entry has been evicted.
+	std::shared_ptr<Program const> program;
 	size_t roundNumber;
-
-	CacheEntry(Program _program, size_t _roundNumber):
-		program(std::move(_program)),
-		roundNumber(_roundNumber) {}
+	/// Estimated number of bytes taken by the entry.
+	size_t memoryUsage;
+	/// Entries with lower priority get evicted first when the cache exceeds its memory limit.
+	double priority = 0.0;
+
+	CacheEntry(Program _program, size_t _roundNumber, size_t _memoryUsage):
+		program(std::make_shared<Program const>(std::move(_program))),
+		roundNumber(_roundNumber),
+		memoryUsage(_memoryUsage) {}
 };
 
 /**
@@ -73,6 +84,7 @@ struct CacheStats
 
 	size_t hits;
 	size_t misses;
+	size_t evictions;
 	size_t totalCodeSize;
 	std::map<size_t, size_t> roundEntryCounts;
 
@@ -93,21 +105,37 @@ struct CacheStats
  * encountered in the current and the previous rounds. Entries older than that get removed to
  * conserve memory.
  *
+ * Optionally the cache can be given a limit on the (estimated) amount of memory it may use.
+ * When an insertion pushes it over the limit, entries get evicted in the order determined by
+ * the GreedyDual-Size algorithm: the priority of an entry is the number of optimisation steps
+ * needed to recompute it from scratch divided by its size, plus an inflation value that grows with
+ * each eviction. Each hit refreshes the priority. This way entries that have not been used
+ * for a while are evicted first, but long prefixes and small programs stay in the cache longer
+ * than short prefixes and large programs. Since any prefix can get evicted, lookups do not stop
+ * at the first missing prefix and always start from the longest cached one.
+ *
  * @a gatherStats() allows getting statistics useful for determining cache effectiveness.
  *
  * The current strategy does speed things up (about 4:1 hit:miss ratio observed in my limited
  * experiments) but there's room for improvement. We could fit more useful programs in
  * the cache by being more picky about which ones we choose.
  *
- * There is currently no way to purge entries without starting a new round. Since the programs
- * take a lot of memory, this may lead to the cache eating up all the available RAM if sequences are
- * long and programs large. A limiter based on entry count or total program size would be useful.
+ * @a optimiseProgram(), @a find(), @a entries() and @a gatherStats() may be called from multiple
+ * threads at once.
+ * The programs do not depend on the order of calls but the hit and miss counts may since two
+ * threads can end up computing the same entry. @a startRound() and @a clear() must not be called
+ * concurrently with any other member function.
+ *
+ * Without a memory limit there is no way to purge entries without starting a new round. Since
+ * the programs take a lot of memory, this may lead to the cache eating up all the available RAM
+ * if sequences are long and programs large.
  */
 class ProgramCache
 {
 public:
-	explicit ProgramCache(Program _program):
-		m_program(std::move(_program)) {}
+	explicit ProgramCache(Program _program, std::optional<size_t> _maxMemoryUsage = std::nullopt):
+		m_program(std::move(_program)),
+		m_maxMemoryUsage(_maxMemoryUsage) {}
 
 	Program optimiseProgram(
 		std::string const& _abbreviatedOptimisationSteps,
@@ -116,17 +144,37 @@ public:
 	void startRound(size_t _nextRoundNumber);
 	void clear();
 
-	size_t size() const { return m_entries.size(); }
-	Program const* find(std::string const& _abbreviatedOptimisationSteps) const;
+	size_t size() const;
+	/// @returns the cached program or nullptr. The program stays valid even if its entry gets evicted.
+	std::shared_ptr<Program const> find(std::string const& _abbreviatedOptimisationSteps) const;
 	bool contains(std::string const& _abbreviatedOptimisationSteps) const { return find(_abbreviatedOptimisationSteps) != nullptr; }
 
 	CacheStats gatherStats() const;
 
-	std::map<std::string, CacheEntry> const& entries() const { return m_entries; }
+	/// @returns a copy of the entries. The copies share their programs with the cache.
+	std::map<std::string, CacheEntry> entries() const;
 	Program const& program() const { return m_program; }
 	size_t currentRound() const { return m_currentRound; }
+	size_t memoryUsage() const;
+	std::optional<size_t> maxMemoryUsage() const { return m_maxMemoryUsage; }
 
 private:
+	using EntryIterator = std::map<std::string, CacheEntry>::iterator;
+
+	/// @returns an estimate of the number of bytes taken by an entry for @a _program, including
+	/// the heap memory allocated by the AST. Allocator overhead is approximated by a fixed amount
+	/// per allocation.
+	static size_t estimateMemoryUsage(std::string const& _key, Program const& _program);
+
+	/// Updates the priority of the entry after it has been inserted or used.
+	/// Must be called with @a m_mutex locked.
+	void touch(EntryIterator _entry);
+	/// Removes the entry from the cache. Must be called with @a m_mutex locked.
+	void erase(EntryIterator _entry);
+	/// Evicts entries with the lowest priority until the memory limit is satisfied.
+	/// Must be called with @a m_mutex locked.
+	void enforceMemoryLimit();
+
 	size_t calculateTotalCachedCodeSize() const;
 	std::map<size_t, size_t> countRoundEntries() const;
 
@@ -134,11 +182,22 @@ private:
 	// the programs are orders of magnitude larger than the prefixes, it does not really matter.
 	// A map should be good enough.
 	std::map<std::string, CacheEntry> m_entries;
+	/// Keys of all entries ordered by their priority.
+	std::set<std::pair<double, std::string>> m_evictionQueue;
 
 	Program m_program;
+	std::optional<size_t> m_maxMemoryUsage;
+	size_t m_memoryUsage = 0;
+	/// The priority of the most recently evicted entry. Added to priorities of entries when they
+	/// are used so that entries used recently are preferred over ones used long ago.
+	double m_inflation = 0.0;
 	size_t m_currentRound = 0;
 	size_t m_hits = 0;
 	size_t m_misses = 0;
+	size_t m_evictions = 0;
+
+	/// Guards the entries and the statistics when the cache is used by multiple threads.
+	mutable std::mutex m_mutex;
 };
 
 }